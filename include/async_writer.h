@@ -0,0 +1,35 @@
+#pragma once
+
+#include <functional>
+
+/**
+   @file async_writer.h
+
+   Background I/O thread used to take instrumentation output (force
+   monitor, profiles) off the critical path.  Jobs are handed to the
+   thread through a fixed-capacity single-producer single-consumer
+   lock-free queue, so queueing a job never takes a lock and only
+   blocks if the queue is full.  Jobs run in the order they were
+   queued.  Like the rest of the instrumentation, jobs must only be
+   queued from the host thread that drives QUDA.
+ */
+
+namespace quda {
+
+  /**
+     @brief Queue a job to be run by the background I/O thread,
+     starting the thread if needed.  The job must own all the data it
+     writes, since it runs asynchronously.
+     @param[in] job The job to run
+   */
+  void asyncWrite(std::function<void()> job);
+
+  /**
+     @brief Wait for all queued jobs to complete and stop the
+     background I/O thread.  It is restarted by the next asyncWrite.
+     This is called by endQuda, and is also registered with atexit so
+     that the thread is stopped if the process exits without it.
+   */
+  void asyncWriteFinalize();
+
+} // namespace quda
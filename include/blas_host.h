@@ -0,0 +1,44 @@
+#include <vector>
+#include <quda_internal.h>
+#include <color_spinor_field.h>
+
+#pragma once
+
+namespace quda {
+  namespace hostblas {
+
+    /**
+       Batch inversion of the matrix field on the host using
+       Gauss-Jordan elimination with partial pivoting.  The matrices
+       are processed in groups that are interleaved across the batch,
+       such that the elimination vectorizes over the matrices in a
+       group, with the groups distributed over the OpenMP threads.
+       @param[out] Ainv Matrix field containing the inverse matrices
+       @param[in] A Matrix field containing the input matrices
+       @param[in] n Dimension each matrix
+       @param[in] batch Problem batch size
+       @param[in] precision Precision of the input/output data
+       @return Number of flops done in this computation
+    */
+    long long BatchInvertMatrix(void *Ainv, void *A, const int n, const int batch, QudaPrecision precision);
+
+    /**
+       In-place rotation of a set of CPU vectors by a real matrix,
+       v_i <- \sum_j Q_{ji} v_j for i < n_out.  This is computed as a
+       blocked matrix product over the basis: the vectors are streamed
+       in cache-sized blocks of elements, each of which is copied into
+       a per-thread buffer before the rotated block is written back, so
+       no workspace vectors are required.  The blocks are distributed
+       over the OpenMP threads.
+       @param[in,out] v The vectors to rotate, the first n_out of which
+       are overwritten
+       @param[in] Q Rotation matrix, of dimension v.size() x n_out and
+       stored in row-major order
+       @param[in] n_out Number of rotated vectors (at most v.size())
+       @return Number of flops done in this computation
+    */
+    long long RotateVectors(std::vector<ColorSpinorField *> &v, const double *Q, const int n_out);
+
+  } // namespace hostblas
+
+} // namespace quda
@@ -8,6 +8,7 @@
 
 #include <lattice_field.h>
 #include <random_quda.h>
+#include <counter_rng.h>
 #include <fast_intdiv.h>
 
 namespace quda {
@@ -922,6 +923,15 @@ namespace quda {
     static size_t ghostFaceBytes[QUDA_MAX_DIM];
 
     private:
+    // persistent message handles for the static ghost buffers, and the
+    // message size they were declared for
+    static MsgHandle *fwdGhostSendHandle[QUDA_MAX_DIM];
+    static MsgHandle *backGhostSendHandle[QUDA_MAX_DIM];
+    static MsgHandle *fwdGhostRecvHandle[QUDA_MAX_DIM];
+    static MsgHandle *backGhostRecvHandle[QUDA_MAX_DIM];
+    static size_t ghostHandleBytes[QUDA_MAX_DIM];
+    static bool ghostExchangeActive[QUDA_MAX_DIM];
+
     //void *v; // the field elements
     //void *norm; // the normalization field
     bool init;
@@ -991,6 +1001,26 @@ namespace quda {
 		       const MemoryLocation *halo_location=nullptr, bool gdr_send=false, bool gdr_recv=false,
 		       QudaPrecision ghost_precision=QUDA_INVALID_PRECISION) const;
 
+    /**
+       @brief Start a halo exchange: pack all faces and post the
+       receives and sends of every partitioned dimension, so that all
+       messages are in flight together.  The message handles persist
+       between calls and are only redeclared when the message size
+       changes.  Sites that do not depend on the halo can be computed
+       before calling exchangeGhostWait.
+       @param[in] parity Field parity
+       @param[in] nFace Depth of halo exchange
+       @param[in] dagger Is this for a dagger operator (only relevant for spin projected Wilson)
+     */
+    void exchangeGhostStart(QudaParity parity, int nFace, int dagger) const;
+
+    /**
+       @brief Complete a halo exchange started with
+       exchangeGhostStart.  On return the ghost buffers
+       (fwdGhostFaceBuffer and backGhostFaceBuffer) hold the halo.
+     */
+    void exchangeGhostWait() const;
+
     /**
        @brief Backs up the cpuColorSpinorField
     */
@@ -1045,6 +1075,18 @@ namespace quda {
   */
   void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type);
 
+  /**
+     @brief Generate a random noise spinor on the host using the
+     counter-based generator.  The noise is keyed on the global site
+     index and spin-color component, so the field is bitwise identical
+     for any thread count and process grid.  This is used by both
+     spinorNoise variants for host fields in space-spin-color order.
+     @param src The colorspinorfield (host, space-spin-color order)
+     @param rng The counter-based generator
+     @param type The type of noise to create (QUDA_NOISE_GAUSSIAN or QUDA_NOISE_UNIFORM)
+  */
+  void spinorNoiseHost(ColorSpinorField &src, const CounterRNG &rng, QudaNoiseType type);
+
   /**
      @brief Helper function for determining if the preconditioning
      type of the fields is the same.
@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+   @file comm_mpi_common.h
+
+   MPI helpers shared by the MPI and QMP communication back ends,
+   both of which run on top of MPI.  Only compiled when one of these
+   back ends is enabled.
+ */
+
+#include <cstddef>
+#include <mpi.h>
+#include <mpi_comm_handle.h>
+
+#define MPI_CHECK(mpi_call)                                                                                            \
+  do {                                                                                                                 \
+    int status = mpi_call;                                                                                             \
+    if (status != MPI_SUCCESS) {                                                                                       \
+      char err_string[128];                                                                                            \
+      int err_len;                                                                                                     \
+      MPI_Error_string(status, err_string, &err_len);                                                                  \
+      err_string[127] = '\0';                                                                                          \
+      errorQuda("(MPI) %s", err_string);                                                                               \
+    }                                                                                                                  \
+  } while (0)
+
+/**
+   @brief Gather variable-sized buffers from all ranks to rank 0 over
+   MPI_COMM_HANDLE.  See comm_gatherv for the semantics.
+ */
+void comm_mpi_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query);
+
+/**
+   @brief Deterministic sum reduction of an array: each element is
+   converted to a binned accumulator, which are reduced with a single
+   MPI_Allreduce, so the result is bitwise identical regardless of
+   the number of processes and the reduction order
+   @param[in,out] data The array to reduce
+   @param[in] size Length of the array
+ */
+void comm_mpi_deterministic_reduce(double *data, size_t size);
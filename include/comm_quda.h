@@ -191,6 +191,24 @@ extern "C" {
    */
   void comm_gather_gpuid(int *gpuid_recv_buf);
 
+  /**
+     @brief Gather variable-length byte buffers from all processes
+     onto process 0.  This is collective and must be called by all
+     processes.
+     @param[in] send_buf Data to send from this process
+     @param[in] send_bytes Number of bytes to send from this process
+     @param[out] recv_buf Buffer on process 0 of length equal to the
+     sum of recv_bytes, that will be filled with the received data in
+     rank order (ignored on other processes)
+     @param[out] recv_bytes size_t array of length comm_size() on
+     process 0 that will be filled with the number of bytes sent from
+     each process (ignored on other processes)
+     @param[in] query If true, only recv_bytes is filled in, so that
+     process 0 can allocate recv_buf before calling again with query
+     = false
+   */
+  void comm_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query);
+
   /**
      Enabled peer-to-peer communication.
      @param hostname_buf Array that holds all process hostnames
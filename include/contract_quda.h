@@ -6,4 +6,25 @@
 namespace quda
 {
   void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, QudaContractType cType);
+
+  /**
+     @brief Momentum-projected contraction of x and y, summed over each
+     time slice.  The contraction of each site is multiplied by
+     e^{ip.x}, with p_d = 2 pi mom_d / L_d for the global spatial
+     coordinates, and summed into a global T x n_mom x 16 array, such
+     that only the time-slice sums are written rather than the
+     contraction of every site.  Supported for both host and device
+     fields.
+     @param[in] x Bra field
+     @param[in] y Ket field
+     @param[out] result Host array of global time slices x momenta x
+     16 complex doubles, result[(t * n_mom + m) * 16 + gamma]
+     @param[in] cType Contraction type, which defines the set of 16
+     spin projections (open spin elementals or Degrand-Rossi gammas)
+     @param[in] mom Momenta, with mom[3 * m + d] the integer momentum
+     of momentum m in spatial dimension d
+     @param[in] n_mom Number of momenta
+  */
+  void contractMomentumQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result,
+                            QudaContractType cType, const int *mom, int n_mom);
 } // namespace quda
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cmath>
+
+/**
+   @file counter_rng.h
+
+   Counter-based random number generation for fields.  Unlike the
+   curand states held by quda::RNG, the random numbers are a pure
+   function of (seed, stream, site, component), so fields can be
+   generated in parallel, in any order, and come out bitwise identical
+   for any thread count or process grid provided the site index is the
+   global one.
+*/
+
+namespace quda
+{
+
+  /**
+     @brief Philox4x32-10 counter-based generator (Salmon et al,
+     "Parallel random numbers: as easy as 1, 2, 3", SC'11).  The
+     128-bit counter is (site, component, stream) and the 64-bit key
+     is the seed.  Each evaluation gives 128 random bits, which we
+     use as one complex number.
+  */
+  struct CounterRNG {
+    unsigned int key[2];
+    unsigned int stream;
+
+    /**
+       @param[in] seed The seed
+       @param[in] stream Stream index, different streams give
+       independent numbers for the same seed
+    */
+    __host__ __device__ CounterRNG(unsigned long long seed, unsigned int stream = 0) :
+      key {static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)},
+      stream(stream)
+    {
+    }
+
+    /**
+       @brief Return the 128 random bits for a given site and component
+       @param[out] out The random bits
+       @param[in] site Global site index
+       @param[in] component Component index within the site
+    */
+    __host__ __device__ inline void operator()(unsigned int out[4], unsigned long long site, unsigned int component) const
+    {
+      constexpr unsigned int M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+      constexpr unsigned int W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+      unsigned int c[4] = {static_cast<unsigned int>(site), static_cast<unsigned int>(site >> 32), component, stream};
+      unsigned int k[2] = {key[0], key[1]};
+
+      for (int round = 0; round < 10; round++) {
+        if (round > 0) {
+          k[0] += W0;
+          k[1] += W1;
+        }
+        unsigned long long p0 = static_cast<unsigned long long>(M0) * c[0];
+        unsigned long long p1 = static_cast<unsigned long long>(M1) * c[2];
+        unsigned int c0 = static_cast<unsigned int>(p1 >> 32) ^ c[1] ^ k[0];
+        unsigned int c2 = static_cast<unsigned int>(p0 >> 32) ^ c[3] ^ k[1];
+        c[1] = static_cast<unsigned int>(p1);
+        c[3] = static_cast<unsigned int>(p0);
+        c[0] = c0;
+        c[2] = c2;
+      }
+
+      for (int i = 0; i < 4; i++) out[i] = c[i];
+    }
+
+    /**
+       @brief Return a pair of uniform random numbers in [0,1), each
+       with 53 random bits
+       @param[out] u0 First random number
+       @param[out] u1 Second random number
+       @param[in] site Global site index
+       @param[in] component Component index within the site
+    */
+    __host__ __device__ inline void uniform(double &u0, double &u1, unsigned long long site,
+                                            unsigned int component) const
+    {
+      constexpr double twoneg53 = 1.1102230246251565e-16;
+      unsigned int r[4];
+      (*this)(r, site, component);
+      u0 = ((static_cast<unsigned long long>(r[0] >> 5) << 26) + (r[1] >> 6)) * twoneg53;
+      u1 = ((static_cast<unsigned long long>(r[2] >> 5) << 26) + (r[3] >> 6)) * twoneg53;
+    }
+
+    /**
+       @brief Return a complex Gaussian random number with unit
+       variance, using the same Box-Muller transform as spinorNoise
+       @param[out] g0 Real part
+       @param[out] g1 Imaginary part
+       @param[in] site Global site index
+       @param[in] component Component index within the site
+    */
+    __host__ __device__ inline void gauss(double &g0, double &g1, unsigned long long site, unsigned int component) const
+    {
+      double u0, u1;
+      uniform(u0, u1, site, component);
+      double phi = 2.0 * M_PI * u0;
+      double radius = sqrt(-1.0 * log(1.0 - u1)); // 1 - u1 is in (0,1]
+      g0 = radius * cos(phi);
+      g1 = radius * sin(phi);
+    }
+  };
+
+} // namespace quda
@@ -1311,6 +1311,10 @@ public:
 	      Type() == typeid(DiracImprovedStaggered).name()) ? true : false;
     }
 
+    bool isCoarse() const {
+      return (Type() == typeid(DiracCoarse).name() || Type() == typeid(DiracCoarsePC).name()) ? true : false;
+    }
+
     const Dirac *Expose() const { return dirac; }
 
     //! Shift term added onto operator (M/M^dag M/M M^dag + shift)
@@ -586,6 +586,15 @@ namespace quda {
   private:
     void **gauge; // the actual gauge field
 
+    /** Send buffers used by exchangeGhost and injectGhost, allocated on first use */
+    void *ghost_send[2 * QUDA_MAX_DIM];
+
+    /**
+       @brief Allocate any of the send buffers not yet allocated
+       @return The send buffers
+    */
+    void **ghostSendBuffer();
+
   public:
     /**
        @brief Constructor for cpuGaugeField from a GaugeFieldParam
@@ -633,6 +642,12 @@ namespace quda {
     */
     void exchangeExtendedGhost(const int *R, TimeProfile &profile, bool no_comms_fill=false);
 
+    /**
+       @brief Free the comms buffers and message handles cached by
+       exchangeExtendedGhost
+    */
+    static void freeExtendedGhostBuffer();
+
     /**
      * Generic gauge field copy
      * @param[in] src Source from which we are copying
@@ -709,6 +724,22 @@ namespace quda {
   void copyExtendedGauge(GaugeField &out, const GaugeField &in,
 			 QudaFieldLocation location, void *Out=0, void *In=0);
 
+  /**
+     This function creates an extended device gauge field from a
+     regular device gauge field, copies the input field into its
+     interior and fills the halos.  Defined in cuda_gauge_field.cpp.
+     @param in The input field we are extending
+     @param R The radius of the extended region in each dimension
+     @param profile The profile in which the creation is timed
+     @param redundant_comms Whether to exchange the halos in
+     dimensions that are not partitioned
+     @param recon The reconstruction type (unused)
+     @return The newly allocated extended field
+  */
+  cudaGaugeField *createExtendedGauge(cudaGaugeField &in, const int *R, TimeProfile &profile,
+                                      bool redundant_comms = false,
+                                      QudaReconstructType recon = QUDA_RECONSTRUCT_INVALID);
+
   /**
      This function is used for  extracting the gauge ghost zone from a
      gauge field array.  Defined in extract_gauge_ghost.cu.
@@ -730,8 +761,16 @@ namespace quda {
      @param dim The dimension in which we are packing/unpacking
      @param ghost The array where we want to pack/unpack the ghost zone into/from
      @param extract Whether we are extracting into ghost or injecting from ghost
+     @param split_dim If non-negative, only process the part of the
+     face whose coordinate in dimension split_dim (< dim) lies in the
+     interior, or in the extended region if split_halo is set.  This
+     allows the part of the face that does not depend on the halo of
+     split_dim to be packed while that halo is being exchanged.
+     @param split_halo Whether to process the extended region or the
+     interior of split_dim
   */
-  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, void **ghost, bool extract);
+  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, void **ghost, bool extract,
+                                 int split_dim = -1, bool split_halo = false);
 
   /**
      Apply the staggered phase factor to the gauge field.
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <map>
+#include <gauge_field.h>
+
+namespace quda {
+
+  /**
+     @brief The roles in which the solvers use copies of a resident
+     gauge field
+   */
+  enum GaugeFieldRole {
+    GAUGE_FIELD_SLOPPY,       // sloppy field of mixed-precision solvers
+    GAUGE_FIELD_PRECONDITION, // preconditioner field
+    GAUGE_FIELD_REFINEMENT,   // sloppy field of the refinement solver
+    GAUGE_FIELD_EXTENDED,     // extended preconditioner field for domain decomposition
+    GAUGE_FIELD_ROLES
+  };
+
+  /**
+     @brief Manager of the copies derived from a resident (precise)
+     gauge field at other precisions, reconstructions or extensions.
+
+     The precise field itself is owned by the interface, and the
+     manager reads it through a pointer to the interface's handle, so
+     copies are always derived from the present precise field.  Each
+     role records which copy it needs, and the copy is only built the
+     first time the role is used.  Copies are cached and reference
+     counted: roles that coincide share a copy, and a role that
+     matches the precise field uses it directly.  Copies that are no
+     longer referenced are kept for reuse until the memory they hold
+     exceeds the budget, at which point the least recently used are
+     freed.  The budget is set in MiB with QUDA_GAUGE_CACHE_SIZE
+     (default 0, i.e., unreferenced copies are freed immediately).
+  */
+  class GaugeFieldManager {
+
+  public:
+    /**
+       @brief Description of a derived copy
+     */
+    struct Key {
+      QudaPrecision precision;
+      QudaReconstructType reconstruct;
+      int R[4]; // extension radius, zero for a non-extended copy
+
+      bool operator<(const Key &other) const;
+      bool operator==(const Key &other) const;
+    };
+
+  private:
+    struct Entry {
+      cudaGaugeField *field;
+      int ref_count;
+      long long last_use;
+    };
+
+    const char *name;               // name used when reporting
+    cudaGaugeField *const &source;  // the precise field
+    std::map<Key, Entry> cache;     // derived copies
+    long long clock = 0;            // counter used to order the cache by last use
+
+    Key role_key[GAUGE_FIELD_ROLES];
+    bool role_set[GAUGE_FIELD_ROLES];
+    cudaGaugeField *role_field[GAUGE_FIELD_ROLES]; // set on first use of the role
+
+    /**
+       @brief Build a derived copy from the precise field
+       @param[in] key The copy to build
+       @return The new copy
+     */
+    cudaGaugeField *build(const Key &key);
+
+    /**
+       @brief Whether a key describes the precise field itself
+     */
+    bool isSource(const Key &key) const;
+
+    /**
+       @brief Free the least recently used unreferenced copies until
+       the unreferenced copies fit in the budget
+     */
+    void evict();
+
+  public:
+    /**
+       @param[in] name Name used when reporting
+       @param[in] source Handle of the precise field
+     */
+    GaugeFieldManager(const char *name, cudaGaugeField *const &source);
+
+    ~GaugeFieldManager();
+
+    GaugeFieldManager(const GaugeFieldManager &) = delete;
+    GaugeFieldManager &operator=(const GaugeFieldManager &) = delete;
+
+    /**
+       @brief Set the copy used by a role.  Nothing is built until the
+       role is used, and any copy the role held is released.
+       @param[in] role The role
+       @param[in] precision Precision of the copy
+       @param[in] reconstruct Reconstruction of the copy
+       @param[in] R Extension radius (only for GAUGE_FIELD_EXTENDED)
+     */
+    void setRole(GaugeFieldRole role, QudaPrecision precision, QudaReconstructType reconstruct,
+                 const int *R = nullptr);
+
+    /**
+       @brief Unset a role, releasing any copy it holds
+       @param[in] role The role
+     */
+    void unsetRole(GaugeFieldRole role);
+
+    /**
+       @brief Whether a role has been set
+     */
+    bool hasRole(GaugeFieldRole role) const { return role_set[role]; }
+
+    /**
+       @brief The description of the copy used by a role
+     */
+    const Key &roleKey(GaugeFieldRole role) const { return role_key[role]; }
+
+    /**
+       @brief Return the copy used by a role, building it if this is
+       its first use
+       @param[in] role The role
+       @return The copy, or nullptr if the role is not set
+     */
+    cudaGaugeField *get(GaugeFieldRole role);
+
+    /**
+       @brief Return a derived copy, building it if needed, and take a
+       reference to it.  Every acquire must be matched by a release.
+       @param[in] key The copy
+       @return The copy
+     */
+    cudaGaugeField *acquire(const Key &key);
+
+    /**
+       @brief Drop a reference taken with acquire
+       @param[in] field The copy
+     */
+    void release(cudaGaugeField *field);
+
+    /**
+       @brief Unset all roles and free all derived copies.  This must
+       be called before the precise field is changed or freed.
+     */
+    void clear();
+
+    /**
+       @return Bytes held by the derived copies
+     */
+    size_t Bytes() const;
+
+    /**
+       @brief Print the roles and the derived copies held
+     */
+    void print() const;
+  };
+
+} // namespace quda
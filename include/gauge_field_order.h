@@ -2147,13 +2147,13 @@ namespace quda {
     */
     template <typename Float, int length> struct QDPOrder : public LegacyOrder<Float,length> {
       typedef typename mapper<Float>::type RegType;
-      Float *gauge[QUDA_MAX_DIM];
+      Float *gauge[QUDA_MAX_GEOMETRY];
       const int volumeCB;
     QDPOrder(const GaugeField &u, Float *gauge_=0, Float **ghost_=0)
       : LegacyOrder<Float,length>(u, ghost_), volumeCB(u.VolumeCB())
-	{ for (int i=0; i<4; i++) gauge[i] = gauge_ ? ((Float**)gauge_)[i] : ((Float**)u.Gauge_p())[i]; }
+	{ for (int i=0; i<this->geometry; i++) gauge[i] = gauge_ ? ((Float**)gauge_)[i] : ((Float**)u.Gauge_p())[i]; }
     QDPOrder(const QDPOrder &order) : LegacyOrder<Float,length>(order), volumeCB(order.volumeCB) {
-	for(int i=0; i<4; i++) gauge[i] = order.gauge[i];
+	for(int i=0; i<this->geometry; i++) gauge[i] = order.gauge[i];
       }
       virtual ~QDPOrder() { ; }
 
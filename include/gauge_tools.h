@@ -140,4 +140,13 @@ namespace quda
   */
   double computeQChargeDensity(const GaugeField &Fmunu, void *result);
 
+  /**
+     @brief Compute the topological charge of each time slice.  Only
+     supported for CPU fields.
+     @param[in] Fmunu The Fmunu tensor, usually calculated from a smeared configuration
+     @param[out] q_t The topological charge of each global time slice
+     @return double The total topological charge
+  */
+  double computeQChargeTimeSlice(const GaugeField &Fmunu, double *q_t);
+
 } // namespace quda
@@ -121,13 +121,33 @@ namespace quda {
     y.y += a.x*x.y;
   }
 
+  /**
+     @brief Thread-local tile holding the UV product for a single fine
+     grid site, used by the fused host coarsening so that the VUV
+     contraction reads UV from cache rather than from a fine-grid
+     temporary.  Has the same index signature as the UV field
+     accessor, with the parity and site index ignored.
+  */
+  template <typename Float, int uvSpin, int fineColor, int coarseColor>
+  struct UVTile {
+    complex<Float> *uv;
+    UVTile(complex<Float> *uv) : uv(uv) { }
+
+    __device__ __host__ inline complex<Float>& operator()(int, int, int s, int c, int ic_c)
+    { return uv[(s*fineColor + c)*coarseColor + ic_c]; }
+
+    __device__ __host__ inline const complex<Float>& operator()(int, int, int s, int c, int ic_c) const
+    { return uv[(s*fineColor + c)*coarseColor + ic_c]; }
+  };
+
   /**
      Calculates the matrix UV^{s,c'}_mu(x) = \sum_c U^{c}_mu(x) * V^{s,c}_mu(x+mu)
      Where: mu = dir, s = fine spin, c' = coarse color, c = fine color
+     The result is written to the UV accessor out.
   */
   template<bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor,
-	   int coarseSpin, int coarseColor, typename Wtype, typename Arg>
-  __device__ __host__ inline void computeUV(Arg &arg, const Wtype &W, int parity, int x_cb, int ic_c) {
+	   int coarseSpin, int coarseColor, typename Out, typename Wtype, typename Arg>
+  __device__ __host__ inline void computeUV(Arg &arg, Out &out, const Wtype &W, int parity, int x_cb, int ic_c) {
 
     int coord[4];
     getCoords(coord, x_cb, arg.x_size, parity);
@@ -186,18 +206,24 @@ namespace quda {
 
     for(int s = 0; s < uvSpin; s++) {
       for(int c = 0; c < fineColor; c++) {
-	arg.UV(parity,x_cb,s,c,ic_c) = UV[s][c];
+	out(parity,x_cb,s,c,ic_c) = UV[s][c];
       }
     }
 
 
   } // computeUV
 
+  template<bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor,
+	   int coarseSpin, int coarseColor, typename Wtype, typename Arg>
+  __device__ __host__ inline void computeUV(Arg &arg, const Wtype &W, int parity, int x_cb, int ic_c) {
+    computeUV<from_coarse,Float,dim,dir,fineSpin,fineColor,coarseSpin,coarseColor>(arg, arg.UV, W, parity, x_cb, ic_c);
+  }
+
   template<bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor, int coarseSpin, int coarseColor, typename Arg>
   void ComputeUVCPU(Arg &arg) {
 
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
 	for (int ic_c=0; ic_c < coarseColor; ic_c++) // coarse color
 	  if (dir == QUDA_FORWARDS) // only for preconditioned clover is V != AV
@@ -272,7 +298,7 @@ namespace quda {
   template <typename Float, int fineSpin, int fineColor, int coarseColor, typename Arg> void ComputeAVCPU(Arg &arg)
   {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
         for (int ch = 0; ch < 2; ch++) { // Loop over chiral blocks
 
@@ -331,7 +357,7 @@ namespace quda {
   template<typename Float, int fineSpin, int fineColor, int coarseColor, typename Arg>
   void ComputeTMAVCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
 	for (int v=0; v<coarseColor; v++) // coarse color
 	  computeTMAV<Float,fineSpin,fineColor,coarseColor,Arg>(arg, parity, x_cb, v);
@@ -402,7 +428,7 @@ namespace quda {
   {
     Float max = 0.0;
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for reduction(max:max)
+#pragma omp parallel for schedule(runtime) reduction(max:max)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
         Float max_x = computeCloverInvMax<Float, twist, Arg>(arg, parity, x_cb);
         max = max > max_x ? max : max_x;
@@ -491,7 +517,7 @@ namespace quda {
   template <typename Float, int fineSpin, int fineColor, int coarseColor, typename Arg> void ComputeTMCAVCPU(Arg &arg)
   {
     for (int parity = 0; parity < 2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
         for (int ch = 0; ch < 2; ch++) {
           for (int ic_c = 0; ic_c < coarseColor; ic_c++) { // coarse color
@@ -530,11 +556,12 @@ namespace quda {
 
      @param[out] vuv Result array
      @param[in,out] arg Arg storing the fields and parameters
+     @param[in] UV Accessor for the UV product
      @param[in] Fine grid parity we're working on
      @param[in] x_cb Checkboarded x dimension
    */
-  template <bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor, int coarseSpin, int coarseColor, typename Arg, typename Gamma>
-  __device__ __host__ inline void multiplyVUV(complex<Float> vuv[], const Arg &arg, const Gamma &gamma, int parity, int x_cb, int ic_c, int jc_c) {
+  template <bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor, int coarseSpin, int coarseColor, typename Arg, typename UVtype, typename Gamma>
+  __device__ __host__ inline void multiplyVUV(complex<Float> vuv[], const Arg &arg, const UVtype &UV_, const Gamma &gamma, int parity, int x_cb, int ic_c, int jc_c) {
 
 #pragma unroll
     for (int i=0; i<coarseSpin*coarseSpin; i++) vuv[i] = 0.0;
@@ -565,18 +592,18 @@ namespace quda {
 
             // here UV is really UAV
 	    //Diagonal Spin
-	    caxpy(conj(V), arg.UV(parity, x_cb, s, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_row]);
+	    caxpy(conj(V), UV_(parity, x_cb, s, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_row]);
 
 	    //Off-diagonal Spin (backward link / positive projector applied)
-            caxpy( gamma.apply(s, conj(V)), arg.UV(parity, x_cb, s_col, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_col]);
+            caxpy( gamma.apply(s, conj(V)), UV_(parity, x_cb, s_col, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_col]);
 	  } else {
             complex<Float> AV = arg.AV(parity, x_cb, s, ic, ic_c);
 
             //Diagonal Spin
-	    caxpy(conj(AV), arg.UV(parity, x_cb, s, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_row]);
+	    caxpy(conj(AV), UV_(parity, x_cb, s, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_row]);
 
 	    //Off-diagonal Spin (forward link / negative projector applied)
-	    caxpy( -gamma.apply(s, conj(AV)), arg.UV(parity, x_cb, s_col, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_col]);
+	    caxpy( -gamma.apply(s, conj(AV)), UV_(parity, x_cb, s_col, ic, jc_c), vuv[s_c_row*coarseSpin+s_c_col]);
 	  }
 	} //Fine color
       }
@@ -590,7 +617,7 @@ namespace quda {
           complex<Float> AV = arg.AV(parity, x_cb, s, ic, ic_c);
 #pragma unroll
           for (int s_col=0; s_col<fineSpin; s_col++) { // which chiral block
-            complex<Float> UV = arg.UV(parity, x_cb, s_col*fineSpin+s, ic, jc_c);
+            complex<Float> UV = UV_(parity, x_cb, s_col*fineSpin+s, ic, jc_c);
             caxpy(conj(AV), UV, vuv[s*coarseSpin+s_col]);
           } //Fine color
         } //Fine spin
@@ -600,6 +627,11 @@ namespace quda {
 
   }
 
+  template <bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor, int coarseSpin, int coarseColor, typename Arg, typename Gamma>
+  __device__ __host__ inline void multiplyVUV(complex<Float> vuv[], const Arg &arg, const Gamma &gamma, int parity, int x_cb, int ic_c, int jc_c) {
+    multiplyVUV<from_coarse,Float,dim,dir,fineSpin,fineColor,coarseSpin,coarseColor>(vuv, arg, arg.UV, gamma, parity, x_cb, ic_c, jc_c);
+  }
+
   template<typename Arg>
   __device__ __host__ inline int virtualThreadIdx(const Arg &arg) {
     constexpr int warp_size = 32;
@@ -783,7 +815,7 @@ namespace quda {
     constexpr bool parity_flip = true;
 
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) { // Loop over fine volume
 	for (int c_row=0; c_row<coarseColor; c_row++)
 	  for (int c_col=0; c_col<coarseColor; c_col++)
@@ -792,6 +824,97 @@ namespace quda {
     } // parity
   }
 
+  /**
+     @brief Fused host computation of UV and VUV for a given dimension
+     and direction.  Work is distributed over the aggregates: for each
+     fine-grid site in an aggregate the UV product is formed in a
+     thread-local tile and immediately contracted with V, with the
+     result accumulated into thread-private coarse Y / X blocks that
+     are written back once the aggregate is complete.  Since each
+     coarse site is owned by a single thread no atomics are required,
+     and the fine-grid UV temporary is never formed.
+  */
+  template<bool from_coarse, typename Float, int dim, QudaDirection dir, int fineSpin, int fineColor, int coarseSpin, int coarseColor, typename Arg>
+  void ComputeUVVUVCPU(Arg &arg) {
+
+    Gamma<Float, QUDA_DEGRAND_ROSSI_GAMMA_BASIS, dim> gamma;
+    constexpr int uvSpin = fineSpin * (from_coarse ? 2 : 1);
+    constexpr int blockSize = coarseSpin*coarseSpin*coarseColor*coarseColor;
+
+    const int dim_index = arg.dim_index % arg.Y_atomic.geometry;
+    const int aggregate_size = arg.fineVolumeCB / arg.coarseVolumeCB; // fine sites per aggregate (both parities)
+
+#pragma omp parallel
+    {
+      std::vector<complex<Float> > uv(uvSpin*fineColor*coarseColor);
+      std::vector<complex<Float> > Y(blockSize);
+      std::vector<complex<Float> > X(blockSize);
+      UVTile<Float,uvSpin,fineColor,coarseColor> UV(uv.data());
+
+#pragma omp for schedule(runtime)
+      for (int x_coarse=0; x_coarse<2*arg.coarseVolumeCB; x_coarse++) {
+
+        for (int i=0; i<blockSize; i++) Y[i] = static_cast<Float>(0.0);
+        for (int i=0; i<blockSize; i++) X[i] = static_cast<Float>(0.0);
+
+        // coarse_to_fine is ordered as (aggregate, parity-ordered fine index)
+        for (int i=0; i<aggregate_size; i++) {
+          const int x_fine = arg.coarse_to_fine[x_coarse*aggregate_size + i];
+          const int parity = x_fine >= arg.fineVolumeCB ? 1 : 0;
+          const int x_cb = x_fine - parity*arg.fineVolumeCB;
+
+          for (int ic_c=0; ic_c<coarseColor; ic_c++) {
+            if (dir == QUDA_FORWARDS) // only for preconditioned clover is V != AV
+              computeUV<from_coarse,Float,dim,dir,fineSpin,fineColor,coarseSpin,coarseColor>(arg, UV, arg.V, parity, x_cb, ic_c);
+            else
+              computeUV<from_coarse,Float,dim,dir,fineSpin,fineColor,coarseSpin,coarseColor>(arg, UV, arg.AV, parity, x_cb, ic_c);
+          }
+
+          //Check to see if we are on the edge of a block.  If adjacent site
+          //is in same block, M = X, else M = Y
+          int coord[QUDA_MAX_DIM];
+          getCoords(coord, x_cb, arg.x_size, parity);
+          const bool isDiagonal = ((coord[dim]+1)%arg.x_size[dim])/arg.geo_bs[dim] == coord[dim]/arg.geo_bs[dim] ? true : false;
+          std::vector<complex<Float> > &M = isDiagonal ? X : Y;
+
+          for (int c_row=0; c_row<coarseColor; c_row++) {
+            for (int c_col=0; c_col<coarseColor; c_col++) {
+              complex<Float> vuv[coarseSpin*coarseSpin];
+              multiplyVUV<from_coarse,Float,dim,dir,fineSpin,fineColor,coarseSpin,coarseColor>(vuv, arg, UV, gamma, parity, x_cb, c_row, c_col);
+              for (int s_row=0; s_row<coarseSpin; s_row++)
+                for (int s_col=0; s_col<coarseSpin; s_col++)
+                  M[((s_row*coarseSpin+s_col)*coarseColor+c_row)*coarseColor+c_col] += vuv[s_row*coarseSpin+s_col];
+            }
+          }
+        } // fine sites in aggregate
+
+        const int coarse_parity = x_coarse >= arg.coarseVolumeCB ? 1 : 0;
+        const int coarse_x_cb = x_coarse - coarse_parity*arg.coarseVolumeCB;
+
+        for (int s_row=0; s_row<coarseSpin; s_row++) {
+          for (int s_col=0; s_col<coarseSpin; s_col++) {
+            for (int c_row=0; c_row<coarseColor; c_row++) {
+              for (int c_col=0; c_col<coarseColor; c_col++) {
+                const int idx = ((s_row*coarseSpin+s_col)*coarseColor+c_row)*coarseColor+c_col;
+                arg.Y_atomic(dim_index,coarse_parity,coarse_x_cb,s_row,s_col,c_row,c_col) += Y[idx];
+
+                const complex<Float> x = -arg.kappa * X[idx];
+                if (dir == QUDA_BACKWARDS) arg.X_atomic(0,coarse_parity,coarse_x_cb,s_col,s_row,c_col,c_row) += conj(x);
+                else arg.X_atomic(0,coarse_parity,coarse_x_cb,s_row,s_col,c_row,c_col) += x;
+
+                if (!arg.bidirectional) {
+                  const Float sign = (s_row == s_col) ? static_cast<Float>(1.0) : static_cast<Float>(-1.0);
+                  arg.X_atomic(0,coarse_parity,coarse_x_cb,s_row,s_col,c_row,c_col) += sign*x;
+                }
+              }
+            }
+          }
+        }
+
+      } // aggregates
+    } // omp parallel
+  }
+
   // compute indices for shared-atomic kernel
   template <bool parity_flip, typename Arg>
   __device__ inline void getIndicesShared(const Arg &arg, int &parity, int &x_cb, int &parity_coarse, int &x_coarse_cb, int &c_col, int &c_row) {
@@ -897,7 +1020,7 @@ namespace quda {
   template<typename Float, int nSpin, int nColor, typename Arg>
   void ComputeYReverseCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.coarseVolumeCB; x_cb++) {
 	for (int ic_c = 0; ic_c < nColor; ic_c++) { //Color row
 	  for (int jc_c = 0; jc_c < nColor; jc_c++) { //Color col
@@ -987,7 +1110,7 @@ namespace quda {
   template <bool from_coarse, typename Float, int fineSpin, int coarseSpin, int fineColor, int coarseColor, typename Arg>
   void ComputeCoarseCloverCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
         for (int jc_c=0; jc_c<coarseColor; jc_c++) {
           for (int ic_c=0; ic_c<coarseColor; ic_c++) {
@@ -1019,7 +1142,7 @@ namespace quda {
   template<typename Float, int nSpin, int nColor, typename Arg>
   void AddCoarseDiagonalCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.coarseVolumeCB; x_cb++) {
         for(int s = 0; s < nSpin; s++) { //Spin
          for(int c = 0; c < nColor; c++) { //Color
@@ -1052,7 +1175,7 @@ namespace quda {
     const complex<Float> mu(0., arg.mu*arg.mu_factor);
 
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.coarseVolumeCB; x_cb++) {
 	for(int s = 0; s < nSpin/2; s++) { //Spin
           for(int c = 0; c < nColor; c++) { //Color
@@ -1132,7 +1255,7 @@ namespace quda {
   template<typename Float, int nSpin, int nColor, typename Arg>
   void ConvertCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.coarseVolumeCB; x_cb++) {
 	for(int c_row = 0; c_row < nColor; c_row++) { //Color row
 	  for(int c_col = 0; c_col < nColor; c_col++) { //Color column
@@ -1180,7 +1303,7 @@ namespace quda {
   template<typename Float, int nSpin, int nColor, typename Arg>
   void RescaleYCPU(Arg &arg) {
     for (int parity=0; parity<2; parity++) {
-#pragma omp parallel for
+#pragma omp parallel for schedule(runtime)
       for (int x_cb=0; x_cb<arg.coarseVolumeCB; x_cb++) {
 	for(int c_row = 0; c_row < nColor; c_row++) { //Color row
 	  for(int c_col = 0; c_col < nColor; c_col++) { //Color column
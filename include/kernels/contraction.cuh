@@ -5,21 +5,22 @@
 #include <quda_matrix.h>
 #include <matrix_field.h>
 #include <su3_project.cuh>
+#include <cub_helper.cuh>
+#include <vector>
 
 namespace quda
 {
 
-  template <typename real> struct ContractionArg {
+  template <typename real, typename F_ = typename colorspinor_mapper<real, 4, 3, true, false>::type>
+  struct ContractionArg {
     int threads; // number of active threads required
     int X[4];    // grid dimensions
 
     static constexpr int nSpin = 4;
     static constexpr int nColor = 3;
-    static constexpr bool spin_project = true;
-    static constexpr bool spinor_direct_load = false; // false means texture load
 
     // Create a typename F for the ColorSpinorField (F for fermion)
-    typedef typename colorspinor_mapper<real, nSpin, nColor, spin_project, spinor_direct_load>::type F;
+    typedef F_ F;
 
     F x;
     F y;
@@ -35,12 +36,17 @@ namespace quda
     }
   };
 
-  template <typename real, typename Arg> __global__ void computeColorContraction(Arg arg)
+  /**
+     @brief Compute the color contraction of x and y at a given site,
+     i.e., the 16 spin elementals <x(x)_mu | y(x)_nu>
+     @param[in] arg Kernel argument
+     @param[in] x_cb Checkerboard site index
+     @param[in] parity Site parity
+     @return The spin elementals
+  */
+  template <typename real, typename Arg>
+  __device__ __host__ inline Matrix<complex<real>, Arg::nSpin> colorContract(const Arg &arg, int x_cb, int parity)
   {
-    int x_cb = threadIdx.x + blockIdx.x * blockDim.x;
-    int parity = threadIdx.y + blockIdx.y * blockDim.y;
-    if (x_cb >= arg.threads) return;
-
     constexpr int nSpin = Arg::nSpin;
     constexpr int nColor = Arg::nColor;
     typedef ColorSpinor<real, nColor, nSpin> Vector;
@@ -58,35 +64,22 @@ namespace quda
         A(mu, nu) = innerProduct(x, y, mu, nu);
       }
     }
-
-    arg.s.save(A, x_cb, parity);
+    return A;
   }
 
-  template <typename real, typename Arg> __global__ void computeDegrandRossiContraction(Arg arg)
+  /**
+     @brief Apply the 16 Degrand-Rossi gamma insertions to the spin
+     elementals of a site
+     @param[in] spin_elem The spin elementals <x_mu | y_nu>
+     @return The 16 gamma projections, laid out as defined in enum_quda.h
+  */
+  template <typename real, int nSpin>
+  __device__ __host__ inline Matrix<complex<real>, nSpin> degrandRossiContract(const Matrix<complex<real>, nSpin> &spin_elem)
   {
-    int x_cb = threadIdx.x + blockIdx.x * blockDim.x;
-    int parity = threadIdx.y + blockIdx.y * blockDim.y;
-    const int nSpin = arg.nSpin;
-    const int nColor = arg.nColor;
-
-    if (x_cb >= arg.threads) return;
-
-    typedef ColorSpinor<real, nColor, nSpin> Vector;
-
-    Vector x = arg.x(x_cb, parity);
-    Vector y = arg.y(x_cb, parity);
-
     complex<real> I(0.0, 1.0);
-    complex<real> spin_elem[nSpin][nSpin];
     complex<real> result_local(0.0, 0.0);
+    Matrix<complex<real>, nSpin> A;
 
-    // Color contract: <\phi(x)_{\mu} | \phi(y)_{\nu}>
-    // The Bra is conjugated
-    for (int mu = 0; mu < nSpin; mu++) {
-      for (int nu = 0; nu < nSpin; nu++) { spin_elem[mu][nu] = innerProduct(x, y, mu, nu); }
-    }
-
-    complex<real> A[nSpin * nSpin];
 
     // Spin contract: <\phi(x)_{\mu} \Gamma_{mu,nu}^{rho,tau} \phi(y)_{\nu}>
     // The rho index runs slowest.
@@ -98,137 +91,300 @@ namespace quda
     // SCALAR
     // G_idx = 0: I
     result_local = 0.0;
-    result_local += spin_elem[0][0];
-    result_local += spin_elem[1][1];
-    result_local += spin_elem[2][2];
-    result_local += spin_elem[3][3];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 0);
+    result_local += spin_elem(1, 1);
+    result_local += spin_elem(2, 2);
+    result_local += spin_elem(3, 3);
+    A.data[G_idx++] = result_local;
 
     // VECTORS
     // G_idx = 1: \gamma_1
     result_local = 0.0;
-    result_local += I * spin_elem[0][3];
-    result_local += I * spin_elem[1][2];
-    result_local -= I * spin_elem[2][1];
-    result_local -= I * spin_elem[3][0];
-    A[G_idx++] = result_local;
+    result_local += I * spin_elem(0, 3);
+    result_local += I * spin_elem(1, 2);
+    result_local -= I * spin_elem(2, 1);
+    result_local -= I * spin_elem(3, 0);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 2: \gamma_2
     result_local = 0.0;
-    result_local -= spin_elem[0][3];
-    result_local += spin_elem[1][2];
-    result_local += spin_elem[2][1];
-    result_local -= spin_elem[3][0];
-    A[G_idx++] = result_local;
+    result_local -= spin_elem(0, 3);
+    result_local += spin_elem(1, 2);
+    result_local += spin_elem(2, 1);
+    result_local -= spin_elem(3, 0);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 3: \gamma_3
     result_local = 0.0;
-    result_local += I * spin_elem[0][2];
-    result_local -= I * spin_elem[1][3];
-    result_local -= I * spin_elem[2][0];
-    result_local += I * spin_elem[3][1];
-    A[G_idx++] = result_local;
+    result_local += I * spin_elem(0, 2);
+    result_local -= I * spin_elem(1, 3);
+    result_local -= I * spin_elem(2, 0);
+    result_local += I * spin_elem(3, 1);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 4: \gamma_4
     result_local = 0.0;
-    result_local += spin_elem[0][2];
-    result_local += spin_elem[1][3];
-    result_local += spin_elem[2][0];
-    result_local += spin_elem[3][1];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 2);
+    result_local += spin_elem(1, 3);
+    result_local += spin_elem(2, 0);
+    result_local += spin_elem(3, 1);
+    A.data[G_idx++] = result_local;
 
     // PSEUDO-SCALAR
     // G_idx = 5: \gamma_5
     result_local = 0.0;
-    result_local += spin_elem[0][0];
-    result_local += spin_elem[1][1];
-    result_local -= spin_elem[2][2];
-    result_local -= spin_elem[3][3];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 0);
+    result_local += spin_elem(1, 1);
+    result_local -= spin_elem(2, 2);
+    result_local -= spin_elem(3, 3);
+    A.data[G_idx++] = result_local;
 
     // PSEUDO-VECTORS
     // DMH: Careful here... we may wish to use  \gamma_1,2,3,4\gamma_5 for pseudovectors
     // G_idx = 6: \gamma_5\gamma_1
     result_local = 0.0;
-    result_local += I * spin_elem[0][3];
-    result_local += I * spin_elem[1][2];
-    result_local += I * spin_elem[2][1];
-    result_local += I * spin_elem[3][0];
-    A[G_idx++] = result_local;
+    result_local += I * spin_elem(0, 3);
+    result_local += I * spin_elem(1, 2);
+    result_local += I * spin_elem(2, 1);
+    result_local += I * spin_elem(3, 0);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 7: \gamma_5\gamma_2
     result_local = 0.0;
-    result_local -= spin_elem[0][3];
-    result_local += spin_elem[1][2];
-    result_local -= spin_elem[2][1];
-    result_local += spin_elem[3][0];
-    A[G_idx++] = result_local;
+    result_local -= spin_elem(0, 3);
+    result_local += spin_elem(1, 2);
+    result_local -= spin_elem(2, 1);
+    result_local += spin_elem(3, 0);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 8: \gamma_5\gamma_3
     result_local = 0.0;
-    result_local += I * spin_elem[0][2];
-    result_local -= I * spin_elem[1][3];
-    result_local += I * spin_elem[2][0];
-    result_local -= I * spin_elem[3][1];
-    A[G_idx++] = result_local;
+    result_local += I * spin_elem(0, 2);
+    result_local -= I * spin_elem(1, 3);
+    result_local += I * spin_elem(2, 0);
+    result_local -= I * spin_elem(3, 1);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 9: \gamma_5\gamma_4
     result_local = 0.0;
-    result_local += spin_elem[0][2];
-    result_local += spin_elem[1][3];
-    result_local -= spin_elem[2][0];
-    result_local -= spin_elem[3][1];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 2);
+    result_local += spin_elem(1, 3);
+    result_local -= spin_elem(2, 0);
+    result_local -= spin_elem(3, 1);
+    A.data[G_idx++] = result_local;
 
     // TENSORS
     // G_idx = 10: (i/2) * [\gamma_1, \gamma_2]
     result_local = 0.0;
-    result_local += spin_elem[0][0];
-    result_local -= spin_elem[1][1];
-    result_local += spin_elem[2][2];
-    result_local -= spin_elem[3][3];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 0);
+    result_local -= spin_elem(1, 1);
+    result_local += spin_elem(2, 2);
+    result_local -= spin_elem(3, 3);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 11: (i/2) * [\gamma_1, \gamma_3]
     result_local = 0.0;
-    result_local -= I * spin_elem[0][2];
-    result_local -= I * spin_elem[1][3];
-    result_local += I * spin_elem[2][0];
-    result_local += I * spin_elem[3][1];
-    A[G_idx++] = result_local;
+    result_local -= I * spin_elem(0, 2);
+    result_local -= I * spin_elem(1, 3);
+    result_local += I * spin_elem(2, 0);
+    result_local += I * spin_elem(3, 1);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 12: (i/2) * [\gamma_1, \gamma_4]
     result_local = 0.0;
-    result_local -= spin_elem[0][1];
-    result_local -= spin_elem[1][0];
-    result_local += spin_elem[2][3];
-    result_local += spin_elem[3][2];
-    A[G_idx++] = result_local;
+    result_local -= spin_elem(0, 1);
+    result_local -= spin_elem(1, 0);
+    result_local += spin_elem(2, 3);
+    result_local += spin_elem(3, 2);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 13: (i/2) * [\gamma_2, \gamma_3]
     result_local = 0.0;
-    result_local += spin_elem[0][1];
-    result_local += spin_elem[1][0];
-    result_local += spin_elem[2][3];
-    result_local += spin_elem[3][2];
-    A[G_idx++] = result_local;
+    result_local += spin_elem(0, 1);
+    result_local += spin_elem(1, 0);
+    result_local += spin_elem(2, 3);
+    result_local += spin_elem(3, 2);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 14: (i/2) * [\gamma_2, \gamma_4]
     result_local = 0.0;
-    result_local -= I * spin_elem[0][1];
-    result_local += I * spin_elem[1][0];
-    result_local += I * spin_elem[2][3];
-    result_local -= I * spin_elem[3][2];
-    A[G_idx++] = result_local;
+    result_local -= I * spin_elem(0, 1);
+    result_local += I * spin_elem(1, 0);
+    result_local += I * spin_elem(2, 3);
+    result_local -= I * spin_elem(3, 2);
+    A.data[G_idx++] = result_local;
 
     // G_idx = 15: (i/2) * [\gamma_3, \gamma_4]
     result_local = 0.0;
-    result_local -= spin_elem[0][0];
-    result_local -= spin_elem[1][1];
-    result_local += spin_elem[2][2];
-    result_local += spin_elem[3][3];
-    A[G_idx++] = result_local;
+    result_local -= spin_elem(0, 0);
+    result_local -= spin_elem(1, 1);
+    result_local += spin_elem(2, 2);
+    result_local += spin_elem(3, 3);
+    A.data[G_idx++] = result_local;
+
+    return A;
+  }
+
+  /**
+     @brief Compute the contraction of a site for the given
+     contraction type
+  */
+  template <typename real, typename Arg>
+  __device__ __host__ inline Matrix<complex<real>, Arg::nSpin> contractSite(const Arg &arg, int x_cb, int parity,
+                                                                             QudaContractType cType)
+  {
+    auto A = colorContract<real>(arg, x_cb, parity);
+    return cType == QUDA_CONTRACT_TYPE_DR ? degrandRossiContract(A) : A;
+  }
+
+  template <typename real, typename Arg> __global__ void computeColorContraction(Arg arg)
+  {
+    int x_cb = threadIdx.x + blockIdx.x * blockDim.x;
+    int parity = threadIdx.y + blockIdx.y * blockDim.y;
+    if (x_cb >= arg.threads) return;
+
+    arg.s.save(colorContract<real>(arg, x_cb, parity), x_cb, parity);
+  }
+
+  template <typename real, typename Arg> __global__ void computeDegrandRossiContraction(Arg arg)
+  {
+    int x_cb = threadIdx.x + blockIdx.x * blockDim.x;
+    int parity = threadIdx.y + blockIdx.y * blockDim.y;
+    if (x_cb >= arg.threads) return;
+
+    arg.s.save(degrandRossiContract(colorContract<real>(arg, x_cb, parity)), x_cb, parity);
+  }
+
+  /**
+     @brief Host contraction of all sites, writing the 16 spin
+     projections of each site
+  */
+  template <typename real, typename Arg> void computeContractionCPU(Arg &arg, QudaContractType cType)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int x_cb = 0; x_cb < arg.threads; x_cb++) {
+        arg.s.save(contractSite<real>(arg, x_cb, parity, cType), x_cb, parity);
+      }
+    }
+  }
+
+  /**
+     Argument for the momentum-projected contraction, where the
+     contraction of each site is multiplied by the phase e^{ip.x} and
+     summed over each time slice.  The phases factorize over the
+     spatial dimensions, so we only store the phase of each momentum
+     for each coordinate in each dimension, with the phase of
+     coordinate x_d of momentum m at phase[m * phase_stride +
+     phase_offset[d] + x_d].
+  */
+  template <typename real, typename F_ = typename colorspinor_mapper<real, 4, 3, true, false>::type>
+  struct ContractionProjectArg : ContractionArg<real, F_> {
+    int n_mom;                    // number of momenta
+    int phase_stride;             // phase table length per momentum
+    int phase_offset[3];          // offset of each dimension in the phase table
+    const complex<double> *phase; // phase table
+    complex<double> *result;      // result[(t * n_mom + m) * 16 + gamma]
+
+    ContractionProjectArg(const ColorSpinorField &x, const ColorSpinorField &y, complex<real> *s, int n_mom,
+                          const complex<double> *phase, complex<double> *result) :
+      ContractionArg<real, F_>(x, y, s),
+      n_mom(n_mom),
+      phase_stride(x.X(0) + x.X(1) + x.X(2)),
+      phase(phase),
+      result(result)
+    {
+      phase_offset[0] = 0;
+      phase_offset[1] = x.X(0);
+      phase_offset[2] = x.X(0) + x.X(1);
+    }
+  };
+
+  /**
+     @brief The phase of momentum m at the local spatial coordinate x
+  */
+  template <typename Arg> __device__ __host__ inline complex<double> momentumPhase(const Arg &arg, int m, const int x[])
+  {
+    const complex<double> *phase = arg.phase + m * arg.phase_stride;
+    return phase[arg.phase_offset[0] + x[0]] * phase[arg.phase_offset[1] + x[1]] * phase[arg.phase_offset[2] + x[2]];
+  }
 
-    arg.s.save(A, x_cb, parity);
+  /**
+     @brief Project the site contractions onto momentum, with one
+     block per (time slice, momentum) that strides over the spatial
+     sites of the slice.  The site contractions are read from arg.s.
+  */
+  template <int block_size, typename real, typename Arg> __global__ void computeMomentumProjection(Arg arg)
+  {
+    const int t = blockIdx.x;
+    const int m = blockIdx.y;
+    const int vs = arg.X[0] * arg.X[1] * arg.X[2];
+    constexpr int nSpin = Arg::nSpin;
+    typedef vector_type<complex<double>, nSpin * nSpin> vector;
+
+    vector sum;
+    for (int s = threadIdx.x; s < vs; s += block_size) {
+      int x[4] = {s % arg.X[0], (s / arg.X[0]) % arg.X[1], s / (arg.X[0] * arg.X[1]), t};
+      int parity = (x[0] + x[1] + x[2] + x[3]) & 1;
+      int x_cb = (t * vs + s) >> 1;
+
+      Matrix<complex<real>, nSpin> A;
+      arg.s.load(A, x_cb, parity);
+      complex<double> phase = momentumPhase(arg, m, x);
+#pragma unroll
+      for (int g = 0; g < nSpin * nSpin; g++) sum[g] += phase * complex<double>(A.data[g].real(), A.data[g].imag());
+    }
+
+    typedef cub::BlockReduce<vector, block_size, cub::BLOCK_REDUCE_WARP_REDUCTIONS> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    sum = BlockReduce(temp_storage).Sum(sum);
+
+    if (threadIdx.x == 0) {
+      for (int g = 0; g < nSpin * nSpin; g++) arg.result[(t * arg.n_mom + m) * nSpin * nSpin + g] = sum[g];
+    }
   }
+
+  /**
+     @brief Host momentum-projected contraction.  Each site is
+     contracted once and accumulated into all momenta, such that the
+     site contractions are never stored.  The sites of each (time
+     slice, parity) pair are summed into their own partial, with the
+     parities then summed in order, so the result does not depend on
+     the number of threads.
+  */
+  template <typename real, typename Arg> void computeProjectedContractionCPU(Arg &arg, QudaContractType cType)
+  {
+    constexpr int nSpin = Arg::nSpin;
+    constexpr int n_gamma = nSpin * nSpin;
+    const int nt = arg.X[3];
+    const int slice_cb = arg.threads / nt; // checkerboard sites per time slice
+    const int n_out = arg.n_mom * n_gamma;
+    std::vector<complex<double>> partial(2 * nt * n_out);
+
+#pragma omp parallel for schedule(static)
+    for (int slice = 0; slice < 2 * nt; slice++) {
+      const int parity = slice % 2;
+      complex<double> *sum = &partial[slice * n_out];
+      for (int i = 0; i < n_out; i++) sum[i] = 0.0;
+
+      for (int x_cb = (slice / 2) * slice_cb; x_cb < (slice / 2 + 1) * slice_cb; x_cb++) {
+        auto A = contractSite<real>(arg, x_cb, parity, cType);
+        complex<double> a[n_gamma];
+        for (int g = 0; g < n_gamma; g++) a[g] = complex<double>(A.data[g].real(), A.data[g].imag());
+
+        int x[4];
+        getCoords(x, x_cb, arg.X, parity);
+        for (int m = 0; m < arg.n_mom; m++) {
+          complex<double> phase = momentumPhase(arg, m, x);
+          for (int g = 0; g < n_gamma; g++) sum[m * n_gamma + g] += phase * a[g];
+        }
+      }
+    }
+
+    for (int t = 0; t < nt; t++) {
+      for (int i = 0; i < n_out; i++)
+        arg.result[t * n_out + i] = partial[(2 * t) * n_out + i] + partial[(2 * t + 1) * n_out + i];
+    }
+  }
+
 } // namespace quda
@@ -25,17 +25,41 @@ namespace quda {
   };
 
   /**
-     Generic CPU gauge reordering and packing
+     Number of checkerboard sites in each tile of the CPU reordering
+     loops.  Within a tile the direction loop is outermost, so for the
+     direction-major orders (QDP, FloatN) each thread streams over a
+     contiguous run of sites in every direction, while for the
+     site-major orders (MILC, CPS, BQCD) the tile is one contiguous run.
+  */
+  constexpr int copy_tile_size = 32;
+
+  /**
+     @return The number of tiles the CPU reordering loops run over
+   */
+  template <typename Arg> inline int copyTiles(const Arg &arg)
+  {
+    return 2 * ((arg.volume / 2 + copy_tile_size - 1) / copy_tile_size);
+  }
+
+  /**
+     Generic CPU gauge reordering and packing, threaded over tiles of
+     sites of both parities.
   */
   template <typename FloatOut, typename FloatIn, int length, typename Arg>
   void copyGauge(Arg &arg) {
     typedef typename mapper<FloatIn>::type RegTypeIn;
     typedef typename mapper<FloatOut>::type RegTypeOut;
+    const int volumeCB = arg.volume / 2;
+    const int n_tile = copyTiles(arg) / 2;
 
-    for (int parity=0; parity<2; parity++) {
+#pragma omp parallel for schedule(runtime)
+    for (int tile = 0; tile < 2 * n_tile; tile++) {
+      const int parity = tile / n_tile;
+      const int x_begin = (tile - parity * n_tile) * copy_tile_size;
+      const int x_end = x_begin + copy_tile_size < volumeCB ? x_begin + copy_tile_size : volumeCB;
 
       for (int d=0; d<arg.geometry; d++) {
-	for (int x=0; x<arg.volume/2; x++) {
+	for (int x=x_begin; x<x_end; x++) {
 #ifdef FINE_GRAINED_ACCESS
 	  for (int i=0; i<Ncolor(length); i++)
 	    for (int j=0; j<Ncolor(length); j++) {
@@ -55,16 +79,39 @@ namespace quda {
   }
 
   /**
-     Check whether the field contains Nans
+     Check whether the field contains Nans.  The threaded scan only
+     detects them, with the offending element then located serially.
   */
   template <typename Float, int length, typename Arg>
   void checkNan(Arg &arg) {
     typedef typename mapper<Float>::type RegType;
+    const int volumeCB = arg.volume / 2;
+    bool nan = false;
+
+#pragma omp parallel for schedule(static) reduction(||:nan)
+    for (int x_parity = 0; x_parity < 2 * volumeCB; x_parity++) {
+      const int parity = x_parity / volumeCB;
+      const int x = x_parity - parity * volumeCB;
+      for (int d=0; d<arg.geometry; d++) {
+#ifdef FINE_GRAINED_ACCESS
+	for (int i=0; i<Ncolor(length); i++)
+	  for (int j=0; j<Ncolor(length); j++) {
+            complex<Float> u = arg.in(d, parity, x, i, j);
+	    nan = nan || isnan(u.real()) || isnan(u.imag());
+	  }
+#else
+	RegType u[length];
+	arg.in.load(u, x, d, parity);
+	for (int i=0; i<length; i++) nan = nan || isnan(u[i]);
+#endif
+      }
+    }
+    if (!nan) return;
 
     for (int parity=0; parity<2; parity++) {
 
       for (int d=0; d<arg.geometry; d++) {
-	for (int x=0; x<arg.volume/2; x++) {
+	for (int x=0; x<volumeCB; x++) {
 #ifdef FINE_GRAINED_ACCESS
 	  for (int i=0; i<Ncolor(length); i++)
 	    for (int j=0; j<Ncolor(length); j++) {
@@ -118,7 +165,8 @@ namespace quda {
   }
 
   /**
-     Generic CPU gauge ghost reordering and packing
+     Generic CPU gauge ghost reordering and packing, threaded over the
+     sites of each face
   */
   template <typename FloatOut, typename FloatIn, int length, typename Arg>
   void copyGhost(Arg &arg) {
@@ -128,6 +176,7 @@ namespace quda {
     for (int parity=0; parity<2; parity++) {
 
       for (int d=0; d<arg.nDim; d++) {
+#pragma omp parallel for schedule(runtime)
         for (int x=0; x<arg.faceVolumeCB[d]; x++) {
 #ifdef FINE_GRAINED_ACCESS
           for (int i=0; i<Ncolor(length); i++)
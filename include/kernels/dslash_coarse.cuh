@@ -347,33 +347,155 @@ namespace quda {
 
   }
 
-  // CPU kernel for applying the coarse Dslash to a vector
+  /**
+     Number of right-hand sides the CPU coarse dslash processes
+     together.  Each link matrix is streamed once per block of
+     sources, turning the per-site matrix-vector products into a small
+     matrix-matrix product.
+  */
+  constexpr int coarse_dslash_src_block = 8;
+
+  /**
+     Applies the coarse dslash and/or clover term on a given parity and
+     checkerboard site index, for a block of sources.  Used by the CPU
+     variant, with each thread computing all spin-color rows of a site.
+
+     @param arg Kernel argument struct
+     @param parity The site parity
+     @param x_cb The checkerboarded site index
+     @param src_begin The first source index of the block
+     @param n_src The number of sources in the block
+   */
+  template <typename Float, int nDim, int Ns, int Nc, bool dslash, bool clover, bool dagger, DslashType type, typename Arg>
+  inline void coarseDslashSite(Arg &arg, int parity, int x_cb, int src_begin, int n_src)
+  {
+    constexpr int N = Ns * Nc;
+    constexpr int B = coarse_dslash_src_block;
+    const int their_spinor_parity = (arg.nParity == 2) ? 1 - parity : 0;
+    const int my_spinor_parity = (arg.nParity == 2) ? parity : 0;
+
+    int coord[5];
+    getCoordsCB(coord, x_cb, arg.dim, arg.X0h, parity);
+    coord[4] = 0;
+
+    // the exterior update only touches sites with a partitioned neighbour
+    if (!doBulk<type>()) {
+      bool boundary = false;
+      for (int d = 0; d < nDim; d++)
+        if (arg.commDim[d] && (coord[d] + arg.nFace >= arg.dim[d] || coord[d] - arg.nFace < 0)) boundary = true;
+      if (!boundary) return;
+    }
+
+    complex<Float> out[B][N];
+    complex<Float> in[B][N];
+    for (int src = 0; src < n_src; src++)
+      for (int i = 0; i < N; i++) out[src][i] = complex<Float>(0.0, 0.0);
+
+    if (dslash) {
+      for (int d = 0; d < nDim; d++) {
+        // forward gather: out += Y_{-mu}(x) in(x+mu)
+        const bool fwd_halo = arg.commDim[d] && (coord[d] + arg.nFace >= arg.dim[d]);
+        if (fwd_halo ? doHalo<type>() : doBulk<type>()) {
+          const int fwd_idx = linkIndexP1(coord, arg.dim, d);
+          for (int src = 0; src < n_src; src++) {
+            const int src_idx = src_begin + src;
+            coord[4] = src_idx;
+            const int ghost_idx = fwd_halo ? ghostFaceIndex<1, 5>(coord, arg.dim, d, arg.nFace) : 0;
+            for (int s_col = 0; s_col < Ns; s_col++)
+              for (int c_col = 0; c_col < Nc; c_col++)
+                in[src][s_col * Nc + c_col] = fwd_halo ?
+                  arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx + src_idx * arg.volumeCB, s_col, c_col) :
+                  arg.inA(their_spinor_parity, fwd_idx + src_idx * arg.volumeCB, s_col, c_col);
+          }
+          coord[4] = 0;
+
+          for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++) {
+              const complex<Float> Y = arg.Y(dagger ? d : d + 4, parity, x_cb, row, col);
+              for (int src = 0; src < n_src; src++) out[src][row] += Y * in[src][col];
+            }
+          }
+        }
+
+        // backward gather: out += Y^dagger_mu(x-mu) in(x-mu)
+        const bool back_halo = arg.commDim[d] && (coord[d] - arg.nFace < 0);
+        if (back_halo ? doHalo<type>() : doBulk<type>()) {
+          const int back_idx = linkIndexM1(coord, arg.dim, d);
+          const int link_ghost_idx = back_halo ? ghostFaceIndex<0, 5>(coord, arg.dim, d, arg.nFace) : 0;
+          for (int src = 0; src < n_src; src++) {
+            const int src_idx = src_begin + src;
+            coord[4] = src_idx;
+            const int ghost_idx = back_halo ? ghostFaceIndex<0, 5>(coord, arg.dim, d, arg.nFace) : 0;
+            for (int s_col = 0; s_col < Ns; s_col++)
+              for (int c_col = 0; c_col < Nc; c_col++)
+                in[src][s_col * Nc + c_col] = back_halo ?
+                  arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx + src_idx * arg.volumeCB, s_col, c_col) :
+                  arg.inA(their_spinor_parity, back_idx + src_idx * arg.volumeCB, s_col, c_col);
+          }
+          coord[4] = 0;
+
+          for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++) {
+              const complex<Float> Y = back_halo ? conj(arg.Y.Ghost(dagger ? d + 4 : d, 1 - parity, link_ghost_idx, col, row)) :
+                                                   conj(arg.Y(dagger ? d + 4 : d, 1 - parity, back_idx, col, row));
+              for (int src = 0; src < n_src; src++) out[src][row] += Y * in[src][col];
+            }
+          }
+        }
+      }
+
+      for (int src = 0; src < n_src; src++)
+        for (int i = 0; i < N; i++) out[src][i] *= -arg.kappa;
+    }
+
+    if (doBulk<type>() && clover) {
+      // factor of kappa and diagonal addition now incorporated in X
+      for (int src = 0; src < n_src; src++)
+        for (int s_col = 0; s_col < Ns; s_col++)
+          for (int c_col = 0; c_col < Nc; c_col++)
+            in[src][s_col * Nc + c_col] = arg.inB(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s_col, c_col);
+
+      for (int row = 0; row < N; row++) {
+        for (int col = 0; col < N; col++) {
+          const complex<Float> X = dagger ? conj(arg.X(0, parity, x_cb, col, row)) : arg.X(0, parity, x_cb, row, col);
+          for (int src = 0; src < n_src; src++) out[src][row] += X * in[src][col];
+        }
+      }
+    }
+
+    for (int src = 0; src < n_src; src++) {
+      for (int s = 0; s < Ns; s++) {
+        for (int c = 0; c < Nc; c++) {
+          // if not halo we just store, else we accumulate
+          if (doBulk<type>()) arg.out(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s, c) = out[src][s * Nc + c];
+          else arg.out(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s, c) += out[src][s * Nc + c];
+        }
+      }
+    }
+  }
+
+  /**
+     CPU kernel for applying the coarse Dslash to a vector, threaded
+     over the sites of both parities.  The fine-grained parameters
+     (Mc) mean nothing for the CPU variant: each thread computes all
+     rows of a site, for blocks of coarse_dslash_src_block sources.
+  */
   template <typename Float, int nDim, int Ns, int Nc, int Mc, bool dslash, bool clover, bool dagger, DslashType type, typename Arg>
   void coarseDslash(Arg arg)
   {
-    // the fine-grain parameters mean nothing for CPU variant
-    const int color_stride = 1;
-    const int color_offset = 0;
-    const int dim_thread_split = 1;
-    const int dir = 0;
-    const int dim = 0;
-
-    for (int parity= 0; parity < arg.nParity; parity++) {
+    const int n_src = arg.dim[4];
+
+#pragma omp parallel for schedule(runtime)
+    for (int x_parity = 0; x_parity < arg.nParity * arg.volumeCB; x_parity++) {
       // for full fields then set parity from loop else use arg setting
-      parity = (arg.nParity == 2) ? parity : arg.parity;
-
-      for (int src_idx = 0; src_idx < arg.dim[4]; src_idx++) {
-	//#pragma omp parallel for
-	for(int x_cb = 0; x_cb < arg.volumeCB; x_cb++) { // 4-d volume
-	  for (int s=0; s<2; s++) {
-	    for (int color_block=0; color_block<Nc; color_block+=Mc) { // Mc=Nc means all colors in a thread
-	      coarseDslash<Float,nDim,Ns,Nc,Mc,color_stride,dim_thread_split,dslash,clover,dagger,type,dir,dim>(arg, x_cb, src_idx, parity, s, color_block, color_offset);
-	    }
-	  }
-	} // 4-d volumeCB
-      } // src index
-    } // parity
+      const int parity = (arg.nParity == 2) ? x_parity / arg.volumeCB : arg.parity;
+      const int x_cb = (arg.nParity == 2) ? x_parity - (x_parity / arg.volumeCB) * arg.volumeCB : x_parity;
 
+      for (int src = 0; src < n_src; src += coarse_dslash_src_block) {
+        const int n = (n_src - src < coarse_dslash_src_block) ? n_src - src : coarse_dslash_src_block;
+        coarseDslashSite<Float, nDim, Ns, Nc, dslash, clover, dagger, type>(arg, parity, x_cb, src, n);
+      }
+    }
   }
 
   // GPU Kernel for applying the coarse Dslash to a vector
@@ -5,14 +5,17 @@
 namespace quda
 {
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_> struct FmunuArg
+  template <typename Float_, int nColor_, QudaReconstructType recon_,
+            typename G_ = typename gauge_mapper<Float_, recon_>::type,
+            typename F_ = typename gauge_mapper<Float_, QUDA_RECONSTRUCT_NO>::type>
+  struct FmunuArg
   {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static_assert(nColor == 3, "Only nColor=3 enabled at this time");
     static constexpr QudaReconstructType recon = recon_;
-    typedef typename gauge_mapper<Float,recon>::type G;
-    typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_NO>::type F;
+    typedef G_ G;
+    typedef F_ F;
 
     G u;
     F f;
@@ -39,7 +42,8 @@ namespace quda
     typedef Matrix<complex<typename Arg::Float>, 3> Link;
 
     int x[4];
-    auto &X = arg.X;
+    int X[4];
+    for (int dir = 0; dir < 4; ++dir) X[dir] = arg.X[dir];
 
     getCoords(x, idx, X, parity);
     for (int dir = 0; dir < 4; ++dir) {
@@ -192,6 +196,7 @@ namespace quda
 
   template <typename Arg> void computeFmunuCPU(Arg &arg)
   {
+#pragma omp parallel for collapse(2) schedule(runtime)
     for (int parity = 0; parity < 2; parity++) {
       for (int x_cb = 0; x_cb < arg.threads; x_cb++) {
         for (int mu = 0; mu < 4; mu++) {
@@ -3,16 +3,18 @@
 #include <launch_kernel.cuh>
 #include <index_helper.cuh>
 #include <cub_helper.cuh>
+#include <vector>
 
 namespace quda {
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_>
+  template <typename Float_, int nColor_, QudaReconstructType recon_,
+            typename Gauge_ = typename gauge_mapper<Float_, recon_>::type>
   struct GaugePlaqArg : public ReduceArg<double2> {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static_assert(nColor == 3, "Only nColor=3 enabled at this time");
     static constexpr QudaReconstructType recon = recon_;
-    typedef typename gauge_mapper<Float,recon>::type Gauge;
+    typedef Gauge_ Gauge;
 
     int threads; // number of active threads required
     int E[4]; // extended grid dimensions
@@ -79,4 +81,66 @@ namespace quda {
     reduce2d<blockSize,2>(arg, plaq);
   }
 
+  /**
+     @brief Host plaquette, with the link loads fused over all six
+     planes of a site: the four links U_mu(x) and the twelve links
+     U_nu(x+mu) are loaded once, and each plaquette is formed as
+     Re Tr[(U_mu(x) U_nu(x+mu)) (U_nu(x) U_mu(x+nu))^dagger].  The
+     sites of each (time slice, parity) pair are summed into their own
+     partial, with the partials summed in order, so the result does
+     not depend on the number of threads.
+     @param[in] arg Kernel argument
+     @return The (spatial, temporal) plaquette sums of this process
+   */
+  template <typename Arg> double2 computePlaqCPU(Arg &arg)
+  {
+    typedef Matrix<complex<typename Arg::Float>, Arg::nColor> Link;
+
+    const int nt = arg.X[3];
+    const int slice_cb = arg.threads / nt; // checkerboard sites per time slice
+    std::vector<double2> partial(2 * nt);
+
+#pragma omp parallel for schedule(static)
+    for (int slice = 0; slice < 2 * nt; slice++) {
+      const int parity = slice % 2;
+      double2 plaq = make_double2(0.0, 0.0);
+
+      for (int idx = (slice / 2) * slice_cb; idx < (slice / 2 + 1) * slice_cb; idx++) {
+        int x[4];
+        getCoords(x, idx, arg.X, parity);
+        for (int dr = 0; dr < 4; ++dr) x[dr] += arg.border[dr]; // extended grid coordinates
+
+        int dx[4] = {0, 0, 0, 0};
+        Link U[4], Ufwd[4][4]; // Ufwd[mu][nu] = U_nu(x+mu)
+        for (int mu = 0; mu < 4; mu++) U[mu] = arg.U(mu, linkIndexShift(x, dx, arg.E), parity);
+        for (int mu = 0; mu < 4; mu++) {
+          dx[mu]++;
+          for (int nu = 0; nu < 4; nu++)
+            if (nu != mu) Ufwd[mu][nu] = arg.U(nu, linkIndexShift(x, dx, arg.E), 1 - parity);
+          dx[mu]--;
+        }
+
+        for (int mu = 0; mu < 3; mu++) {
+          for (int nu = mu + 1; nu < 4; nu++) {
+            Link A = U[mu] * Ufwd[mu][nu];
+            Link B = U[nu] * Ufwd[nu][mu];
+            double tr = 0.0;
+            for (int i = 0; i < Arg::nColor; i++)
+              for (int j = 0; j < Arg::nColor; j++) tr += A(i, j).real() * B(i, j).real() + A(i, j).imag() * B(i, j).imag();
+            if (nu < 3) plaq.x += tr;
+            else plaq.y += tr;
+          }
+        }
+      }
+      partial[slice] = plaq;
+    }
+
+    double2 plaq = make_double2(0.0, 0.0);
+    for (int slice = 0; slice < 2 * nt; slice++) {
+      plaq.x += partial[slice].x;
+      plaq.y += partial[slice].y;
+    }
+    return plaq;
+  }
+
 } // namespace quda
@@ -1,6 +1,7 @@
 #include <gauge_field_order.h>
 #include <index_helper.cuh>
 #include <cub_helper.cuh>
+#include <vector>
 
 #ifndef Pi2
 #define Pi2 6.2831853071795864769252867665590
@@ -9,19 +10,21 @@
 namespace quda
 {
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_, bool density_ = false> struct QChargeArg :
-    public ReduceArg<double>
+  template <typename Float_, int nColor_, QudaReconstructType recon_, bool density_ = false,
+            typename F_ = typename gauge_mapper<Float_, recon_>::type>
+  struct QChargeArg : public ReduceArg<double>
   {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static_assert(nColor == 3, "Only nColor=3 enabled at this time");
     static constexpr QudaReconstructType recon = recon_;
     static constexpr bool density = density_;
-    typedef typename gauge_mapper<Float,recon>::type F;
-    
+    typedef F_ F;
+
     int threads; // number of active threads required
     F f;
     Float *qDensity;
+    int X[4]; // grid dimensions
 
     QChargeArg(const GaugeField &Fmunu, Float *qDensity = nullptr) :
       ReduceArg<double>(),
@@ -29,9 +32,28 @@ namespace quda
       threads(Fmunu.VolumeCB()),
       qDensity(qDensity)
     {
+      for (int dir = 0; dir < 4; ++dir) X[dir] = Fmunu.X()[dir];
     }
   };
 
+  template <typename Arg> __device__ __host__ inline double qChargeSite(Arg &arg, int x_cb, int parity)
+  {
+    // Load the field-strength tensor from global memory
+    Matrix<complex<typename Arg::Float>, Arg::nColor> F[] = {arg.f(0, x_cb, parity), arg.f(1, x_cb, parity), arg.f(2, x_cb, parity),
+                                                             arg.f(3, x_cb, parity), arg.f(4, x_cb, parity), arg.f(5, x_cb, parity)};
+
+    double Q1 = getTrace(F[0] * F[5]).real();
+    double Q2 = getTrace(F[1] * F[4]).real();
+    double Q3 = getTrace(F[3] * F[2]).real();
+    double Q_idx = (Q1 + Q3 - Q2);
+
+    if (Arg::density) {
+      int idx = x_cb + parity * arg.threads;
+      arg.qDensity[idx] = Q_idx / (Pi2 * Pi2);
+    }
+    return Q_idx;
+  }
+
   // Core routine for computing the topological charge from the field strength
   template <int blockSize, typename Arg> __global__ void qChargeComputeKernel(Arg arg)
   {
@@ -41,20 +63,7 @@ namespace quda
     double Q = 0.0;
 
     while (x_cb < arg.threads) {
-      // Load the field-strength tensor from global memory
-      Matrix<complex<typename Arg::Float>, Arg::nColor> F[] = {arg.f(0, x_cb, parity), arg.f(1, x_cb, parity), arg.f(2, x_cb, parity),
-                                                               arg.f(3, x_cb, parity), arg.f(4, x_cb, parity), arg.f(5, x_cb, parity)};
-
-      double Q1 = getTrace(F[0] * F[5]).real();
-      double Q2 = getTrace(F[1] * F[4]).real();
-      double Q3 = getTrace(F[3] * F[2]).real();
-      double Q_idx = (Q1 + Q3 - Q2);
-      Q += Q_idx;
-
-      if (Arg::density) {
-        int idx = x_cb + parity * arg.threads;
-        arg.qDensity[idx] = Q_idx / (Pi2 * Pi2);
-      }
+      Q += qChargeSite(arg, x_cb, parity);
       x_cb += blockDim.x * gridDim.x;
     }
     Q /= (Pi2 * Pi2);
@@ -62,4 +71,36 @@ namespace quda
     reduce2d<blockSize, 2>(arg, Q);
   }
 
+  /**
+     @brief Host topological charge.  The sites of each (time slice,
+     parity) pair are summed into their own partial, with the partials
+     summed in order, so the result does not depend on the number of
+     threads.
+     @param[in] arg Kernel argument
+     @param[out] q_t Charge of each local time slice (optional)
+     @return The topological charge of this process
+   */
+  template <typename Arg> double qChargeComputeCPU(Arg &arg, double *q_t = nullptr)
+  {
+    const int nt = arg.X[3];
+    const int slice_cb = arg.threads / nt; // checkerboard sites per time slice
+    std::vector<double> partial(2 * nt);
+
+#pragma omp parallel for schedule(static)
+    for (int slice = 0; slice < 2 * nt; slice++) {
+      const int parity = slice % 2;
+      double Q = 0.0;
+      for (int x_cb = (slice / 2) * slice_cb; x_cb < (slice / 2 + 1) * slice_cb; x_cb++) Q += qChargeSite(arg, x_cb, parity);
+      partial[slice] = Q / (Pi2 * Pi2);
+    }
+
+    double Q = 0.0;
+    for (int t = 0; t < nt; t++) {
+      double Q_t = partial[2 * t] + partial[2 * t + 1];
+      if (q_t) q_t[t] = Q_t;
+      Q += Q_t;
+    }
+    return Q;
+  }
+
 } // namespace quda
@@ -9,13 +9,15 @@ namespace quda
 #define  DOUBLE_TOL	1e-15
 #define  SINGLE_TOL	2e-6
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_, int stoutDim_> struct GaugeSTOUTArg {
+  template <typename Float_, int nColor_, QudaReconstructType recon_, int stoutDim_,
+            typename Gauge_ = typename gauge_mapper<Float_, recon_>::type>
+  struct GaugeSTOUTArg {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static_assert(nColor == 3, "Only nColor=3 enabled at this time");
     static constexpr QudaReconstructType recon = recon_;
     static constexpr int stoutDim = stoutDim_;
-    typedef typename gauge_mapper<Float,recon>::type Gauge;
+    typedef Gauge_ Gauge;
 
     Gauge out;
     const Gauge in;
@@ -104,13 +106,8 @@ namespace quda
     }
   }
 
-  template <typename Arg> __global__ void computeSTOUTStep(Arg arg)
+  template <typename Arg> __host__ __device__ void computeSTOUTStepCore(Arg &arg, int idx, int parity, int dir)
   {
-    int idx = threadIdx.x + blockIdx.x * blockDim.x;
-    int parity = threadIdx.y + blockIdx.y * blockDim.y;
-    int dir = threadIdx.z + blockIdx.z * blockDim.z;
-    if (idx >= arg.threads) return;
-    if (dir >= Arg::stoutDim) return;
     using real = typename Arg::Float;
     typedef complex<real> Complex;
     typedef Matrix<complex<real>, Arg::nColor> Link;
@@ -206,6 +203,26 @@ namespace quda
     }
   }
 
+  template <typename Arg> __global__ void computeSTOUTStep(Arg arg)
+  {
+    int idx = threadIdx.x + blockIdx.x * blockDim.x;
+    int parity = threadIdx.y + blockIdx.y * blockDim.y;
+    int dir = threadIdx.z + blockIdx.z * blockDim.z;
+    if (idx >= arg.threads) return;
+    if (dir >= Arg::stoutDim) return;
+    computeSTOUTStepCore(arg, idx, parity, dir);
+  }
+
+  template <typename Arg> void computeSTOUTStepCPU(Arg &arg)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < arg.threads; idx++) {
+        for (int dir = 0; dir < Arg::stoutDim; dir++) computeSTOUTStepCore(arg, idx, parity, dir);
+      }
+    }
+  }
+
   //------------------------//
   // Over-Improved routines //
   //------------------------//
@@ -439,14 +456,8 @@ namespace quda
     }
   }
 
-  template <typename Arg> __global__ void computeOvrImpSTOUTStep(Arg arg)
+  template <typename Arg> __host__ __device__ void computeOvrImpSTOUTStepCore(Arg &arg, int idx, int parity, int dir)
   {
-    int idx = threadIdx.x + blockIdx.x * blockDim.x;
-    int parity = threadIdx.y + blockIdx.y * blockDim.y;
-    int dir = threadIdx.z + blockIdx.z * blockDim.z;
-    if (idx >= arg.threads) return;
-    if (dir >= Arg::stoutDim) return;
-
     using real = typename Arg::Float;
     typedef complex<real> Complex;
     typedef Matrix<complex<real>, Arg::nColor> Link;
@@ -545,4 +556,24 @@ namespace quda
     }
   }
 
+  template <typename Arg> __global__ void computeOvrImpSTOUTStep(Arg arg)
+  {
+    int idx = threadIdx.x + blockIdx.x * blockDim.x;
+    int parity = threadIdx.y + blockIdx.y * blockDim.y;
+    int dir = threadIdx.z + blockIdx.z * blockDim.z;
+    if (idx >= arg.threads) return;
+    if (dir >= Arg::stoutDim) return;
+    computeOvrImpSTOUTStepCore(arg, idx, parity, dir);
+  }
+
+  template <typename Arg> void computeOvrImpSTOUTStepCPU(Arg &arg)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < arg.threads; idx++) {
+        for (int dir = 0; dir < Arg::stoutDim; dir++) computeOvrImpSTOUTStepCore(arg, idx, parity, dir);
+      }
+    }
+  }
+
 } // namespace quda
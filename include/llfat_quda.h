@@ -8,7 +8,9 @@ namespace quda {
 
   /**
      @brief Compute the fat and long links for an improved staggered
-     (Kogut-Susskind) fermions.
+     (Kogut-Susskind) fermions.  Host fields (QDP or MILC order) are
+     computed by a threaded host implementation sharing the staple
+     structure of the device path.
      @param fat[out] The computed fat link
      @param lng[out] The computed long link (only computed if lng!=0)
      @param u[in] The input gauge field
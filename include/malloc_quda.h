@@ -3,6 +3,7 @@
 
 #include <cstdlib>
 #include <cstdint>
+#include <vector>
 #include <enum_quda.h>
 
 namespace quda {
@@ -10,6 +11,37 @@ namespace quda {
   void printPeakMemUsage();
   void assertAllMemFree();
 
+  /** number of bins in the per-site allocation size histogram */
+  constexpr int alloc_histogram_bins = 48;
+
+  /**
+     Memory usage statistics of an allocation call site.
+   */
+  struct AllocSiteStats {
+    const char *func;   /**< function of the call site */
+    const char *file;   /**< file of the call site */
+    int line;           /**< line of the call site */
+    const char *type;   /**< memory type allocated */
+    long live_bytes;    /**< bytes presently allocated from this site */
+    long peak_bytes;    /**< maximum bytes allocated at once from this site */
+    long bytes_at_peak; /**< bytes allocated from this site when the total for its memory type peaked */
+    long count;         /**< number of allocations made from this site */
+    long size_histogram[alloc_histogram_bins]; /**< number of allocations of size [2^i, 2^(i+1)) */
+  };
+
+  /**
+     @return Memory usage statistics for every call site that has
+     allocated memory
+   */
+  std::vector<AllocSiteStats> getAllocSites();
+
+  /**
+     @brief Print the allocation call sites in decreasing order of
+     their contribution to the peak memory usage
+     @param[in] max_sites Maximum number of sites to print
+   */
+  void printAllocSites(int max_sites = 16);
+
   /**
      @return peak device memory allocated
    */
@@ -30,6 +62,26 @@ namespace quda {
    */
   long host_allocated_peak();
 
+  /**
+     @return device memory presently allocated
+   */
+  long device_allocated();
+
+  /**
+     @return pinned memory presently allocated
+   */
+  long pinned_allocated();
+
+  /**
+     @return mapped memory presently allocated
+   */
+  long mapped_allocated();
+
+  /**
+     @return host memory presently allocated
+   */
+  long host_allocated();
+
   /**
      @return are we using managed memory for device allocations
   */
@@ -127,6 +179,11 @@ namespace quda {
     */
     void flush_pinned();
 
+    /**
+       @brief Free all outstanding host-memory allocations.
+    */
+    void flush_host();
+
   } // namespace pool
 
 }
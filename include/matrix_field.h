@@ -34,7 +34,7 @@ namespace quda
 #pragma unroll
       for (int i = 0; i < n; i++)
 #pragma unroll
-        for (int j = 0; j < n; j++) A(i, j) = field[(n * idx + i) * n + j] = A(i, j);
+        for (int j = 0; j < n; j++) A(i, j) = field[(n * idx + i) * n + j];
 #endif
     }
 
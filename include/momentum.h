@@ -41,8 +41,17 @@ namespace quda {
   bool forceMonitor();
 
   /**
-     @brief Flush any outstanding force monitoring information
+     @brief Flush any outstanding force monitoring information.  The
+     batch of samples recorded since the last flush is reduced across
+     ranks and handed to the background I/O thread for writing, so
+     this must be called by all ranks.
   */
   void flushForceMonitor();
 
+  /**
+     @brief Free the device buffer that holds the force samples
+     awaiting a flush.  Any outstanding samples are flushed first.
+  */
+  void freeForceMonitor();
+
 } // namespace quda
@@ -441,6 +441,20 @@ public:
 		      const GaugeField &gauge, const GaugeField &clover, const GaugeField &cloverInv,
 		      double kappa, double mu, double mu_factor, QudaDiracType dirac, QudaMatPCType matpc);
 
+  /**
+     @brief Set whether the host coarse operator construction fuses
+     the UV and VUV computations aggregate by aggregate (the default),
+     or forms the UV temporary and computes them separately as is done
+     on the GPU
+     @param fused[in] Whether to fuse the host computation
+   */
+  void setCoarseOpFused(bool fused);
+
+  /**
+     @return Whether the host coarse operator construction is fused
+   */
+  bool coarseOpFused();
+
   /**
      @brief Calculate preconditioned coarse links and coarse clover inverse field
      @param Yhat[out] Preconditioned coarse link field
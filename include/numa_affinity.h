@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 
 /**
  * sets the cpu affinity of the calling process to the affinity mask reported by nvidia-smi topo
@@ -8,3 +10,15 @@
  * @return          0 if numa affinity was set
  */
 int setNumaAffinityNVML(int deviceid);
+
+/**
+ * First touch each page of a freshly allocated host buffer, using
+ * the same static OpenMP partitioning as the host compute loops, so
+ * that with first-touch placement the pages are distributed over the
+ * NUMA nodes of the threads that will access them (after the process
+ * affinity has been set with setNumaAffinityNVML, this is the node
+ * local to the GPU).  One byte in each page is overwritten.
+ * @param ptr  the buffer
+ * @param bytes size of the buffer in bytes
+ */
+void numaFirstTouch(void *ptr, size_t bytes);
@@ -468,7 +468,8 @@ extern "C" {
     /** The memory type used to keep the Ritz vectors */
     QudaMemoryType mem_type_ritz;
 
-    /** Location where deflation should be done */
+    /** Location where deflation should be done, and where the
+        eigensolver holds its Krylov space */
     QudaFieldLocation location;
 
     /** Whether to run the verification checks once set up is complete */
@@ -1094,6 +1095,14 @@ extern "C" {
    */
   double momActionQuda(void* momentum, QudaGaugeParam* param);
 
+  /**
+   * Flush the force monitor (enabled with QUDA_ENABLE_FORCE_MONITOR=1).
+   * Force samples are batched and only reduced across ranks and
+   * written when flushed, so applications should call this once per
+   * trajectory.  This must be called by all ranks.
+   */
+  void flushForceMonitorQuda(void);
+
   /**
    * Allocate a gauge (matrix) field on the device and optionally download a host gauge field.
    *
@@ -1268,6 +1277,24 @@ extern "C" {
   void contractQuda(const void *x, const void *y, void *result, const QudaContractType cType, QudaInvertParam *param,
                     const int *X);
 
+  /**
+   * Public function to perform momentum-projected contractions of the
+   * host spinors x and y, summed over each time slice.  Only the
+   * projected result is computed and returned, rather than the
+   * contraction of every lattice site.
+   * @param[in] x pointer to host data
+   * @param[in] y pointer to host data
+   * @param[out] result pointer to the global time slices x momenta x 16
+   * spin projections, stored as complex doubles
+   * @param[in] cType Which type of contraction (open, degrand-rossi, etc)
+   * @param[in] mom the n_mom integer spatial momenta (x,y,z), with p_d = 2 pi mom_d / L_d
+   * @param[in] n_mom number of momenta
+   * @param[in] param meta data for construction of ColorSpinorFields.
+   * @param[in] X spacetime data for construction of ColorSpinorFields.
+   */
+  void contractMomentumQuda(const void *x, const void *y, void *result, const QudaContractType cType, const int *mom,
+                            int n_mom, QudaInvertParam *param, const int *X);
+
   /**
      @brief Calculates the topological charge from gaugeSmeared, if it exist,
      or from gaugePrecise if no smeared fields are present.
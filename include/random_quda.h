@@ -29,6 +29,7 @@ class RNG {
   int size;                 /*! @brief number of curand states */
   int size_cb;        /*! @brief number of curand states checkerboarded (equal to size if we have a single parity) */
   int X[4];           /*! @brief local lattice dimensions */
+  unsigned int host_stream = 0; /*! @brief next stream of the counter-based generator used for host fields */
   void AllocateRNG(); /*! @brief allocate curand rng states array in device memory */
 
   public:
@@ -54,6 +55,14 @@ class RNG {
 
   unsigned long long Seed() { return seed; };
 
+  /**
+     @brief Return the next stream of the counter-based generator
+     (CounterRNG) used when generating host fields.  Each host field
+     generated from this RNG draws from a new stream, so successive
+     draws differ while remaining independent of the process grid.
+  */
+  unsigned int nextHostStream() { return host_stream++; }
+
   __host__ __device__ __inline__ cuRNGState *State() { return state; };
 
   /*! @brief Restore CURAND array states initialization */
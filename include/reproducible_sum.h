@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+   @file reproducible_sum.h
+
+   Binned accumulator for reproducible floating-point summation.  The
+   exponent range of a double is split into fixed bins of
+   binned_sum_width bits, aligned to absolute exponents.  A value is
+   deposited by splitting it exactly into integer chunks, one per bin,
+   with an accumulator retaining only the binned_sum_fold highest
+   occupied bins.  Since the bins are fixed and the chunks are
+   accumulated with integer arithmetic, the result depends only on the
+   set of summands and not on their order or grouping, so that a sum
+   of per-process partials merged in any tree gives the same bits for
+   any process count.  A single value spans at most fold bins, so
+   each summand is captured exactly, with contributions below
+   2^(-(fold-1)*width) relative to the largest summand discarded.  Each
+   bin can absorb 2^(63-width) deposits without overflow.
+ */
+
+namespace quda
+{
+
+  constexpr int binned_sum_width = 40; // bits per bin
+  constexpr int binned_sum_fold = 3;   // number of bins retained
+  constexpr int binned_sum_bias = 1075; // bit position p has weight 2^(p - bias)
+
+  struct BinnedSum {
+    std::int64_t top;                        /** index of the highest retained bin, -1 if empty */
+    std::int64_t bin[binned_sum_fold];       /** bin[k] accumulates bin index top - k */
+    double special;                          /** sum of any non-finite summands */
+
+    BinnedSum() : top(-1), special(0.0)
+    {
+      for (int k = 0; k < binned_sum_fold; k++) bin[k] = 0;
+    }
+
+    explicit BinnedSum(double x) : BinnedSum() { deposit(x); }
+
+    /**
+       @brief Shift the retained window up such that its highest bin
+       is t, discarding bins that fall off the bottom
+     */
+    inline void raise(std::int64_t t)
+    {
+      if (t <= top) return;
+      const std::int64_t shift = top < 0 ? binned_sum_fold : t - top;
+      for (int k = binned_sum_fold - 1; k >= 0; k--) bin[k] = k >= shift ? bin[k - shift] : 0;
+      top = t;
+    }
+
+    /**
+       @brief Add a value to the accumulator
+       @param[in] x The value to add
+     */
+    inline void deposit(double x)
+    {
+      if (x == 0.0) return;
+      if (!std::isfinite(x)) {
+        special += x;
+        return;
+      }
+
+      // split x into its integer mantissa m and the bit position of its
+      // least-significant bit, such that |x| = m * 2^(lsb - bias)
+      std::uint64_t bits;
+      std::memcpy(&bits, &x, sizeof(double));
+      const int exponent = static_cast<int>((bits >> 52) & 0x7ff);
+      const std::uint64_t m = (bits & 0xfffffffffffffull) | (exponent ? 0x10000000000000ull : 0);
+      const int lsb = exponent ? exponent : 1;
+      const std::int64_t sign = (bits >> 63) ? -1 : 1;
+
+      int msb = 63;
+      while (!((m >> msb) & 1)) msb--;
+      const std::int64_t t = (lsb + msb) / binned_sum_width;
+      raise(t);
+
+      const std::uint64_t mask = (static_cast<std::uint64_t>(1) << binned_sum_width) - 1;
+      for (std::int64_t b = t; b >= 0 && top - b < binned_sum_fold; b--) {
+        const std::int64_t shift = b * binned_sum_width - lsb;
+        if (shift <= -binned_sum_width) break; // no bits of x left in this bin
+        const std::uint64_t chunk = shift >= 0 ? (m >> shift) & mask : (m << -shift) & mask;
+        bin[top - b] += sign * static_cast<std::int64_t>(chunk);
+      }
+    }
+
+    /**
+       @brief Merge another accumulator into this one
+       @param[in] a The accumulator to merge
+     */
+    inline BinnedSum &operator+=(const BinnedSum &a)
+    {
+      special += a.special;
+      if (a.top < 0) return *this;
+      raise(a.top);
+      for (int k = 0; k < binned_sum_fold; k++) {
+        const std::int64_t j = top - (a.top - k);
+        if (j < binned_sum_fold) bin[j] += a.bin[k];
+      }
+      return *this;
+    }
+
+    /**
+       @return The accumulated sum rounded to double.  The carries are
+       propagated upwards first, so the result only depends on the
+       represented value.
+     */
+    inline double value() const
+    {
+      if (special != 0.0) return special;
+      if (top < 0) return 0.0;
+
+      std::int64_t b[binned_sum_fold];
+      for (int k = 0; k < binned_sum_fold; k++) b[k] = bin[k];
+      for (int k = binned_sum_fold - 1; k > 0; k--) {
+        const std::int64_t carry = b[k] >> binned_sum_width; // floor division
+        b[k] -= carry * (static_cast<std::int64_t>(1) << binned_sum_width);
+        b[k - 1] += carry;
+      }
+
+      double sum = 0.0;
+      for (int k = binned_sum_fold - 1; k >= 0; k--)
+        sum += std::ldexp(static_cast<double>(b[k]), static_cast<int>((top - k) * binned_sum_width - binned_sum_bias));
+      return sum;
+    }
+  };
+
+} // namespace quda
@@ -23,6 +23,7 @@ namespace quda {
 #else
 
 #include <sys/time.h>
+#include <trace.h>
 
 #ifdef INTERFACE_NVTX
 #if QUDA_NVTX_VERSION == 3
@@ -176,6 +177,7 @@ namespace quda {
 #endif
     Timer profile[QUDA_PROFILE_COUNT];
     static std::string pname[];
+    int trace_id[QUDA_PROFILE_COUNT]; /**< Interned trace ids for each region, set on first use */
 
     bool switchOff;
     bool use_global;
@@ -211,9 +213,15 @@ namespace quda {
     }
 
   public:
-    TimeProfile(std::string fname) : fname(fname), switchOff(false), use_global(true) { ; }
+    TimeProfile(std::string fname) : fname(fname), switchOff(false), use_global(true)
+    {
+      for (int idx = 0; idx < QUDA_PROFILE_COUNT; idx++) trace_id[idx] = -1;
+    }
 
-    TimeProfile(std::string fname, bool use_global) : fname(fname), switchOff(false), use_global(use_global) { ; }
+    TimeProfile(std::string fname, bool use_global) : fname(fname), switchOff(false), use_global(use_global)
+    {
+      for (int idx = 0; idx < QUDA_PROFILE_COUNT; idx++) trace_id[idx] = -1;
+    }
 
     /**< Print out the profile information */
     void Print();
@@ -222,10 +230,12 @@ namespace quda {
       // if total timer isn't running, then start it running
       if (!profile[QUDA_PROFILE_TOTAL].running && idx != QUDA_PROFILE_TOTAL) {
 	profile[QUDA_PROFILE_TOTAL].Start(func,file,line);
+        if (traceEnabled()) traceRegion(trace_id[QUDA_PROFILE_TOTAL], fname.c_str(), pname[QUDA_PROFILE_TOTAL].c_str(), true);
         switchOff = true;
       }
 
       profile[idx].Start(func, file, line); 
+      if (traceEnabled()) traceRegion(trace_id[idx], fname.c_str(), pname[idx].c_str(), true);
       PUSH_RANGE(fname.c_str(),idx)
 	if (use_global) StartGlobal(func,file,line,idx);
     }
@@ -233,11 +243,13 @@ namespace quda {
 
     void Stop_(const char *func, const char *file, int line, QudaProfileType idx) {
       profile[idx].Stop(func, file, line); 
+      if (traceEnabled()) traceRegion(trace_id[idx], fname.c_str(), pname[idx].c_str(), false);
       POP_RANGE
 
       // switch off total timer if we need to
       if (switchOff && idx != QUDA_PROFILE_TOTAL) {
         profile[QUDA_PROFILE_TOTAL].Stop(func,file,line);
+        if (traceEnabled()) traceRegion(trace_id[QUDA_PROFILE_TOTAL], fname.c_str(), pname[QUDA_PROFILE_TOTAL].c_str(), false);
         switchOff = false;
       }
       if (use_global) StopGlobal(func,file,line,idx);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <iosfwd>
+
+/**
+   @file trace.h
+
+   Low-overhead timeline of kernel launches, posted trace events and
+   TimeProfile regions.  Events are recorded into a fixed-capacity,
+   preallocated ring buffer of compact records (the oldest records
+   are overwritten once it is full), where each record refers to its
+   key strings via an interned id.  The buffer is dumped to a binary
+   file by saveProfile(), and converted to Chrome trace-event JSON
+   that can be loaded into chrome://tracing or Perfetto.
+
+   Tracing is enabled with QUDA_ENABLE_TRACE=1 (posted events and
+   regions only) or QUDA_ENABLE_TRACE=2 (additionally every kernel
+   launch), with the ring-buffer capacity set by
+   QUDA_TRACE_BUFFER_SIZE (number of records, default 262144).
+   Recording is not thread safe, and must only be called from the
+   host thread that drives QUDA.
+ */
+
+namespace quda {
+
+  struct TuneKey;
+
+  enum TraceEventType : std::uint16_t {
+    QUDA_TRACE_KERNEL = 0,       /**< kernel launch, with duration set to its tuned execution time */
+    QUDA_TRACE_POST = 1,         /**< event posted with postTrace() */
+    QUDA_TRACE_REGION_BEGIN = 2, /**< start of a TimeProfile region */
+    QUDA_TRACE_REGION_END = 3    /**< end of a TimeProfile region */
+  };
+
+  /**
+     @brief A single trace record.  The memory counters are the bytes
+     presently allocated at the time of the event.
+   */
+  struct TraceRecord {
+    std::uint64_t time;   /**< nanoseconds since the trace was started */
+    std::uint32_t id;     /**< interned key id */
+    std::uint16_t type;   /**< TraceEventType */
+    std::uint16_t stream; /**< stream the event was issued to */
+    float duration;       /**< estimated duration in seconds (kernels only) */
+    std::uint32_t unused;
+    std::int64_t device_bytes;
+    std::int64_t pinned_bytes;
+    std::int64_t mapped_bytes;
+    std::int64_t host_bytes;
+  };
+
+  /**
+     @brief Header of the binary trace file.  This is followed by
+     n_keys interned keys, each stored as three null-terminated
+     strings (volume, name, aux), and then n_records TraceRecords in
+     chronological order.
+   */
+  struct TraceFileHeader {
+    char magic[8];              /**< "QUDATRC" */
+    std::uint32_t version;      /**< format version */
+    std::uint32_t record_bytes; /**< sizeof(TraceRecord) */
+    std::uint64_t n_records;    /**< number of records in the file */
+    std::uint64_t n_dropped;    /**< number of records overwritten in the ring buffer */
+    std::uint32_t n_keys;       /**< number of interned keys */
+    std::int32_t rank;          /**< rank of the process that wrote the trace */
+  };
+
+  /**
+     @return Trace level: 0 (disabled), 1 (posted events and regions)
+     or 2 (also kernel launches)
+   */
+  int traceEnabled();
+
+  /**
+     @brief Record a kernel launch in the trace
+     @param[in] key The tuning key of the kernel
+     @param[in] time The tuned execution time of the kernel in seconds
+     @param[in] stream Trace id of the stream the kernel is launched to (0 for the default stream)
+   */
+  void traceKernel(const TuneKey &key, float time, int stream = 0);
+
+  /**
+     @brief Post an event in the trace, recording where it was posted
+   */
+  void postTrace_(const char *func, const char *file, int line);
+
+  /**
+     @brief Record the start or end of a TimeProfile region
+     @param[in,out] id Interned id of the region, which is set on the
+     first call (should be initialized to -1)
+     @param[in] profile Name of the TimeProfile
+     @param[in] region Name of the region within the profile
+     @param[in] begin Whether this is the beginning or end of the region
+   */
+  void traceRegion(int &id, const char *profile, const char *region, bool begin);
+
+  /**
+     @brief Dump the trace to a binary file
+     @param[in] path The file to write
+     @return The number of records written
+   */
+  std::size_t saveTrace(const std::string &path);
+
+  /**
+     @brief Convert a binary trace into Chrome trace-event JSON.
+     Kernel launches are placed on a per-stream "device" track
+     assuming in-order execution, with their tuned execution time as
+     their duration; posted events and regions appear on the "host"
+     track, and memory usage as counters.
+     @param[in] in Stream the binary trace is read from
+     @param[out] out Stream the JSON is written to
+     @return Whether the conversion succeeded
+   */
+  bool convertTrace(std::istream &in, std::ostream &out);
+
+} // namespace quda
+
+#define postTrace() quda::postTrace_(__func__, quda::file_name(__FILE__), __LINE__)
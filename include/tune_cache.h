@@ -0,0 +1,124 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <utility>
+#include <tune_key.h>
+
+namespace quda {
+
+  /**
+     @brief Hash map from TuneKey to tuned parameters that backs the
+     tunecache.  Entries are stored contiguously in insertion order in
+     a std::deque, so references to entries remain valid for the
+     lifetime of the map (entries are never erased), which allows
+     callers to memoize the location of an entry.  The index is an
+     open-addressing table with linear probing keyed on the
+     precomputed TuneKey::hash, so a lookup costs a handful of integer
+     compares plus a single full key comparison on a hash match.
+     Host-only and independent of CUDA so it can be benchmarked
+     standalone.
+   */
+  template <typename Param> class TuneCacheMap
+  {
+
+  public:
+    typedef std::pair<TuneKey, Param> value_type;
+    typedef typename std::deque<value_type>::iterator iterator;
+    typedef typename std::deque<value_type>::const_iterator const_iterator;
+
+  private:
+    struct Bucket {
+      std::uint64_t hash;
+      std::size_t index; // index + 1 into entries, with 0 denoting an empty bucket
+    };
+
+    std::deque<value_type> entries;
+    std::vector<Bucket> table;
+    std::size_t mask;
+
+    /**
+       @brief Return the bucket where key either resides or would be
+       inserted
+     */
+    Bucket &probe(const TuneKey &key)
+    {
+      std::size_t b = key.hash & mask;
+      while (table[b].index && !(table[b].hash == key.hash && entries[table[b].index - 1].first == key)) {
+        b = (b + 1) & mask;
+      }
+      return table[b];
+    }
+
+    /**
+       @brief Double the size of the index and reinsert all entries.
+       The entries themselves are not moved.
+     */
+    void grow()
+    {
+      std::vector<Bucket> old(table.size() * 2, Bucket {0, 0});
+      table.swap(old);
+      mask = table.size() - 1;
+      for (auto &bucket : old) {
+        if (!bucket.index) continue;
+        std::size_t b = bucket.hash & mask;
+        while (table[b].index) b = (b + 1) & mask;
+        table[b] = bucket;
+      }
+    }
+
+  public:
+    /**
+       @param[in] capacity Initial number of buckets (rounded up to a
+       power of two)
+     */
+    TuneCacheMap(std::size_t capacity = 1024)
+    {
+      std::size_t n = 2;
+      while (n < capacity) n *= 2;
+      table.resize(n, Bucket {0, 0});
+      mask = n - 1;
+    }
+
+    std::size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+
+    iterator begin() { return entries.begin(); }
+    iterator end() { return entries.end(); }
+    const_iterator begin() const { return entries.begin(); }
+    const_iterator end() const { return entries.end(); }
+
+    iterator find(const TuneKey &key)
+    {
+      const Bucket &bucket = probe(key);
+      return bucket.index ? entries.begin() + (bucket.index - 1) : entries.end();
+    }
+
+    const_iterator find(const TuneKey &key) const
+    {
+      return const_cast<TuneCacheMap *>(this)->find(key);
+    }
+
+    /**
+       @brief Return the parameters for key, inserting a
+       default-constructed entry if not present
+     */
+    Param &operator[](const TuneKey &key)
+    {
+      Bucket *bucket = &probe(key);
+      if (bucket->index) return entries[bucket->index - 1].second;
+
+      // keep the load factor at or below one half
+      if (2 * (entries.size() + 1) > table.size()) {
+        grow();
+        bucket = &probe(key);
+      }
+
+      entries.emplace_back(key, Param());
+      bucket->hash = key.hash;
+      bucket->index = entries.size();
+      return entries.back().second;
+    }
+  };
+
+} // namespace quda
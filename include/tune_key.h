@@ -2,6 +2,7 @@
 #define _TUNE_KEY_H
 
 #include <cstring>
+#include <cstdint>
 
 namespace quda {
 
@@ -14,13 +15,21 @@ namespace quda {
     char name[name_n];
     char aux[aux_n];
 
-    TuneKey() { }
+    /**
+       64-bit hash of (volume, name, aux), computed on construction.
+       Any code that modifies the strings in place must call rehash()
+       afterwards, else the key will not be found in the tunecache.
+     */
+    std::uint64_t hash;
+
+    TuneKey() : hash(0) { volume[0] = name[0] = aux[0] = '\0'; }
     TuneKey(const char v[], const char n[], const char a[]="type=default") {
       strcpy(volume, v);
       strcpy(name, n);
       strcpy(aux, a);
-    } 
-    TuneKey(const TuneKey &key) {
+      rehash();
+    }
+    TuneKey(const TuneKey &key) : hash(key.hash) {
       strcpy(volume,key.volume);
       strcpy(name,key.name);
       strcpy(aux,key.aux);
@@ -31,10 +40,43 @@ namespace quda {
 	strcpy(volume,key.volume);
 	strcpy(name,key.name);
 	strcpy(aux,key.aux);
+	hash = key.hash;
       }
       return *this;
     }
 
+    /**
+       @brief Recompute the hash from the present contents of the key
+       strings.  We use FNV-1a over the three strings (with the
+       terminating null included so that the string boundaries are
+       part of the hash) followed by a 64-bit avalanche finalizer so
+       the low bits are usable directly as a hash-table index.
+     */
+    void rehash() {
+      std::uint64_t h = 0xcbf29ce484222325ull;
+      const char *s[] = {volume, name, aux};
+      for (int i = 0; i < 3; i++) {
+        const char *c = s[i];
+        do {
+          h ^= static_cast<unsigned char>(*c);
+          h *= 0x100000001b3ull;
+        } while (*c++);
+      }
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdull;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ull;
+      h ^= h >> 33;
+      hash = h;
+    }
+
+    bool operator==(const TuneKey &other) const {
+      return hash == other.hash && std::strcmp(volume, other.volume) == 0 && std::strcmp(name, other.name) == 0
+        && std::strcmp(aux, other.aux) == 0;
+    }
+
+    bool operator!=(const TuneKey &other) const { return !(*this == other); }
+
     bool operator<(const TuneKey &other) const {
       int vc = std::strcmp(volume, other.volume);
       if (vc < 0) {
@@ -49,12 +91,12 @@ namespace quda {
       }
       return false;
     }
-  
+
   };
 
 }
 
 /** Return the key of the last kernel that has been tuned / called.*/
 quda::TuneKey getLastTuneKey();
- 
+
 #endif
@@ -6,10 +6,13 @@
 #include <iomanip>
 #include <cstring>
 #include <cfloat>
+#include <ctime>
 #include <stdarg.h>
 #include <map>
 
 #include <tune_key.h>
+#include <tune_cache.h>
+#include <trace.h>
 #include <quda_internal.h>
 
 namespace quda {
@@ -55,11 +58,85 @@ namespace quda {
     }
   };
 
+  typedef TuneCacheMap<TuneParam> TuneCache;
+
+  /**
+     @brief Abstract timing backend used by the autotuner to time
+     candidate launch configurations.
+   */
+  class TuneTimer {
+
+  public:
+    virtual ~TuneTimer() { }
+
+    /** @brief Start timing */
+    virtual void start() = 0;
+
+    /** @brief Stop timing, blocking until all timed work has completed */
+    virtual void stop() = 0;
+
+    /** @return The elapsed time in seconds between the last start() and stop() */
+    virtual double elapsed() const = 0;
+  };
+
+  /**
+     @brief Timing backend for device Tunables: CUDA events recorded
+     on the default stream.
+   */
+  class DeviceTuneTimer : public TuneTimer {
+    cudaEvent_t start_event;
+    cudaEvent_t end_event;
+
+  public:
+    DeviceTuneTimer();
+    virtual ~DeviceTuneTimer();
+    void start();
+    void stop();
+    double elapsed() const;
+  };
+
+  /**
+     @brief Timing backend for host Tunables: the monotonic host
+     clock.  This makes no CUDA API calls so can be used on nodes
+     without a GPU.
+   */
+  class HostTuneTimer : public TuneTimer {
+    timespec start_time;
+    timespec end_time;
+
+  public:
+    void start();
+    void stop();
+    double elapsed() const;
+  };
+
+  /**
+     @brief Applies the OpenMP launch configuration encoded in a host
+     TuneParam for the lifetime of the object, restoring the previous
+     configuration on destruction.  Host Tunables construct one of
+     these around their OpenMP loops, which must use
+     schedule(runtime) for the tuned schedule to take effect.  The
+     encoding is
+       - param.block.x: number of OpenMP threads
+       - param.aux.x: OpenMP schedule kind (an omp_sched_t value)
+       - param.grid.x: schedule chunk size in sites, which also sets
+         the site blocking of the loop (0 for the default partition)
+   */
+  class HostLaunch {
+    int threads;
+    int kind;
+    int chunk;
+
+  public:
+    HostLaunch(const TuneParam &param);
+    ~HostLaunch();
+  };
+
   /**
    * @brief Returns a reference to the tunecache map
    * @return tunecache reference
    */
-  const std::map<TuneKey, TuneParam> &getTuneCache();
+  const TuneCache &getTuneCache();
 
   class Tunable {
 
@@ -275,6 +352,16 @@ namespace quda {
     /** This is the return result from kernels launched using jitify */
     CUresult jitify_error;
 
+    /** Memo of the tunecache entry this instance last resolved to in tuneLaunch */
+    TuneCache::value_type *cache_entry;
+
+    /**
+       @brief The maximum OpenMP chunk size considered when tuning a
+       host Tunable.  Chunks larger than the per-thread share of
+       minThreads() are never tried.
+    */
+    virtual unsigned int maxHostChunk() const { return 1024; }
+
     /**
        @brief Whether the present instance has already been tuned or not
        @return True if tuned, false if not
@@ -285,13 +372,16 @@ namespace quda {
       if (!getTuning()) return true;
 
       TuneKey key = tuneKey();
-      if (use_managed_memory()) strcat(key.aux, ",managed");
+      if (use_managed_memory()) {
+        strcat(key.aux, ",managed");
+        key.rehash();
+      }
       // if key is present in cache then already tuned
       return getTuneCache().find(key) != getTuneCache().end();
     }
 
   public:
-    Tunable() : jitify_error(CUDA_SUCCESS) { aux[0] = '\0'; }
+    Tunable() : jitify_error(CUDA_SUCCESS), cache_entry(nullptr) { aux[0] = '\0'; }
     virtual ~Tunable() { }
     virtual TuneKey tuneKey() const = 0;
     virtual void apply(const cudaStream_t &stream) = 0;
@@ -299,10 +389,22 @@ namespace quda {
     virtual void postTune() { }
     virtual int tuningIter() const { return 1; }
 
+    /**
+       @brief Where this instance executes.  Host instances are timed
+       with HostTuneTimer and tune their OpenMP launch configuration
+       (see HostLaunch) rather than the CUDA launch parameters.
+    */
+    virtual QudaFieldLocation tuneLocation() const { return QUDA_CUDA_FIELD_LOCATION; }
+
     virtual std::string paramString(const TuneParam &param) const
       {
 	std::stringstream ps;
-	ps << param;
+        if (tuneLocation() == QUDA_CPU_FIELD_LOCATION) {
+          ps << "threads=" << param.block.x << ", schedule=" << (param.aux.x == 2 ? "dynamic" : "static");
+          ps << ", chunk=" << param.grid.x;
+        } else {
+          ps << param;
+        }
 	return ps.str();
       }
 
@@ -352,6 +454,21 @@ namespace quda {
       return advanceSharedBytes(param) || advanceBlockDim(param) || advanceGridDim(param) || advanceAux(param);
     }
 
+    /** sets the initial host launch configuration for tuning: all threads and the default static partition */
+    virtual void initHostTuneParam(TuneParam &param) const;
+
+    /** sets the host launch configuration used when tuning is disabled */
+    virtual void defaultHostTuneParam(TuneParam &param) const { initHostTuneParam(param); }
+
+    /**
+       @brief Advance the host launch configuration.  We step through
+       chunk sizes for the static then dynamic schedules, and then
+       halve the number of threads, since small coarse grids can run
+       faster with fewer threads.
+       @return Whether there is a further configuration to try
+    */
+    virtual bool advanceHostTuneParam(TuneParam &param) const;
+
     /**
      * Check the launch parameters of the kernel to ensure that they are
      * valid for the current device.
@@ -389,6 +506,13 @@ namespace quda {
 
     CUresult jitifyError() const { return jitify_error; }
     CUresult& jitifyError() { return jitify_error; }
+
+    /**
+       @brief The tunecache entry this instance last launched with.
+       Entries are never relocated, so tuneLaunch can short circuit
+       the cache lookup when the key hash of a repeat launch matches.
+    */
+    TuneCache::value_type *&cacheEntry() { return cache_entry; }
   };
 
   
@@ -573,12 +697,19 @@ namespace quda {
    */
   void flushProfile();
 
-  TuneParam& tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity);
+  /**
+   * @brief Report, on the host thread, any errors from the background profile writes that have completed.
+   */
+  void reportProfileErrors();
 
   /**
-   * @brief Post an event in the trace, recording where it was posted
+   * @brief Return the launch parameters of a tunable, tuning it first if needed
+   * @param[in] tunable The tunable about to be launched
+   * @param[in] enabled Whether tuning is enabled
+   * @param[in] verbosity Verbosity of the tuning
+   * @param[in] stream The stream the tunable is launched to, recorded in the kernel trace
    */
-  void postTrace_(const char *func, const char *file, int line);
+  TuneParam& tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity, const cudaStream_t &stream = 0);
 
   /**
    * @brief Enable the profile kernel counting
@@ -597,6 +728,4 @@ namespace quda {
 
 } // namespace quda
 
-#define postTrace() quda::postTrace_(__func__, quda::file_name(__FILE__), __LINE__)
-
 #endif // _TUNE_QUDA_H
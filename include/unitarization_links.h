@@ -35,6 +35,16 @@ namespace quda {
 
   void unitarizeLinksCPU(GaugeField &outfield, const GaugeField &infield);
 
+  /**
+   * @brief Reunitarize the links of infield, writing the result to
+   * outfield.  CPU fields (QDP or MILC order) are processed by a
+   * threaded host loop.
+   *
+   * @param outfield Reunitarized gauge field
+   * @param infield Input gauge field
+   * @param fails Number of unitarity failures, accumulated (device
+   * pointer for device fields, host pointer for host fields)
+   */
   void unitarizeLinks(GaugeField &outfield, const GaugeField &infield, int *fails);
   void unitarizeLinks(GaugeField &outfield, int *fails);
 
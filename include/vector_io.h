@@ -0,0 +1,82 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <color_spinor_field.h>
+
+namespace quda
+{
+
+  /**
+     Storage formats supported by the native vector checkpoint format
+   */
+  enum VectorFileStorage {
+    VECTOR_FILE_STORAGE_DOUBLE,  // IEEE fp64
+    VECTOR_FILE_STORAGE_SINGLE,  // IEEE fp32
+    VECTOR_FILE_STORAGE_HALF,    // IEEE fp16
+    VECTOR_FILE_STORAGE_FIXED16, // 16-bit fixed point with a per-site fp32 scale
+    VECTOR_FILE_STORAGE_INVALID
+  };
+
+  /**
+     @brief Return the storage format used when saving a set of
+     vectors.  This is taken from the QUDA_VECTOR_FILE_STORAGE
+     environment variable ("double", "single", "half" or "fixed16")
+     if set, else it matches the precision of the field, promoted to
+     at least single precision.
+     @param[in] v Field that is to be saved
+     @return The storage format
+   */
+  VectorFileStorage vectorFileStorage(const ColorSpinorField &v);
+
+  /**
+     @brief Whether vectors should be saved in the native format
+     rather than through QIO.  This is always the case if QIO has not
+     been built, else it is enabled by setting the environment
+     variable QUDA_VECTOR_FILE_FORMAT=native.
+     @return Whether to use the native format when saving
+   */
+  bool useNativeVectorFile();
+
+  /**
+     @brief Query whether a file is a native QUDA vector checkpoint
+     @param[in] filename The file name
+     @return Whether the file exists and starts with the native header
+   */
+  bool isNativeVectorFile(const std::string &filename);
+
+  /**
+     @brief Save a set of vectors in the native QUDA checkpoint
+     format.  This is independent of QIO and only uses local file I/O:
+     the file consists of a header followed by one contiguous region
+     per rank, each holding a table of per-vector checksums and then
+     one page-aligned chunk per vector.  Vectors are stored in the
+     host space-spin-color order of the field, so single-parity fields
+     are saved without parity expansion.  Every rank writes its own
+     region at a fixed offset, so all ranks must see the same file.
+     @param[in] vecs The vectors to save (host or device)
+     @param[in] filename The file name
+     @param[in] storage Storage format (if invalid use vectorFileStorage)
+   */
+  void saveVectorsNative(const std::vector<ColorSpinorField *> &vecs, const std::string &filename,
+                         VectorFileStorage storage = VECTOR_FILE_STORAGE_INVALID);
+
+  /**
+     @brief Load a set of vectors from a native QUDA checkpoint.  The
+     file is memory mapped and each chunk is checksummed and then
+     copied straight from the mapping into the field.  The geometry
+     and process grid of the file must match those of the vectors.
+     @param[out] vecs The vectors to load (host or device)
+     @param[in] filename The file name
+   */
+  void loadVectorsNative(std::vector<ColorSpinorField *> &vecs, const std::string &filename);
+
+  /**
+     @brief Verify the checksums of every chunk of a native QUDA
+     checkpoint without loading it.  This must be called by all ranks.
+     @param[in] filename The file name
+     @return The number of corrupted chunks summed over all ranks
+   */
+  int verifyVectorsNative(const std::string &filename);
+
+} // namespace quda
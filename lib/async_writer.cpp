@@ -0,0 +1,75 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <async_writer.h>
+
+namespace quda {
+
+  // capacity of the job queue
+  static constexpr size_t async_queue_size = 64;
+
+  static std::array<std::function<void()>, async_queue_size> async_queue;
+  static std::atomic<size_t> async_head(0); // next job to be run, only advanced by the I/O thread
+  static std::atomic<size_t> async_tail(0); // next free slot, only advanced by the producer
+  static std::atomic<bool> async_stop(false);
+  static std::thread async_thread;
+
+  // only used to put the I/O thread to sleep when the queue is empty, the queue itself is lock free
+  static std::mutex async_mutex;
+  static std::condition_variable async_cv;
+
+  static void asyncWriterLoop()
+  {
+    while (true) {
+      size_t head = async_head.load(std::memory_order_relaxed);
+      if (head == async_tail.load(std::memory_order_acquire)) {
+        if (async_stop.load(std::memory_order_acquire)) break;
+        // the timeout guards against a wakeup lost between the check and the wait
+        std::unique_lock<std::mutex> lock(async_mutex);
+        async_cv.wait_for(lock, std::chrono::milliseconds(10));
+        continue;
+      }
+
+      std::function<void()> job = std::move(async_queue[head % async_queue_size]);
+      async_queue[head % async_queue_size] = nullptr;
+      job();
+      async_head.store(head + 1, std::memory_order_release);
+    }
+  }
+
+  void asyncWrite(std::function<void()> job)
+  {
+    if (!async_thread.joinable()) {
+      // a joinable thread must not be destroyed, so also stop it if the process exits without endQuda, e.g., on error
+      static bool registered = false;
+      if (!registered) registered = (std::atexit(asyncWriteFinalize) == 0);
+      async_stop.store(false, std::memory_order_release);
+      async_thread = std::thread(asyncWriterLoop);
+    }
+
+    size_t tail = async_tail.load(std::memory_order_relaxed);
+    while (tail - async_head.load(std::memory_order_acquire) == async_queue_size) std::this_thread::yield();
+
+    async_queue[tail % async_queue_size] = std::move(job);
+    async_tail.store(tail + 1, std::memory_order_release);
+    async_cv.notify_one();
+  }
+
+  void asyncWriteFinalize()
+  {
+    if (!async_thread.joinable()) return;
+    if (std::this_thread::get_id() == async_thread.get_id()) {
+      async_thread.detach(); // a job is exiting the process, so cannot wait for it
+      return;
+    }
+    async_stop.store(true, std::memory_order_release);
+    async_cv.notify_one();
+    async_thread.join(); // the thread drains the queue before stopping
+  }
+
+} // namespace quda
@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <complex>
+#include <vector>
+#include <sys/time.h>
+
+#include <blas_host.h>
+#include <blas_flops.h>
+
+namespace quda {
+
+  namespace hostblas {
+
+    /**
+       Number of matrices that are inverted together, interleaved such
+       that each matrix element of the group spans a cache line.
+    */
+    template <typename Float> constexpr int group_size() { return 64 / sizeof(Float); }
+
+    /**
+       @brief Invert a group of matrices, with the real and imaginary
+       parts stored in separate group-interleaved arrays, i.e., element
+       (i,j) of matrix b is at index (i*n + j)*W + b.  The pivoting is
+       done independently for each matrix, with only the row and
+       column swaps done per matrix; the elimination is vectorized over
+       the group.
+       @param[in,out] re Real part of the matrices, overwritten by the inverse
+       @param[in,out] im Imaginary part of the matrices, overwritten by the inverse
+       @param[out] perm Workspace for the pivot rows
+       @param[in] n Dimension of each matrix
+       @return Whether any of the matrices was singular
+    */
+    template <typename Float> bool invert_group(Float *re, Float *im, int *perm, const int n)
+    {
+      constexpr int W = group_size<Float>();
+      bool singular = false;
+
+      for (int k = 0; k < n; k++) {
+        // find the pivot of each matrix using the 1-norm of each element, as in LAPACK
+        Float max[W];
+        int p[W];
+        for (int b = 0; b < W; b++) {
+          max[b] = -1.0;
+          p[b] = k;
+        }
+        for (int i = k; i < n; i++) {
+          for (int b = 0; b < W; b++) {
+            Float a = std::abs(re[(i * n + k) * W + b]) + std::abs(im[(i * n + k) * W + b]);
+            if (a > max[b]) {
+              max[b] = a;
+              p[b] = i;
+            }
+          }
+        }
+
+        for (int b = 0; b < W; b++) {
+          if (max[b] == 0.0) singular = true;
+          perm[k * W + b] = p[b];
+          if (p[b] == k) continue;
+          for (int j = 0; j < n; j++) {
+            std::swap(re[(k * n + j) * W + b], re[(p[b] * n + j) * W + b]);
+            std::swap(im[(k * n + j) * W + b], im[(p[b] * n + j) * W + b]);
+          }
+        }
+        if (singular) return singular;
+
+        // scale the pivot row by the inverse pivot
+        Float *re_k = re + k * n * W;
+        Float *im_k = im + k * n * W;
+        Float inv_re[W], inv_im[W];
+        for (int b = 0; b < W; b++) {
+          Float norm = re_k[k * W + b] * re_k[k * W + b] + im_k[k * W + b] * im_k[k * W + b];
+          inv_re[b] = re_k[k * W + b] / norm;
+          inv_im[b] = -im_k[k * W + b] / norm;
+          re_k[k * W + b] = 1.0;
+          im_k[k * W + b] = 0.0;
+        }
+        for (int j = 0; j < n; j++) {
+          for (int b = 0; b < W; b++) {
+            Float r = re_k[j * W + b], i = im_k[j * W + b];
+            re_k[j * W + b] = r * inv_re[b] - i * inv_im[b];
+            im_k[j * W + b] = r * inv_im[b] + i * inv_re[b];
+          }
+        }
+
+        // eliminate the pivot column from all other rows
+        for (int i = 0; i < n; i++) {
+          if (i == k) continue;
+          Float *re_i = re + i * n * W;
+          Float *im_i = im + i * n * W;
+          Float f_re[W], f_im[W];
+          // read all the factors before zeroing them: when these are
+          // fused, GCC 12 loop distribution zeroes im_i before reading f_im
+          for (int b = 0; b < W; b++) {
+            f_re[b] = re_i[k * W + b];
+            f_im[b] = im_i[k * W + b];
+          }
+          for (int b = 0; b < W; b++) {
+            re_i[k * W + b] = 0.0;
+            im_i[k * W + b] = 0.0;
+          }
+          for (int j = 0; j < n; j++) {
+            for (int b = 0; b < W; b++) {
+              re_i[j * W + b] -= f_re[b] * re_k[j * W + b] - f_im[b] * im_k[j * W + b];
+              im_i[j * W + b] -= f_re[b] * im_k[j * W + b] + f_im[b] * re_k[j * W + b];
+            }
+          }
+        }
+      }
+
+      // undo the row interchanges by swapping the columns in reverse order
+      for (int k = n - 1; k >= 0; k--) {
+        for (int b = 0; b < W; b++) {
+          const int p = perm[k * W + b];
+          if (p == k) continue;
+          for (int i = 0; i < n; i++) {
+            std::swap(re[(i * n + k) * W + b], re[(i * n + p) * W + b]);
+            std::swap(im[(i * n + k) * W + b], im[(i * n + p) * W + b]);
+          }
+        }
+      }
+
+      return singular;
+    }
+
+    template <typename Float>
+    void BatchInvertMatrix(std::complex<Float> *Ainv, const std::complex<Float> *A, const int n, const int batch)
+    {
+      constexpr int W = group_size<Float>();
+      const int n_group = (batch + W - 1) / W;
+      const size_t nn = static_cast<size_t>(n) * n;
+      int singular = -1;
+
+#pragma omp parallel
+      {
+        std::vector<Float> re(nn * W), im(nn * W);
+        std::vector<int> perm(n * W);
+
+#pragma omp for schedule(static)
+        for (int group = 0; group < n_group; group++) {
+          const int base = group * W;
+          const int count = std::min(W, batch - base);
+
+          // transpose the group into the interleaved layout, padding with the identity
+          for (size_t e = 0; e < nn; e++) {
+            for (int b = 0; b < W; b++) {
+              std::complex<Float> a = b < count ? A[(base + b) * nn + e] : std::complex<Float>(e % (n + 1) == 0 ? 1.0 : 0.0);
+              re[e * W + b] = a.real();
+              im[e * W + b] = a.imag();
+            }
+          }
+
+          if (invert_group(re.data(), im.data(), perm.data(), n)) {
+#pragma omp critical
+            singular = base;
+          }
+
+          for (int b = 0; b < count; b++)
+            for (size_t e = 0; e < nn; e++)
+              Ainv[(base + b) * nn + e] = std::complex<Float>(re[e * W + b], im[e * W + b]);
+        }
+      }
+
+      if (singular >= 0) errorQuda("Matrix in group starting at %d is singular", singular);
+    }
+
+    long long BatchInvertMatrix(void *Ainv, void *A, const int n, const int batch, QudaPrecision prec)
+    {
+      long long flops = 0;
+      timeval start, stop;
+      gettimeofday(&start, NULL);
+
+      if (prec == QUDA_DOUBLE_PRECISION) {
+        typedef std::complex<double> C;
+        BatchInvertMatrix(static_cast<C *>(Ainv), static_cast<const C *>(A), n, batch);
+        flops += batch * (FLOPS_ZGETRF(n, n) + FLOPS_ZGETRI(n));
+      } else if (prec == QUDA_SINGLE_PRECISION) {
+        typedef std::complex<float> C;
+        BatchInvertMatrix(static_cast<C *>(Ainv), static_cast<const C *>(A), n, batch);
+        flops += batch * (FLOPS_CGETRF(n, n) + FLOPS_CGETRI(n));
+      } else {
+        errorQuda("%s not implemented for precision=%d", __func__, prec);
+      }
+
+      gettimeofday(&stop, NULL);
+      long ds = stop.tv_sec - start.tv_sec;
+      long dus = stop.tv_usec - start.tv_usec;
+      double time = ds + 0.000001 * dus;
+
+      if (getVerbosity() >= QUDA_VERBOSE)
+        printfQuda("Host batched matrix inversion completed in %f seconds with GFLOPS = %f\n", time, 1e-9 * flops / time);
+
+      return flops;
+    }
+
+    /**
+       @brief Number of real elements per rotation block, chosen such
+       that the n_in input blocks fit within a typical per-core L2
+       cache, and kept a multiple of the SIMD width.
+       @param[in] n_in Number of input vectors
+       @param[in] bytes Bytes per real element
+    */
+    inline size_t rotate_block(int n_in, size_t bytes)
+    {
+      constexpr size_t cache_bytes = 256 * 1024;
+      size_t block = cache_bytes / (n_in * bytes);
+      return std::min<size_t>(std::max<size_t>(block - block % 16, 16), 4096);
+    }
+
+    template <typename Float>
+    void RotateVectors(std::vector<Float *> &v, const double *Q_, const int n_out, const size_t parity_length,
+                       const size_t parity_stride, const int nParity)
+    {
+      // number of output vectors that are accumulated together, such that each input element is loaded once per tile
+      constexpr int tile = 4;
+      const int n_in = v.size();
+      const size_t block = rotate_block(n_in, sizeof(Float));
+      const size_t blocks_per_parity = (parity_length + block - 1) / block;
+
+      std::vector<Float> Q(Q_, Q_ + n_in * n_out);
+
+#pragma omp parallel
+      {
+        std::vector<Float> in(n_in * block), out(tile * block);
+
+#pragma omp for schedule(static)
+        for (size_t parity_block = 0; parity_block < nParity * blocks_per_parity; parity_block++) {
+          const int parity = parity_block / blocks_per_parity;
+          const size_t begin = parity * parity_stride + (parity_block - parity * blocks_per_parity) * block;
+          const size_t length = std::min(block, parity_length - (parity_block - parity * blocks_per_parity) * block);
+
+          // buffer the block of every input, since the outputs overwrite them
+          for (int j = 0; j < n_in; j++) std::copy(v[j] + begin, v[j] + begin + length, in.data() + j * block);
+
+          for (int i0 = 0; i0 < n_out; i0 += tile) {
+            const int n_tile = std::min(tile, n_out - i0);
+            std::fill(out.begin(), out.end(), static_cast<Float>(0.0));
+
+            for (int j = 0; j < n_in; j++) {
+              const Float *in_j = in.data() + j * block;
+              for (int i = 0; i < n_tile; i++) {
+                const Float q = Q[j * n_out + i0 + i];
+                Float *out_i = out.data() + i * block;
+#pragma omp simd
+                for (size_t e = 0; e < length; e++) out_i[e] += q * in_j[e];
+              }
+            }
+
+            for (int i = 0; i < n_tile; i++)
+              std::copy(out.data() + i * block, out.data() + i * block + length, v[i0 + i] + begin);
+          }
+        }
+      }
+    }
+
+    long long RotateVectors(std::vector<ColorSpinorField *> &v, const double *Q, const int n_out)
+    {
+      if (v.size() == 0 || n_out == 0) return 0;
+      if (n_out > (int)v.size()) errorQuda("Cannot rotate %lu vectors into %d vectors in place", v.size(), n_out);
+
+      const ColorSpinorField &v0 = *v[0];
+      for (auto f : v) {
+        if (f->Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Field location %d not supported", f->Location());
+        if (f->Precision() != v0.Precision()) errorQuda("Mismatched precisions %d %d", f->Precision(), v0.Precision());
+        if (f->SiteSubset() != v0.SiteSubset() || f->Length() != v0.Length())
+          errorQuda("Mismatched field lengths %lu %lu", f->Length(), v0.Length());
+      }
+
+      // the pad, if any, is skipped
+      const size_t parity_length = v0.RealLength() / v0.SiteSubset();
+      const size_t parity_stride = v0.Length() / v0.SiteSubset();
+
+      timeval start, stop;
+      gettimeofday(&start, NULL);
+
+      if (v0.Precision() == QUDA_DOUBLE_PRECISION) {
+        std::vector<double *> v_(v.size());
+        for (auto i = 0u; i < v.size(); i++) v_[i] = static_cast<double *>(v[i]->V());
+        RotateVectors(v_, Q, n_out, parity_length, parity_stride, v0.SiteSubset());
+      } else if (v0.Precision() == QUDA_SINGLE_PRECISION) {
+        std::vector<float *> v_(v.size());
+        for (auto i = 0u; i < v.size(); i++) v_[i] = static_cast<float *>(v[i]->V());
+        RotateVectors(v_, Q, n_out, parity_length, parity_stride, v0.SiteSubset());
+      } else {
+        errorQuda("%s not implemented for precision=%d", __func__, v0.Precision());
+      }
+
+      gettimeofday(&stop, NULL);
+      long ds = stop.tv_sec - start.tv_sec;
+      long dus = stop.tv_usec - start.tv_usec;
+      double time = ds + 0.000001 * dus;
+
+      long long flops = 2ll * v.size() * n_out * v0.RealLength();
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Host vector rotation completed in %f seconds with GFLOPS = %f\n", time, 1e-9 * flops / time);
+
+      return flops;
+    }
+
+  } // namespace hostblas
+
+} // namespace quda
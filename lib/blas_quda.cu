@@ -86,7 +86,7 @@ namespace quda {
 
       inline void apply(const cudaStream_t &stream)
       {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
         using namespace jitify::reflection;
         jitify_error = program->kernel("quda::blas::blasKernel")
@@ -128,8 +128,9 @@ namespace quda {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (V.Location() == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
 	if (V.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER && B[0]->FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER) {
 	  typedef FieldOrderCB<RegType,nSpin,nColor,nVec,QUDA_SPACE_SPIN_COLOR_FIELD_ORDER,vFloat,vFloat,DISABLE_GHOST> Rotator;
 	  typedef FieldOrderCB<RegType,nSpin,nColor,1,QUDA_SPACE_SPIN_COLOR_FIELD_ORDER,bFloat,bFloat,DISABLE_GHOST> Vector;
@@ -167,6 +168,11 @@ namespace quda {
 #endif
     }
 
+    QudaFieldLocation tuneLocation() const { return V.Location(); }
+
+    // on the host each loop iteration is a whole aggregate, so only small chunks are sensible
+    unsigned int maxHostChunk() const { return 64; }
+
     bool advanceTuneParam(TuneParam &param) const {
       if (V.Location() == QUDA_CUDA_FIELD_LOCATION) {
 	return advanceSharedBytes(param) || advanceAux(param);
@@ -33,7 +33,7 @@ namespace quda {
     virtual ~CloverInvert() { ; }
   
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       arg.result_h[0] = make_double2(0.,0.);
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
 #ifdef JITIFY
@@ -328,7 +328,7 @@ namespace quda {
     void apply(const cudaStream_t &stream){
       if(location == QUDA_CUDA_FIELD_LOCATION){
 	// Disable tuning for the time being
-	TuneParam tp = tuneLaunch(*this,getTuning(),getVerbosity());
+	TuneParam tp = tuneLaunch(*this,getTuning(),getVerbosity(),stream);
 
 	if(arg.kernelType == OPROD_INTERIOR_KERNEL){
 	  interiorOprodKernel<<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg);
@@ -159,7 +159,7 @@ namespace quda {
 
       void apply(const cudaStream_t &stream) {
         if(location == QUDA_CUDA_FIELD_LOCATION){
-          TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+          TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
           cloverComputeKernel<<<tp.grid,tp.block,tp.shared_bytes>>>(arg);  
         } else { // run the CPU code
           cloverComputeCPU(arg);
@@ -41,7 +41,7 @@ private:
       void apply(const cudaStream_t &stream)
       {
         if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
-          TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+          TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
           using namespace jitify::reflection;
           jitify_error = program->kernel("quda::sigmaOprodKernel")
@@ -187,7 +187,7 @@ namespace quda {
 
       void apply(const cudaStream_t &stream){
         if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
-	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
           cloverSigmaTraceKernel<Float,Arg><<<tp.grid,tp.block,0>>>(arg);
         } else {
           cloverSigmaTrace<Float,Arg>(arg);
@@ -9,6 +9,12 @@
 
 namespace quda {
 
+  static bool coarse_op_fused = true;
+
+  void setCoarseOpFused(bool fused) { coarse_op_fused = fused; }
+
+  bool coarseOpFused() { return coarse_op_fused; }
+
 #ifdef GPU_MULTIGRID
 
   template <typename Float, typename vFloat, int fineColor, int fineSpin, int coarseColor, int coarseSpin>
@@ -270,7 +276,13 @@ namespace quda {
     UVparam.setPrecision(T.Vectors(location).Precision());
     UVparam.mem_type = Y.MemType(); // allocate temporaries to match coarse-grid link field
 
-    ColorSpinorField *uv = ColorSpinorField::Create(UVparam);
+    // on the host UV and VUV are fused per aggregate, unless disabled, so the UV field is never formed
+    ColorSpinorParam uvParam(UVparam);
+    if (location == QUDA_CPU_FIELD_LOCATION && coarseOpFused()) {
+      uvParam.create = QUDA_REFERENCE_FIELD_CREATE;
+      uvParam.v = nullptr;
+    }
+    ColorSpinorField *uv = ColorSpinorField::Create(uvParam);
 
     // if we are coarsening a preconditioned clover or twisted-mass operator we need
     // an additional vector to store the cloverInv * V field, else just alias v
@@ -1,4 +1,5 @@
 #include <tune_quda.h>
+#include <multigrid.h>
 
 #include <jitify_helper.cuh>
 #include <kernels/coarse_op_kernel.cuh>
@@ -18,6 +19,7 @@ namespace quda {
     COMPUTE_CLOVER_INV_MAX,
     COMPUTE_TWISTED_CLOVER_INV_MAX,
     COMPUTE_VUV,
+    COMPUTE_UV_VUV,
     COMPUTE_COARSE_CLOVER,
     COMPUTE_REVERSE_Y,
     COMPUTE_DIAGONAL,
@@ -65,6 +67,11 @@ namespace quda {
 	// when the fine operator is truly fine the VUV multiplication is block sparse which halves the number of operations
 	flops_ = 2l * arg.fineVolumeCB * 8 * fineSpin * fineSpin * coarseColor * coarseColor * fineColor / (!from_coarse ? coarseSpin : 1);
 	break;
+      case COMPUTE_UV_VUV:
+	// sum of the UV and VUV contributions
+	flops_ = 2l * arg.fineVolumeCB * 8 * fineSpin * coarseColor * fineColor * fineColor * (!from_coarse ? 1 : fineSpin)
+	  + 2l * arg.fineVolumeCB * 8 * fineSpin * fineSpin * coarseColor * coarseColor * fineColor / (!from_coarse ? coarseSpin : 1);
+	break;
       case COMPUTE_COARSE_CLOVER:
 	// when the fine operator is truly fine the clover multiplication is block sparse which halves the number of operations
 	flops_ = 2l * arg.fineVolumeCB * 8 * fineSpin * fineSpin * coarseColor * coarseColor * fineColor * fineColor / (!from_coarse ? coarseSpin : 1);
@@ -121,6 +128,10 @@ namespace quda {
           bytes_ = 2*writes*arg.Y.Bytes() + (arg.bidirectional ? 1 : 2) * 2*writes*arg.X.Bytes() + coarseColor*(arg.UV.Bytes() + arg.V.Bytes());
           break;
         }
+      case COMPUTE_UV_VUV:
+        // UV never leaves cache and each coarse element is written once
+	bytes_ = 2*arg.V.Bytes() + arg.U.Bytes() + 2*arg.Y.Bytes() + (arg.bidirectional ? 1 : 2) * 2*arg.X.Bytes();
+	break;
       case COMPUTE_COARSE_CLOVER:
 	bytes_ = 2*arg.X.Bytes() + 2*arg.C.Bytes() + arg.V.Bytes(); // 2 from parity
 	break;
@@ -155,6 +166,7 @@ namespace quda {
       case COMPUTE_COARSE_CLOVER:
 	threads = arg.fineVolumeCB;
 	break;
+      case COMPUTE_UV_VUV:
       case COMPUTE_REVERSE_Y:
       case COMPUTE_DIAGONAL:
       case COMPUTE_TMDIAGONAL:
@@ -194,9 +206,10 @@ namespace quda {
     virtual ~CalculateY() { }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
       if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
 
 	if (type == COMPUTE_UV) {
 
@@ -277,6 +290,24 @@ namespace quda {
 	    errorQuda("Undefined direction %d", dir);
 	  }
 
+        } else if (type == COMPUTE_UV_VUV) {
+
+          arg.dim_index = 4*(dir==QUDA_BACKWARDS ? 0 : 1) + dim;
+
+          if (dir == QUDA_BACKWARDS) {
+	    if      (dim==0) ComputeUVVUVCPU<from_coarse,Float,0,QUDA_BACKWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==1) ComputeUVVUVCPU<from_coarse,Float,1,QUDA_BACKWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==2) ComputeUVVUVCPU<from_coarse,Float,2,QUDA_BACKWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==3) ComputeUVVUVCPU<from_coarse,Float,3,QUDA_BACKWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	  } else if (dir == QUDA_FORWARDS) {
+	    if      (dim==0) ComputeUVVUVCPU<from_coarse,Float,0,QUDA_FORWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==1) ComputeUVVUVCPU<from_coarse,Float,1,QUDA_FORWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==2) ComputeUVVUVCPU<from_coarse,Float,2,QUDA_FORWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	    else if (dim==3) ComputeUVVUVCPU<from_coarse,Float,3,QUDA_FORWARDS,fineSpin,fineColor,coarseSpin,coarseColor>(arg);
+	  } else {
+	    errorQuda("Undefined direction %d", dir);
+	  }
+
         } else if (type == COMPUTE_COARSE_CLOVER) {
 
           ComputeCoarseCloverCPU<from_coarse,Float,fineSpin,coarseSpin,fineColor,coarseColor>(arg);
@@ -523,6 +554,10 @@ namespace quda {
             tp.grid.x *= tp.aux.x;
           }
 
+        } else if (type == COMPUTE_UV_VUV) {
+
+          errorQuda("Fused UV-VUV computation is only supported on the host");
+
         } else if (type == COMPUTE_COARSE_CLOVER) {
 
 #ifdef JITIFY
@@ -692,6 +727,8 @@ namespace quda {
       return ( (!arg.shared_atomic && !from_coarse && type == COMPUTE_VUV) || type == COMPUTE_COARSE_CLOVER) ? false : Tunable::advanceSharedBytes(param);
     }
 
+    QudaFieldLocation tuneLocation() const { return meta.Location(); }
+
     bool advanceTuneParam(TuneParam &param) const {
       // only do autotuning if we have device fields
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION && Y.MemType() == QUDA_MEMORY_DEVICE) return Tunable::advanceTuneParam(param);
@@ -740,6 +777,7 @@ namespace quda {
       else if (type == COMPUTE_TWISTED_CLOVER_INV_MAX)
         strcat(Aux, ",computeTwistedCloverInverseMax");
       else if (type == COMPUTE_VUV)                strcat(Aux,",computeVUV");
+      else if (type == COMPUTE_UV_VUV)             strcat(Aux,",computeUVVUV");
       else if (type == COMPUTE_COARSE_CLOVER)      strcat(Aux,",computeCoarseClover");
       else if (type == COMPUTE_REVERSE_Y)          strcat(Aux,",computeYreverse");
       else if (type == COMPUTE_DIAGONAL)           strcat(Aux,",computeCoarseDiagonal");
@@ -754,7 +792,7 @@ namespace quda {
         strcat(Aux, ",Dynamic");
 #endif
 
-      if (type == COMPUTE_UV || type == COMPUTE_VUV) {
+      if (type == COMPUTE_UV || type == COMPUTE_VUV || type == COMPUTE_UV_VUV) {
         if      (dim == 0) strcat(Aux, ",dim=0");
         else if (dim == 1) strcat(Aux, ",dim=1");
         else if (dim == 2) strcat(Aux, ",dim=2");
@@ -763,13 +801,13 @@ namespace quda {
 	if (dir == QUDA_BACKWARDS) strcat(Aux,",dir=back");
 	else if (dir == QUDA_FORWARDS) strcat(Aux,",dir=fwd");
 
-        if (arg.bidirectional && type == COMPUTE_VUV) strcat(Aux,",bidirectional");
+        if (arg.bidirectional && (type == COMPUTE_VUV || type == COMPUTE_UV_VUV)) strcat(Aux,",bidirectional");
       }
 
       const char *vol_str = (type == COMPUTE_REVERSE_Y || type == COMPUTE_DIAGONAL || type == COMPUTE_TMDIAGONAL ||
                              type == COMPUTE_CONVERT || type == COMPUTE_RESCALE) ? X.VolString () : meta.VolString();
 
-      if (type == COMPUTE_VUV || type == COMPUTE_COARSE_CLOVER) {
+      if (type == COMPUTE_VUV || type == COMPUTE_UV_VUV || type == COMPUTE_COARSE_CLOVER) {
 	strcat(Aux, (meta.Location()==QUDA_CUDA_FIELD_LOCATION && Y.MemType() == QUDA_MEMORY_MAPPED) ? ",GPU-mapped," :
                meta.Location()==QUDA_CUDA_FIELD_LOCATION ? ",GPU-device," : ",CPU,");
 	strcat(Aux,"coarse_vol=");
@@ -785,6 +823,7 @@ namespace quda {
     void preTune() {
       switch (type) {
       case COMPUTE_VUV:
+      case COMPUTE_UV_VUV:
         Y_atomic.backup();
       case COMPUTE_DIAGONAL:
       case COMPUTE_TMDIAGONAL:
@@ -813,6 +852,7 @@ namespace quda {
     void postTune() {
       switch (type) {
       case COMPUTE_VUV:
+      case COMPUTE_UV_VUV:
 	Y_atomic.restore();
       case COMPUTE_DIAGONAL:
       case COMPUTE_TMDIAGONAL:
@@ -846,7 +886,7 @@ namespace quda {
 
      @param Y[out] Coarse link field accessor
      @param X[out] Coarse clover field accessor
-     @param UV[out] Temporary accessor used to store fine link field * null space vectors
+     @param UV[out] Temporary accessor used to store fine link field * null space vectors (device only)
      @param AV[out] Temporary accessor use to store fine clover inverse * null
      space vectors (only applicable when fine-grid operator is the
      preconditioned clover operator else in general this just aliases V
@@ -910,6 +950,7 @@ namespace quda {
     }
 
     //Calculate UV and then VUV for each dimension, accumulating directly into the coarse gauge field Y
+    //On the host these are fused aggregate by aggregate by default, so the UV temporary is not used
 
     typedef CalculateYArg<Float,fineSpin,coarseSpin,fineColor,coarseColor,coarseGauge,coarseGaugeAtomic,fineGauge,F,Ftmp,Vt,fineClover> Arg;
     Arg arg(Y, X, Y_atomic, X_atomic, UV, AV, G, V, C, Cinv, kappa,
@@ -1030,15 +1071,20 @@ namespace quda {
 	  if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("%d U_max = %e v_max = %e uv_max = %e\n", d, U_max, v.Scale(), uv_max);
 	}
 
-	y.setComputeType(COMPUTE_UV);  // compute U*V product
-	y.apply(0);
-	if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UV2[%d] = %e\n", d, arg.UV.norm2());
-
       // if we are writing to a temporary, we need to zero it before each computation
         if (Y_atomic.Geometry() == 1) Y_atomic_.zero();
 
-        y.setComputeType(COMPUTE_VUV); // compute Y += VUV
-	y.apply(0);
+        if (location == QUDA_CUDA_FIELD_LOCATION || !coarseOpFused()) {
+          y.setComputeType(COMPUTE_UV);  // compute U*V product
+          y.apply(0);
+          if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UV2[%d] = %e\n", d, arg.UV.norm2());
+
+          y.setComputeType(COMPUTE_VUV); // compute Y += VUV
+          y.apply(0);
+        } else {
+          y.setComputeType(COMPUTE_UV_VUV); // compute Y += VUV aggregate by aggregate with no UV temporary
+          y.apply(0);
+        }
 	if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Y2[%d] (atomic) = %e\n", 4+d, arg.Y_atomic.norm2( (4+d) % arg.Y_atomic.geometry ));
 
         // now convert from atomic to application computation format if necessary for Y[d]
@@ -1099,15 +1145,20 @@ namespace quda {
 	if (getVerbosity() >= QUDA_DEBUG_VERBOSE) printfQuda("%d U_max = %e av_max = %e uv_max = %e\n", d, U_max, av.Scale(), uv_max);
       }
 
-      y.setComputeType(COMPUTE_UV);  // compute U*A*V product
-      y.apply(0);
-      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UAV2[%d] = %e\n", d, arg.UV.norm2());
-
       // if we are writing to a temporary, we need to zero it before each computation
       if (Y_atomic.Geometry() == 1) Y_atomic_.zero();
 
-      y.setComputeType(COMPUTE_VUV); // compute Y += VUV
-      y.apply(0);
+      if (location == QUDA_CUDA_FIELD_LOCATION || !coarseOpFused()) {
+        y.setComputeType(COMPUTE_UV);  // compute U*A*V product
+        y.apply(0);
+        if (getVerbosity() >= QUDA_VERBOSE) printfQuda("UAV2[%d] = %e\n", d, arg.UV.norm2());
+
+        y.setComputeType(COMPUTE_VUV); // compute Y += VUV
+        y.apply(0);
+      } else {
+        y.setComputeType(COMPUTE_UV_VUV); // compute Y += VUV aggregate by aggregate with no UV temporary
+        y.apply(0);
+      }
       if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Y2[%d] (atomic) = %e\n", d, arg.Y_atomic.norm2( d%arg.Y_atomic.geometry ));
 
       // now convert from atomic to application computation format if necessary for Y[d]
@@ -1,5 +1,6 @@
 #include <gauge_field.h>
 #include <blas_cublas.h>
+#include <blas_host.h>
 #include <blas_quda.h>
 #include <tune_quda.h>
 
@@ -51,8 +52,9 @@ namespace quda {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
 
         if (compute_max_only)
           CalculateYhatCPU<Float, n, true, Arg>(arg);
@@ -92,6 +94,8 @@ namespace quda {
     */
     void setComputeMaxOnly(bool compute_max_only_) { compute_max_only = compute_max_only_; }
 
+    QudaFieldLocation tuneLocation() const { return meta.Location(); }
+
     // no locality in this kernel so no point in shared-memory tuning
     bool advanceSharedBytes(TuneParam &param) const { return false; }
 
@@ -144,7 +148,7 @@ namespace quda {
     } else if (X.Location() == QUDA_CPU_FIELD_LOCATION && X.Order() == QUDA_QDP_GAUGE_ORDER) {
       const cpuGaugeField *X_h = static_cast<const cpuGaugeField*>(&X);
       cpuGaugeField *Xinv_h = static_cast<cpuGaugeField*>(&Xinv);
-      blas::flops += cublas::BatchInvertMatrix(((void**)Xinv_h->Gauge_p())[0], ((void**)X_h->Gauge_p())[0], n, X_h->Volume(), X.Precision(), QUDA_CPU_FIELD_LOCATION);
+      blas::flops += hostblas::BatchInvertMatrix(((void**)Xinv_h->Gauge_p())[0], ((void**)X_h->Gauge_p())[0], n, X_h->Volume(), X.Precision());
     } else {
       errorQuda("Unsupported location=%d and order=%d", X.Location(), X.Order());
     }
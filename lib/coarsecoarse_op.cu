@@ -207,6 +207,11 @@ namespace quda {
     UVparam.setPrecision(T.Vectors(location).Precision());
     UVparam.mem_type = Y.MemType(); // allocate temporaries to match coarse-grid link field
 
+    // on the host UV and VUV are fused per aggregate, unless disabled, so the UV field is never formed
+    if (location == QUDA_CPU_FIELD_LOCATION && coarseOpFused()) {
+      UVparam.create = QUDA_REFERENCE_FIELD_CREATE;
+      UVparam.v = nullptr;
+    }
     ColorSpinorField *uv = ColorSpinorField::Create(UVparam);
 
     GaugeField *Yatomic = &Y;
@@ -8,20 +8,13 @@ namespace quda {
   using namespace colorspinor;
 
   /**
-     Random number insertion over all field elements
+     Random number insertion over all field elements.  Each random
+     source draws from a new stream of the counter-based generator, so
+     the sources are independent of the thread count and process grid.
   */
-  template <class T>
-  void random(T &t) {
-    for (int parity=0; parity<t.Nparity(); parity++) {
-      for (int x_cb=0; x_cb<t.VolumeCB(); x_cb++) {
-      	for (int s=0; s<t.Nspin(); s++) {
-      	  for (int c=0; c<t.Ncolor(); c++) {
-      	    t(parity,x_cb,s,c).real(comm_drand());
-      	    t(parity,x_cb,s,c).imag(comm_drand());
-      	  }
-      	}
-      }
-    }
+  static void random(cpuColorSpinorField &a) {
+    static unsigned int stream = 0;
+    spinorNoiseHost(a, CounterRNG(137, stream++), QUDA_NOISE_UNIFORM);
   }
 
   /**
@@ -111,7 +104,7 @@ namespace quda {
   template <typename Float, int nSpin, int nColor, QudaFieldOrder order>
   void genericSource(cpuColorSpinorField &a, QudaSourceType sourceType, int x, int s, int c) {
     FieldOrderCB<Float,nSpin,nColor,1,order> A(a);
-    if (sourceType == QUDA_RANDOM_SOURCE) random(A);
+    if (sourceType == QUDA_RANDOM_SOURCE) random(a);
     else if (sourceType == QUDA_POINT_SOURCE) point(A, x, s, c);
     else if (sourceType == QUDA_CONSTANT_SOURCE) constant(A, x, s, c);
     else if (sourceType == QUDA_SINUSOIDAL_SOURCE) sin(A, x, s, c);
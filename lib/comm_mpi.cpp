@@ -1,23 +1,14 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <climits>
+#include <vector>
 #include <algorithm>
 #include <numeric>
 #include <mpi.h>
 #include <quda_internal.h>
 #include <comm_quda.h>
-#include <mpi_comm_handle.h>
-
-#define MPI_CHECK(mpi_call) do {                    \
-  int status = mpi_call;                            \
-  if (status != MPI_SUCCESS) {                      \
-    char err_string[128];                           \
-    int err_len;                                    \
-    MPI_Error_string(status, err_string, &err_len); \
-    err_string[127] = '\0';                         \
-    errorQuda("(MPI) %s", err_string);              \
-  }                                                 \
-} while (0)
+#include <comm_mpi_common.h>
 
 struct MsgHandle_s {
   /**
@@ -53,6 +44,11 @@ void comm_gather_gpuid(int *gpuid_recv_buf) {
   MPI_CHECK(MPI_Allgather(&gpuid, 1, MPI_INT, gpuid_recv_buf, 1, MPI_INT, MPI_COMM_HANDLE));
 }
 
+void comm_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query)
+{
+  comm_mpi_gatherv(send_buf, send_bytes, recv_buf, recv_bytes, query);
+}
+
 void comm_init(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
 {
   int initialized;
@@ -231,12 +227,6 @@ int comm_query(MsgHandle *mh)
   return query;
 }
 
-template <typename T> T deterministic_reduce(T *array, int n)
-{
-  std::sort(array, array + n); // sort reduction into ascending order for deterministic reduction
-  return std::accumulate(array, array + n, 0.0);
-}
-
 void comm_allreduce(double* data)
 {
   if (!comm_deterministic_reduce()) {
@@ -244,11 +234,7 @@ void comm_allreduce(double* data)
     MPI_CHECK(MPI_Allreduce(data, &recvbuf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
     *data = recvbuf;
   } else {
-    const size_t n = comm_size();
-    double *recv_buf = (double *)safe_malloc(n * sizeof(double));
-    MPI_CHECK(MPI_Allgather(data, 1, MPI_DOUBLE, recv_buf, 1, MPI_DOUBLE, MPI_COMM_HANDLE));
-    *data = deterministic_reduce(recv_buf, n);
-    host_free(recv_buf);
+    comm_mpi_deterministic_reduce(data, 1);
   }
 }
 
@@ -275,19 +261,7 @@ void comm_allreduce_array(double* data, size_t size)
     memcpy(data, recvbuf, size * sizeof(double));
     delete[] recvbuf;
   } else {
-    size_t n = comm_size();
-    double *recv_buf = new double[size * n];
-    MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf, size, MPI_DOUBLE, MPI_COMM_HANDLE));
-
-    double *recv_trans = new double[size * n];
-    for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
-    }
-
-    for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans + i * n, n); }
-
-    delete[] recv_buf;
-    delete[] recv_trans;
+    comm_mpi_deterministic_reduce(data, size);
   }
 }
 
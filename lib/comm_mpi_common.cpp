@@ -0,0 +1,61 @@
+#include <climits>
+#include <vector>
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <reproducible_sum.h>
+#include <comm_mpi_common.h>
+
+void comm_mpi_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query)
+{
+  const int rank = comm_rank();
+  const int size = comm_size();
+
+  unsigned long long bytes = send_bytes;
+  std::vector<unsigned long long> bytes_recv(rank == 0 ? size : 0);
+  MPI_CHECK(MPI_Gather(&bytes, 1, MPI_UNSIGNED_LONG_LONG, bytes_recv.data(), 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_HANDLE));
+  if (rank == 0)
+    for (int i = 0; i < size; i++) recv_bytes[i] = bytes_recv[i];
+  if (query) return;
+
+  std::vector<int> counts(rank == 0 ? size : 0), displs(rank == 0 ? size : 0);
+  if (rank == 0) {
+    size_t offset = 0;
+    for (int i = 0; i < size; i++) {
+      if (offset + recv_bytes[i] > INT_MAX) errorQuda("Gather of %lu bytes exceeds MPI count limit", offset + recv_bytes[i]);
+      counts[i] = recv_bytes[i];
+      displs[i] = offset;
+      offset += recv_bytes[i];
+    }
+  }
+  MPI_CHECK(MPI_Gatherv(send_buf, (int)send_bytes, MPI_BYTE, recv_buf, counts.data(), displs.data(), MPI_BYTE, 0,
+                        MPI_COMM_HANDLE));
+}
+
+/**
+   MPI datatype and reduction operator for BinnedSum, used for the
+   deterministic reductions.  The operator is commutative, since the
+   binned sum is independent of the order of summation.
+ */
+static MPI_Datatype binned_sum_type = MPI_DATATYPE_NULL;
+static MPI_Op binned_sum_op = MPI_OP_NULL;
+
+static void binned_sum_reduce(void *in, void *inout, int *len, MPI_Datatype *)
+{
+  auto *a = static_cast<quda::BinnedSum *>(in);
+  auto *b = static_cast<quda::BinnedSum *>(inout);
+  for (int i = 0; i < *len; i++) b[i] += a[i];
+}
+
+void comm_mpi_deterministic_reduce(double *data, size_t size)
+{
+  if (binned_sum_op == MPI_OP_NULL) {
+    MPI_CHECK(MPI_Type_contiguous(sizeof(quda::BinnedSum), MPI_BYTE, &binned_sum_type));
+    MPI_CHECK(MPI_Type_commit(&binned_sum_type));
+    MPI_CHECK(MPI_Op_create(binned_sum_reduce, 1, &binned_sum_op));
+  }
+
+  std::vector<quda::BinnedSum> send(size), recv(size);
+  for (size_t i = 0; i < size; i++) send[i].deposit(data[i]);
+  MPI_CHECK(MPI_Allreduce(send.data(), recv.data(), size, binned_sum_type, binned_sum_op, MPI_COMM_HANDLE));
+  for (size_t i = 0; i < size; i++) data[i] = recv[i].value();
+}
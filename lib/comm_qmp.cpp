@@ -1,9 +1,11 @@
 #include <qmp.h>
 #include <algorithm>
+#include <climits>
+#include <vector>
 #include <numeric>
 #include <quda_internal.h>
 #include <comm_quda.h>
-#include <mpi_comm_handle.h>
+#include <comm_mpi_common.h>
 
 #define QMP_CHECK(qmp_call) do {                     \
   QMP_status_t status = qmp_call;                    \
@@ -11,18 +13,6 @@
     errorQuda("(QMP) %s", QMP_error_string(status)); \
 } while (0)
 
-#define MPI_CHECK(mpi_call)                                                                                            \
-  do {                                                                                                                 \
-    int status = mpi_call;                                                                                             \
-    if (status != MPI_SUCCESS) {                                                                                       \
-      char err_string[128];                                                                                            \
-      int err_len;                                                                                                     \
-      MPI_Error_string(status, err_string, &err_len);                                                                  \
-      err_string[127] = '\0';                                                                                          \
-      errorQuda("(MPI) %s", err_string);                                                                               \
-    }                                                                                                                  \
-  } while (0)
-
 struct MsgHandle_s {
   QMP_msgmem_t mem;
   QMP_msghandle_t handle;
@@ -33,10 +23,6 @@ struct MsgHandle_s {
 // performance we just call MPI directly
 #define USE_MPI_GATHER
 
-#ifdef USE_MPI_GATHER
-#include <mpi.h>
-#endif
-
 // There are more efficient ways to do the following,
 // but it doesn't really matter since this function should be
 // called just once.
@@ -82,6 +68,15 @@ void comm_gather_gpuid(int *gpuid_recv_buf) {
 #endif
 }
 
+void comm_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query)
+{
+#ifdef USE_MPI_GATHER
+  comm_mpi_gatherv(send_buf, send_bytes, recv_buf, recv_bytes, query);
+#else
+  errorQuda("comm_gatherv not supported without USE_MPI_GATHER");
+#endif
+}
+
 
 void comm_init(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
 {
@@ -220,23 +215,13 @@ int comm_query(MsgHandle *mh)
   return (QMP_is_complete(mh->handle) == QMP_TRUE);
 }
 
-template <typename T> T deterministic_reduce(T *array, int n)
-{
-  std::sort(array, array + n); // sort reduction into ascending order for deterministic reduction
-  return std::accumulate(array, array + n, 0.0);
-}
-
 void comm_allreduce(double* data)
 {
   if (!comm_deterministic_reduce()) {
     QMP_CHECK(QMP_sum_double(data));
   } else {
     // we need to break out of QMP for the deterministic floating point reductions
-    const size_t n = comm_size();
-    double *recv_buf = (double *)safe_malloc(n * sizeof(double));
-    MPI_CHECK(MPI_Allgather(data, 1, MPI_DOUBLE, recv_buf, 1, MPI_DOUBLE, MPI_COMM_HANDLE));
-    *data = deterministic_reduce(recv_buf, n);
-    host_free(recv_buf);
+    comm_mpi_deterministic_reduce(data, 1);
   }
 }
 
@@ -258,19 +243,7 @@ void comm_allreduce_array(double* data, size_t size)
     QMP_CHECK(QMP_sum_double_array(data, size));
   } else {
     // we need to break out of QMP for the deterministic floating point reductions
-    size_t n = comm_size();
-    double *recv_buf = new double[size * n];
-    MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf, size, MPI_DOUBLE, MPI_COMM_HANDLE));
-
-    double *recv_trans = new double[size * n];
-    for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
-    }
-
-    for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans + i * n, n); }
-
-    delete[] recv_buf;
-    delete[] recv_trans;
+    comm_mpi_deterministic_reduce(data, size);
   }
 }
 
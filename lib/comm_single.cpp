@@ -23,6 +23,12 @@ void comm_gather_gpuid(int *gpuid_recv_buf) {
   gpuid_recv_buf[0] = comm_gpuid();
 }
 
+void comm_gatherv(const void *send_buf, size_t send_bytes, void *recv_buf, size_t *recv_bytes, bool query)
+{
+  recv_bytes[0] = send_bytes;
+  if (!query) memcpy(recv_buf, send_buf, send_bytes);
+}
+
 MsgHandle *comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
 { return NULL; }
 
@@ -45,7 +45,7 @@ public:
     void apply(const cudaStream_t &stream)
     {
       if (x.Location() == QUDA_CUDA_FIELD_LOCATION) {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
         std::string function_name;
         switch (cType) {
@@ -69,7 +69,7 @@ public:
         }
 #endif
       } else {
-        errorQuda("CPU not supported yet\n");
+        computeContractionCPU<real>(arg, cType);
       }
     }
 
@@ -92,27 +92,106 @@ public:
     }
   };
 
+  template <typename real, typename Arg>
+  void contract_quda(Arg &arg, const ColorSpinorField &x, const ColorSpinorField &y, const QudaContractType cType)
+  {
+    Contraction<real, Arg> contraction(arg, x, y, cType);
+    contraction.apply(0);
+    if (x.Location() == QUDA_CUDA_FIELD_LOCATION) qudaDeviceSynchronize();
+  }
+
   template <typename real>
   void contract_quda(const ColorSpinorField &x, const ColorSpinorField &y, complex<real> *result,
                      const QudaContractType cType)
   {
-    ContractionArg<real> arg(x, y, result);
-    Contraction<real, ContractionArg<real>> contraction(arg, x, y, cType);
-    contraction.apply(0);
-    qudaDeviceSynchronize();
+    if (x.Location() == QUDA_CUDA_FIELD_LOCATION) {
+      ContractionArg<real> arg(x, y, result);
+      contract_quda<real>(arg, x, y, cType);
+    } else if (x.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER) {
+      typedef typename colorspinor_order_mapper<real, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, 4, 3>::type F;
+      ContractionArg<real, F> arg(x, y, result);
+      contract_quda<real>(arg, x, y, cType);
+    } else if (x.FieldOrder() == QUDA_SPACE_COLOR_SPIN_FIELD_ORDER) {
+      typedef typename colorspinor_order_mapper<real, QUDA_SPACE_COLOR_SPIN_FIELD_ORDER, 4, 3>::type F;
+      ContractionArg<real, F> arg(x, y, result);
+      contract_quda<real>(arg, x, y, cType);
+    } else {
+      errorQuda("Field order %d not supported on CPU", x.FieldOrder());
+    }
   }
 
-#endif
+  template <typename real, QudaFieldOrder order>
+  void contract_momentum_cpu(const ColorSpinorField &x, const ColorSpinorField &y, complex<double> *result,
+                             const QudaContractType cType, const complex<double> *phase, int n_mom)
+  {
+    typedef typename colorspinor_order_mapper<real, order, 4, 3>::type F;
+    ContractionProjectArg<real, F> arg(x, y, nullptr, n_mom, phase, result);
+    computeProjectedContractionCPU<real>(arg, cType);
+  }
 
-  void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, const QudaContractType cType)
+  /**
+     @brief Momentum-projected contraction of the local lattice.  On
+     the device the site contractions are written to a temporary
+     buffer that is then projected, with only the projected result
+     transferred to the host.  On the host the projection is fused
+     with the contraction.
+     @param[out] result Host array of local time slices x momenta x 16
+     @param[in] phase Host phase table (see ContractionProjectArg)
+  */
+  template <typename real>
+  void contract_momentum_quda(const ColorSpinorField &x, const ColorSpinorField &y, complex<double> *result,
+                              const QudaContractType cType, const std::vector<complex<double>> &phase, int n_mom)
+  {
+    constexpr int n_gamma = 16;
+    const size_t result_bytes = x.X(3) * n_mom * n_gamma * sizeof(complex<double>);
+
+    if (x.Location() == QUDA_CUDA_FIELD_LOCATION) {
+      auto *s = static_cast<complex<real> *>(pool_device_malloc(x.Volume() * n_gamma * sizeof(complex<real>)));
+      auto *phase_d = static_cast<complex<double> *>(pool_device_malloc(phase.size() * sizeof(complex<double>)));
+      auto *result_d = static_cast<complex<double> *>(pool_device_malloc(result_bytes));
+      qudaMemcpy(phase_d, phase.data(), phase.size() * sizeof(complex<double>), cudaMemcpyHostToDevice);
+
+      ContractionProjectArg<real> arg(x, y, s, n_mom, phase_d, result_d);
+      Contraction<real, ContractionProjectArg<real>> contraction(arg, x, y, cType);
+      contraction.apply(0);
+
+      constexpr int block_size = 128;
+      computeMomentumProjection<block_size, real><<<dim3(x.X(3), n_mom), block_size>>>(arg);
+      qudaMemcpy(result, result_d, result_bytes, cudaMemcpyDeviceToHost);
+
+      pool_device_free(result_d);
+      pool_device_free(phase_d);
+      pool_device_free(s);
+    } else if (x.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER) {
+      contract_momentum_cpu<real, QUDA_SPACE_SPIN_COLOR_FIELD_ORDER>(x, y, result, cType, phase.data(), n_mom);
+    } else if (x.FieldOrder() == QUDA_SPACE_COLOR_SPIN_FIELD_ORDER) {
+      contract_momentum_cpu<real, QUDA_SPACE_COLOR_SPIN_FIELD_ORDER>(x, y, result, cType, phase.data(), n_mom);
+    } else {
+      errorQuda("Field order %d not supported on CPU", x.FieldOrder());
+    }
+  }
+
+  // check the fields are of the form the contraction kernels expect
+  static void checkContractFields(const ColorSpinorField &x, const ColorSpinorField &y)
   {
-#ifdef GPU_CONTRACT
     checkPrecision(x, y);
+    checkLocation(x, y);
 
     if (x.GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS || y.GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS)
       errorQuda("Unexpected gamma basis x=%d y=%d", x.GammaBasis(), y.GammaBasis());
     if (x.Ncolor() != 3 || y.Ncolor() != 3) errorQuda("Unexpected number of colors x=%d y=%d", x.Ncolor(), y.Ncolor());
     if (x.Nspin() != 4 || y.Nspin() != 4) errorQuda("Unexpected number of spins x=%d y=%d", x.Nspin(), y.Nspin());
+    if (x.SiteSubset() != QUDA_FULL_SITE_SUBSET) errorQuda("Unexpected site subset %d", x.SiteSubset());
+    if (x.Location() == QUDA_CPU_FIELD_LOCATION && x.FieldOrder() != y.FieldOrder())
+      errorQuda("Mismatched field orders x=%d y=%d", x.FieldOrder(), y.FieldOrder());
+  }
+
+#endif
+
+  void contractQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result, const QudaContractType cType)
+  {
+#ifdef GPU_CONTRACT
+    checkContractFields(x, y);
 
     if (x.Precision() == QUDA_SINGLE_PRECISION) {
       contract_quda<float>(x, y, (complex<float> *)result, cType);
@@ -122,6 +201,51 @@ public:
       errorQuda("Precision %d not supported", x.Precision());
     }
 
+#else
+    errorQuda("Contraction code has not been built");
+#endif
+  }
+
+  void contractMomentumQuda(const ColorSpinorField &x, const ColorSpinorField &y, void *result,
+                            const QudaContractType cType, const int *mom, int n_mom)
+  {
+#ifdef GPU_CONTRACT
+    checkContractFields(x, y);
+    if (n_mom <= 0) errorQuda("Invalid number of momenta %d", n_mom);
+
+    // phases of the global spatial coordinates, e^{2 pi i n_d x_d / L_d}
+    const int stride = x.X(0) + x.X(1) + x.X(2);
+    std::vector<complex<double>> phase(n_mom * stride);
+    for (int m = 0; m < n_mom; m++) {
+      for (int d = 0, offset = 0; d < 3; offset += x.X(d), d++) {
+        const int L = x.X(d) * comm_dim(d);
+        for (int x_d = 0; x_d < x.X(d); x_d++) {
+          // reduce the product modulo L to keep the argument small
+          const long n_x = (static_cast<long>(mom[3 * m + d]) * (comm_coord(d) * x.X(d) + x_d)) % L;
+          const double theta = 2.0 * M_PI * n_x / L;
+          phase[m * stride + offset + x_d] = complex<double>(cos(theta), sin(theta));
+        }
+      }
+    }
+
+    // each process fills its own time slices of the global result
+    constexpr int n_gamma = 16;
+    const int nt = x.X(3);
+    const size_t n_local = nt * n_mom * n_gamma;
+    const size_t n_global = n_local * comm_dim(3);
+    auto *result_ = static_cast<complex<double> *>(result);
+    for (size_t i = 0; i < n_global; i++) result_[i] = 0.0;
+
+    complex<double> *local = result_ + comm_coord(3) * n_local;
+    if (x.Precision() == QUDA_SINGLE_PRECISION) {
+      contract_momentum_quda<float>(x, y, local, cType, phase, n_mom);
+    } else if (x.Precision() == QUDA_DOUBLE_PRECISION) {
+      contract_momentum_quda<double>(x, y, local, cType, phase, n_mom);
+    } else {
+      errorQuda("Precision %d not supported", x.Precision());
+    }
+
+    comm_allreduce_array(reinterpret_cast<double *>(result_), 2 * n_global);
 #else
     errorQuda("Contraction code has not been built");
 #endif
@@ -79,7 +79,7 @@ namespace quda {
     virtual ~CopyClover() { ; }
   
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       copyCloverKernel<FloatOut, FloatIn, length, Out, In> 
 	<<<tp.grid, tp.block, tp.shared_bytes, stream>>>(arg);
     }
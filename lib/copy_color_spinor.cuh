@@ -118,19 +118,24 @@ namespace quda {
     }
   };
 
-  /** CPU function to reorder spinor fields.  */
+  /**
+     CPU function to reorder spinor fields.  The parity and site loops
+     are fused into a single OpenMP loop, so that each thread streams
+     over a contiguous run of sites (the tuned chunk) of both fields.
+  */
   template <typename FloatOut, typename FloatIn, int Ns, int Nc, typename Arg, typename Basis>
   void copyColorSpinor(Arg &arg, const Basis &basis) {
     typedef typename mapper<FloatIn>::type RegTypeIn;
     typedef typename mapper<FloatOut>::type RegTypeOut;
 
-    for (int parity = 0; parity<arg.nParity; parity++) {
-      for (int x=0; x<arg.volumeCB; x++) {
-	ColorSpinor<RegTypeIn, Nc, Ns> in = arg.in(x, (parity+arg.inParity)&1);
-	ColorSpinor<RegTypeOut, Nc, Ns> out;
-	basis(out.data, in.data);
-	arg.out(x, (parity+arg.outParity)&1) = out;
-      }
+#pragma omp parallel for schedule(runtime)
+    for (int x_parity = 0; x_parity < arg.nParity * arg.volumeCB; x_parity++) {
+      const int parity = x_parity / arg.volumeCB;
+      const int x = x_parity - parity * arg.volumeCB;
+      ColorSpinor<RegTypeIn, Nc, Ns> in = arg.in(x, (parity+arg.inParity)&1);
+      ColorSpinor<RegTypeOut, Nc, Ns> out;
+      basis(out.data, in.data);
+      arg.out(x, (parity+arg.outParity)&1) = out;
     }
   }
 
@@ -161,27 +166,33 @@ namespace quda {
     unsigned int sharedBytesPerBlock(const TuneParam &param) const { return 0; }
     bool advanceSharedBytes(TuneParam &param) const { return false; } // Don't tune shared mem
     bool tuneGridDim() const { return false; } // Don't tune the grid dimensions.
-    unsigned int minThreads() const { return meta.VolumeCB(); }
+    unsigned int minThreads() const
+    {
+      return location == QUDA_CPU_FIELD_LOCATION ? arg.nParity * meta.VolumeCB() : meta.VolumeCB();
+    }
 
   public:
     CopyColorSpinor(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in,
 		    QudaFieldLocation location)
       : TunableVectorY(arg.nParity), arg(arg), meta(in), location(location) {
       if (out.GammaBasis()!=in.GammaBasis()) errorQuda("Cannot change gamma basis for nSpin=%d\n", Ns);
-      writeAuxString("out_stride=%d,in_stride=%d", arg.out.stride, arg.in.stride);
+      writeAuxString("%sout_stride=%d,in_stride=%d", compile_type_str(in, location), arg.out.stride, arg.in.stride);
     }
     virtual ~CopyColorSpinor() { ; }
   
     void apply(const cudaStream_t &stream) {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (location == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
 	copyColorSpinor<FloatOut, FloatIn, Ns, Nc>(arg, PreserveBasis<Ns,Nc>());
       } else {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
 	copyColorSpinorKernel<FloatOut, FloatIn, Ns, Nc>
 	  <<<tp.grid, tp.block, tp.shared_bytes, stream>>> (arg, PreserveBasis<Ns,Nc>());
       }
     }
 
+    QudaFieldLocation tuneLocation() const { return location; }
+
     TuneKey tuneKey() const { return TuneKey(meta.VolString(), typeid(*this).name(), aux); }
     long long flops() const { return 0; } 
     long long bytes() const { return arg.in.Bytes() + arg.out.Bytes(); }
@@ -200,7 +211,10 @@ namespace quda {
     unsigned int sharedBytesPerBlock(const TuneParam &param) const { return 0; }
     bool advanceSharedBytes(TuneParam &param) const { return false; } // Don't tune shared mem
     bool tuneGridDim() const { return false; } // Don't tune the grid dimensions.
-    unsigned int minThreads() const { return in.VolumeCB(); }
+    unsigned int minThreads() const
+    {
+      return location == QUDA_CPU_FIELD_LOCATION ? arg.nParity * in.VolumeCB() : in.VolumeCB();
+    }
 
   public:
     CopyColorSpinor(Arg &arg, const ColorSpinorField &out, const ColorSpinorField &in,
@@ -208,15 +222,15 @@ namespace quda {
       : TunableVectorY(arg.nParity), arg(arg), out(out), in(in), location(location) {
 
       if (out.GammaBasis()==in.GammaBasis()) {
-	writeAuxString("out_stride=%d,in_stride=%d,PreserveBasis", arg.out.stride, arg.in.stride);
+	writeAuxString("%sout_stride=%d,in_stride=%d,PreserveBasis", compile_type_str(in, location), arg.out.stride, arg.in.stride);
       } else if (out.GammaBasis() == QUDA_UKQCD_GAMMA_BASIS && in.GammaBasis() == QUDA_DEGRAND_ROSSI_GAMMA_BASIS) {
-	writeAuxString("out_stride=%d,in_stride=%d,NonRelBasis", arg.out.stride, arg.in.stride);
+	writeAuxString("%sout_stride=%d,in_stride=%d,NonRelBasis", compile_type_str(in, location), arg.out.stride, arg.in.stride);
       } else if (in.GammaBasis() == QUDA_UKQCD_GAMMA_BASIS && out.GammaBasis() == QUDA_DEGRAND_ROSSI_GAMMA_BASIS) {
-	writeAuxString("out_stride=%d,in_stride=%d,RelBasis", arg.out.stride, arg.in.stride);
+	writeAuxString("%sout_stride=%d,in_stride=%d,RelBasis", compile_type_str(in, location), arg.out.stride, arg.in.stride);
       } else if (out.GammaBasis() == QUDA_UKQCD_GAMMA_BASIS && in.GammaBasis() == QUDA_CHIRAL_GAMMA_BASIS) {
-	writeAuxString("out_stride=%d,in_stride=%d,ChiralToNonRelBasis", arg.out.stride, arg.in.stride);
+	writeAuxString("%sout_stride=%d,in_stride=%d,ChiralToNonRelBasis", compile_type_str(in, location), arg.out.stride, arg.in.stride);
       } else if (in.GammaBasis() == QUDA_UKQCD_GAMMA_BASIS && out.GammaBasis() == QUDA_CHIRAL_GAMMA_BASIS) {
-	writeAuxString("out_stride=%d,in_stride=%d,NonRelToChiralBasis", arg.out.stride, arg.in.stride);
+	writeAuxString("%sout_stride=%d,in_stride=%d,NonRelToChiralBasis", compile_type_str(in, location), arg.out.stride, arg.in.stride);
       } else {
 	errorQuda("Basis change from %d to %d not supported", in.GammaBasis(), out.GammaBasis());
       }
@@ -224,7 +238,9 @@ namespace quda {
     virtual ~CopyColorSpinor() { ; }
 
     void apply(const cudaStream_t &stream) {
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (location == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
 	if (out.GammaBasis()==in.GammaBasis()) {
 	  copyColorSpinor<FloatOut, FloatIn, Ns, Nc>(arg, PreserveBasis<Ns,Nc>());
 	} else if (out.GammaBasis() == QUDA_UKQCD_GAMMA_BASIS && in.GammaBasis() == QUDA_DEGRAND_ROSSI_GAMMA_BASIS) {
@@ -237,7 +253,6 @@ namespace quda {
 	  copyColorSpinor<FloatOut, FloatIn, Ns, Nc>(arg, NonRelToChiralBasis<Ns,Nc>());
 	}
       } else {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
 	if (out.GammaBasis()==in.GammaBasis()) {
 	  copyColorSpinorKernel<FloatOut, FloatIn, Ns, Nc>
 	    <<<tp.grid, tp.block, tp.shared_bytes, stream>>> (arg, PreserveBasis<Ns,Nc>());
@@ -257,6 +272,8 @@ namespace quda {
       }
     }
 
+    QudaFieldLocation tuneLocation() const { return location; }
+
     TuneKey tuneKey() const { return TuneKey(in.VolString(), typeid(*this).name(), aux); }
     long long flops() const { return 0; }
     long long bytes() const { return arg.in.Bytes() + arg.out.Bytes(); }
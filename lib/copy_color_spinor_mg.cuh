@@ -66,7 +66,7 @@ namespace quda {
       if (location == QUDA_CPU_FIELD_LOCATION) {
 	packSpinor<FloatOut, FloatIn, Ns, Nc>(out, in, meta.VolumeCB());
       } else {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	packSpinorKernel<FloatOut, FloatIn, Ns, Nc, OutOrder, InOrder>
 	  <<<tp.grid, tp.block, tp.shared_bytes, stream>>>
 	  (out, in, meta.VolumeCB());
@@ -128,7 +128,7 @@ namespace quda {
     virtual ~CopyGaugeEx() { ; }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
       if (location == QUDA_CPU_FIELD_LOCATION) {
 	if(arg.regularToextended) copyGaugeEx<FloatOut, FloatIn, length, OutOrder, InOrder, true>(arg);
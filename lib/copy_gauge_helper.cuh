@@ -20,11 +20,10 @@ namespace quda {
     unsigned int sharedBytesPerBlock(const TuneParam &param) const { return 0 ;}
 
     bool tuneGridDim() const { return false; } // Don't tune the grid dimensions.
-    unsigned int minThreads() const { return size; }
-
-    bool advanceTuneParam(TuneParam &param) const {
-      // only do autotuning if we are doing the copy on the GPU
-      return location == QUDA_CUDA_FIELD_LOCATION ? TunableVectorYZ::advanceTuneParam(param) : false;
+    unsigned int minThreads() const
+    {
+      // the CPU body copy is threaded over tiles of sites
+      return (location == QUDA_CPU_FIELD_LOCATION && !is_ghost) ? copyTiles(arg) : size;
     }
 
 public:
@@ -80,8 +79,9 @@ public:
     virtual ~CopyGauge() { ; }
   
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (location == QUDA_CPU_FIELD_LOCATION) {
+        HostLaunch launch(tp);
         if (!is_ghost) {
           copyGauge<FloatOut, FloatIn, length>(arg);
         } else {
@@ -107,6 +107,8 @@ public:
       }
     }
 
+    QudaFieldLocation tuneLocation() const { return location; }
+
     TuneKey tuneKey() const {
       char aux_[TuneKey::aux_n];
       strcpy(aux_,aux);
@@ -16,6 +16,13 @@ namespace quda {
 
   size_t cpuColorSpinorField::ghostFaceBytes[QUDA_MAX_DIM] = { };
 
+  MsgHandle *cpuColorSpinorField::fwdGhostSendHandle[QUDA_MAX_DIM] = { };
+  MsgHandle *cpuColorSpinorField::backGhostSendHandle[QUDA_MAX_DIM] = { };
+  MsgHandle *cpuColorSpinorField::fwdGhostRecvHandle[QUDA_MAX_DIM] = { };
+  MsgHandle *cpuColorSpinorField::backGhostRecvHandle[QUDA_MAX_DIM] = { };
+  size_t cpuColorSpinorField::ghostHandleBytes[QUDA_MAX_DIM] = { };
+  bool cpuColorSpinorField::ghostExchangeActive[QUDA_MAX_DIM] = { };
+
   cpuColorSpinorField::cpuColorSpinorField(const ColorSpinorParam &param) :
     ColorSpinorField(param), init(false), reference(false) {
 
@@ -286,6 +293,17 @@ namespace quda {
   {
     if(!initGhostFaceBuffer) return;
 
+    // the message handles refer to the buffers so must go with them
+    for (int i = 0; i < QUDA_MAX_DIM; i++) {
+      if (ghostExchangeActive[i]) errorQuda("Freeing ghost buffers with a halo exchange in flight");
+      if (!ghostHandleBytes[i]) continue;
+      comm_free(fwdGhostSendHandle[i]);
+      comm_free(backGhostSendHandle[i]);
+      comm_free(fwdGhostRecvHandle[i]);
+      comm_free(backGhostRecvHandle[i]);
+      ghostHandleBytes[i] = 0;
+    }
+
     for(int i=0; i < 4; i++){  // make nDimComms static?
       host_free(fwdGhostFaceBuffer[i]); fwdGhostFaceBuffer[i] = NULL;
       host_free(backGhostFaceBuffer[i]); backGhostFaceBuffer[i] = NULL;
@@ -313,11 +331,19 @@ namespace quda {
   void cpuColorSpinorField::exchangeGhost(QudaParity parity, int nFace, int dagger, const MemoryLocation *dummy1,
 					  const MemoryLocation *dummy2, bool dummy3, bool dummy4, QudaPrecision dummy5) const
   {
+    exchangeGhostStart(parity, nFace, dagger);
+    exchangeGhostWait();
+  }
+
+  void cpuColorSpinorField::exchangeGhostStart(QudaParity parity, int nFace, int dagger) const
+  {
+    for (int i=0; i<nDimComms; i++)
+      if (ghostExchangeActive[i]) errorQuda("Halo exchange already in flight in dimension %d", i);
+
     // allocate ghost buffer if not yet allocated
     allocateGhostBuffer(nFace);
 
-    void **sendbuf = static_cast<void**>(safe_malloc(nDimComms * 2 * sizeof(void*)));
-
+    void *sendbuf[2 * QUDA_MAX_DIM];
     for (int i=0; i<nDimComms; i++) {
       sendbuf[2*i + 0] = backGhostFaceSendBuffer[i];
       sendbuf[2*i + 1] = fwdGhostFaceSendBuffer[i];
@@ -327,9 +353,51 @@ namespace quda {
 
     packGhost(sendbuf, parity, nFace, dagger);
 
-    exchange(ghost_buf, sendbuf, nFace);
+    const int Ninternal = 2*nColor*nSpin;
+    for (int i=0; i<nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      size_t bytes = siteSubset*nFace*surfaceCB[i]*Ninternal*precision;
+
+      if (bytes != ghostHandleBytes[i]) {
+        if (ghostHandleBytes[i]) {
+          comm_free(fwdGhostSendHandle[i]);
+          comm_free(backGhostSendHandle[i]);
+          comm_free(fwdGhostRecvHandle[i]);
+          comm_free(backGhostRecvHandle[i]);
+        }
+        fwdGhostSendHandle[i] = comm_declare_send_relative(fwdGhostFaceSendBuffer[i], i, +1, bytes);
+        backGhostSendHandle[i] = comm_declare_send_relative(backGhostFaceSendBuffer[i], i, -1, bytes);
+        fwdGhostRecvHandle[i] = comm_declare_receive_relative(fwdGhostFaceBuffer[i], i, +1, bytes);
+        backGhostRecvHandle[i] = comm_declare_receive_relative(backGhostFaceBuffer[i], i, -1, bytes);
+        ghostHandleBytes[i] = bytes;
+      }
+    }
 
-    host_free(sendbuf);
+    // post every receive before any send, then leave all of them in flight
+    for (int i=0; i<nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      comm_start(backGhostRecvHandle[i]);
+      comm_start(fwdGhostRecvHandle[i]);
+    }
+
+    for (int i=0; i<nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      comm_start(fwdGhostSendHandle[i]);
+      comm_start(backGhostSendHandle[i]);
+      ghostExchangeActive[i] = true;
+    }
+  }
+
+  void cpuColorSpinorField::exchangeGhostWait() const
+  {
+    for (int i=0; i<nDimComms; i++) {
+      if (!ghostExchangeActive[i]) continue;
+      comm_wait(fwdGhostSendHandle[i]);
+      comm_wait(backGhostSendHandle[i]);
+      comm_wait(backGhostRecvHandle[i]);
+      comm_wait(fwdGhostRecvHandle[i]);
+      ghostExchangeActive[i] = false;
+    }
   }
 
 } // namespace quda
@@ -3,11 +3,13 @@
 #include <assert.h>
 #include <string.h>
 #include <typeinfo>
+#include <array>
+#include <map>
 
 namespace quda {
 
   cpuGaugeField::cpuGaugeField(const GaugeFieldParam &param) :
-    GaugeField(param)
+    GaugeField(param), ghost_send{}
   {
     if (precision == QUDA_HALF_PRECISION) {
       errorQuda("CPU fields do not support half precision");
@@ -129,6 +131,18 @@ namespace quda {
 	if (ghost[i+4] && geometry == QUDA_COARSE_GEOMETRY) host_free(ghost[i+4]);
       }
     }
+
+    for (int i=0; i<2*QUDA_MAX_DIM; i++) if (ghost_send[i]) host_free(ghost_send[i]);
+  }
+
+  void **cpuGaugeField::ghostSendBuffer()
+  {
+    for (int d=0; d<nDim; d++) {
+      size_t nbytes = nFace*surface[d]*nInternal*precision;
+      if (!ghost_send[d]) ghost_send[d] = safe_malloc(nbytes);
+      if (geometry == QUDA_COARSE_GEOMETRY && !ghost_send[d+4]) ghost_send[d+4] = safe_malloc(nbytes);
+    }
+    return ghost_send;
   }
 
   // This does the exchange of the gauge field ghost zone and places it
@@ -140,11 +154,7 @@ namespace quda {
     if ( (link_direction == QUDA_LINK_BIDIRECTIONAL || link_direction == QUDA_LINK_FORWARDS) && geometry != QUDA_COARSE_GEOMETRY)
       errorQuda("Cannot request exchange of forward links on non-coarse geometry");
 
-    void *send[2*QUDA_MAX_DIM];
-    for (int d=0; d<nDim; d++) {
-      send[d] = safe_malloc(nFace*surface[d]*nInternal*precision);
-      if (geometry == QUDA_COARSE_GEOMETRY) send[d+4] = safe_malloc(nFace*surface[d]*nInternal*precision);
-    }
+    void **send = ghostSendBuffer();
 
     if (link_direction == QUDA_LINK_BACKWARDS || link_direction == QUDA_LINK_BIDIRECTIONAL) {
       // get the links into contiguous buffers
@@ -159,8 +169,6 @@ namespace quda {
       extractGaugeGhost(*this, send, true, nDim);
       exchange(ghost+nDim, send+nDim, QUDA_FORWARDS);
     }
-
-    for (int d=0; d<geometry; d++) host_free(send[d]);
   }
 
   // This does the opposite of exchangeGhost and sends back the ghost
@@ -173,75 +181,126 @@ namespace quda {
     if (link_direction != QUDA_LINK_BACKWARDS)
       errorQuda("link_direction = %d not supported", link_direction);
 
-    void *recv[QUDA_MAX_DIM];
-    for (int d=0; d<nDim; d++) recv[d] = safe_malloc(nFace*surface[d]*nInternal*precision);
+    void **recv = ghostSendBuffer();
 
     // communicate between nodes
     exchange(recv, ghost, QUDA_BACKWARDS);
 
     // get the links into contiguous buffers
     extractGaugeGhost(*this, recv, false);
+  }
 
-    for (int d=0; d<nDim; d++) host_free(recv[d]);
+  /**
+     Comms buffers and persistent message handles used by the extended
+     ghost exchange.  These are cached for each combination of field
+     dimensions, extension radius, geometry and precision, so repeated
+     exchanges (e.g., when smearing) do no allocation.  The backwards
+     face of each dimension is stored first, then the forwards face.
+  */
+  struct ExtendedGhostComms {
+    size_t bytes[QUDA_MAX_DIM] = {};
+    void *send[QUDA_MAX_DIM] = {};
+    void *recv[QUDA_MAX_DIM] = {};
+    MsgHandle *mh_recv_back[QUDA_MAX_DIM] = {};
+    MsgHandle *mh_recv_fwd[QUDA_MAX_DIM] = {};
+    MsgHandle *mh_send_back[QUDA_MAX_DIM] = {};
+    MsgHandle *mh_send_fwd[QUDA_MAX_DIM] = {};
+  };
+
+  using ExtendedGhostKey = std::array<int, 11>;
+  static std::map<ExtendedGhostKey, ExtendedGhostComms> extended_ghost_comms;
+
+  static ExtendedGhostComms &extendedGhostComms(const ExtendedGhostKey &key, const size_t *bytes, const int *R, int nDim)
+  {
+    auto it = extended_ghost_comms.find(key);
+    if (it != extended_ghost_comms.end()) return it->second;
+
+    ExtendedGhostComms &comms = extended_ghost_comms[key];
+    for (int d = 0; d < nDim; d++) {
+      if (!(comm_dim_partitioned(d) || R[d])) continue;
+      comms.bytes[d] = bytes[d];
+      comms.send[d] = safe_malloc(2 * comms.bytes[d]);
+      comms.recv[d] = safe_malloc(2 * comms.bytes[d]);
+
+      if (comm_dim_partitioned(d)) {
+        comms.mh_recv_back[d] = comm_declare_receive_relative(comms.recv[d], d, -1, comms.bytes[d]);
+        comms.mh_recv_fwd[d] = comm_declare_receive_relative(static_cast<char *>(comms.recv[d]) + comms.bytes[d],
+                                                             d, +1, comms.bytes[d]);
+        comms.mh_send_back[d] = comm_declare_send_relative(comms.send[d], d, -1, comms.bytes[d]);
+        comms.mh_send_fwd[d] = comm_declare_send_relative(static_cast<char *>(comms.send[d]) + comms.bytes[d],
+                                                          d, +1, comms.bytes[d]);
+      }
+    }
+    return comms;
   }
 
-  void cpuGaugeField::exchangeExtendedGhost(const int *R, bool no_comms_fill) {
-    
-    void *send[QUDA_MAX_DIM];
-    void *recv[QUDA_MAX_DIM];
-    size_t bytes[QUDA_MAX_DIM];
-    // store both parities and directions in each
-    for (int d=0; d<nDim; d++) {
-      if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d])) ) continue;
-      bytes[d] = surface[d] * R[d] * geometry * nInternal * precision;
-      send[d] = safe_malloc(2 * bytes[d]);
-      recv[d] = safe_malloc(2 * bytes[d]);
+  void cpuGaugeField::freeExtendedGhostBuffer()
+  {
+    for (auto &entry : extended_ghost_comms) {
+      ExtendedGhostComms &comms = entry.second;
+      for (int d = 0; d < QUDA_MAX_DIM; d++) {
+        if (comms.mh_recv_back[d]) {
+          comm_free(comms.mh_recv_back[d]);
+          comm_free(comms.mh_recv_fwd[d]);
+          comm_free(comms.mh_send_back[d]);
+          comm_free(comms.mh_send_fwd[d]);
+        }
+        if (comms.send[d]) host_free(comms.send[d]);
+        if (comms.recv[d]) host_free(comms.recv[d]);
+      }
     }
+    extended_ghost_comms.clear();
+  }
 
-    for (int d=0; d<nDim; d++) {
-      if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d])) ) continue;
-      //extract into a contiguous buffer
-      extractExtendedGaugeGhost(*this, d, R, send, true);
+  void cpuGaugeField::exchangeExtendedGhost(const int *R, bool no_comms_fill) {
+
+    int active[QUDA_MAX_DIM];
+    int n_active = 0;
+    for (int d=0; d<nDim; d++)
+      if (comm_dim_partitioned(d) || (no_comms_fill && R[d])) active[n_active++] = d;
+    if (n_active == 0) return;
+
+    // store both parities and directions in each
+    size_t bytes[QUDA_MAX_DIM];
+    for (int d=0; d<nDim; d++) bytes[d] = surface[d] * R[d] * geometry * nInternal * precision;
+    ExtendedGhostKey key = {x[0], x[1], x[2], x[3], R[0], R[1], R[2], R[3], geometry, precision, nInternal};
+    ExtendedGhostComms &comms = extendedGhostComms(key, bytes, R, nDim);
+
+    // The face of each dimension spans the extended region of the
+    // dimensions before it, so it picks up the corners injected by
+    // the earlier exchanges.  The dimensions are pipelined: while the
+    // halo of one dimension is in flight we pack the part of the next
+    // face that does not overlap that halo, and only the corners that
+    // do are packed after it has been injected.
+    extractExtendedGaugeGhost(*this, active[0], R, comms.send, true);
+
+    for (int i=0; i<n_active; i++) {
+      const int d = active[i];
+      const int next = i + 1 < n_active ? active[i + 1] : -1;
 
       if (comm_dim_partitioned(d)) {
-	// do the exchange
-	MsgHandle *mh_recv_back;
-	MsgHandle *mh_recv_fwd;
-	MsgHandle *mh_send_fwd;
-	MsgHandle *mh_send_back;
-	
-	mh_recv_back = comm_declare_receive_relative(recv[d], d, -1, bytes[d]);
-	mh_recv_fwd  = comm_declare_receive_relative(((char*)recv[d])+bytes[d], d, +1, bytes[d]);
-	mh_send_back = comm_declare_send_relative(send[d], d, -1, bytes[d]);
-	mh_send_fwd  = comm_declare_send_relative(((char*)send[d])+bytes[d], d, +1, bytes[d]);
-	
-	comm_start(mh_recv_back);
-	comm_start(mh_recv_fwd);
-	comm_start(mh_send_fwd);
-	comm_start(mh_send_back);
-	
-	comm_wait(mh_send_fwd);
-	comm_wait(mh_send_back);
-	comm_wait(mh_recv_back);
-	comm_wait(mh_recv_fwd);
-	
-	comm_free(mh_send_fwd);
-	comm_free(mh_send_back);
-	comm_free(mh_recv_back);
-	comm_free(mh_recv_fwd);
+	comm_start(comms.mh_recv_back[d]);
+	comm_start(comms.mh_recv_fwd[d]);
+	comm_start(comms.mh_send_fwd[d]);
+	comm_start(comms.mh_send_back[d]);
       } else {
-	memcpy(static_cast<char*>(recv[d])+bytes[d], send[d], bytes[d]);
-	memcpy(recv[d], static_cast<char*>(send[d])+bytes[d], bytes[d]);
-      }      
+	memcpy(static_cast<char*>(comms.recv[d])+comms.bytes[d], comms.send[d], comms.bytes[d]);
+	memcpy(comms.recv[d], static_cast<char*>(comms.send[d])+comms.bytes[d], comms.bytes[d]);
+      }
+
+      if (next >= 0) extractExtendedGaugeGhost(*this, next, R, comms.send, true, d, false);
+
+      if (comm_dim_partitioned(d)) {
+	comm_wait(comms.mh_send_fwd[d]);
+	comm_wait(comms.mh_send_back[d]);
+	comm_wait(comms.mh_recv_back[d]);
+	comm_wait(comms.mh_recv_fwd[d]);
+      }
 
       // inject back into the gauge field
-      extractExtendedGaugeGhost(*this, d, R, recv, false);
-    }
+      extractExtendedGaugeGhost(*this, d, R, comms.recv, false);
 
-    for (int d=0; d<nDim; d++) {
-      if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d])) ) continue;
-      host_free(send[d]);
-      host_free(recv[d]);
+      if (next >= 0) extractExtendedGaugeGhost(*this, next, R, comms.send, true, d, true);
     }
 
   }
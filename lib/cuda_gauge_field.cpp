@@ -842,4 +842,29 @@ namespace quda {
 
   void cudaGaugeField::zero() { qudaMemset(gauge, 0, bytes); }
 
+  cudaGaugeField *createExtendedGauge(cudaGaugeField &in, const int *R, TimeProfile &profile, bool redundant_comms,
+                                      QudaReconstructType recon)
+  {
+    profile.TPSTART(QUDA_PROFILE_INIT);
+    GaugeFieldParam gParamEx(in);
+    gParamEx.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+    gParamEx.pad = 0;
+    gParamEx.nFace = 1;
+    for (int d = 0; d < 4; d++) {
+      gParamEx.x[d] += 2 * R[d];
+      gParamEx.r[d] = R[d];
+    }
+    auto *out = new cudaGaugeField(gParamEx);
+
+    // copy input field into the extended device gauge field
+    copyExtendedGauge(*out, in, QUDA_CUDA_FIELD_LOCATION);
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+
+    // now fill up the halos
+    out->exchangeExtendedGhost(R, profile, redundant_comms);
+
+    return out;
+  }
+
 } // namespace quda
@@ -1,5 +1,6 @@
 #include <deflation.h>
 #include <qio_field.h>
+#include <vector_io.h>
 #include <string.h>
 
 #include <memory>
@@ -359,6 +360,13 @@ namespace quda
     std::string vec_infile(param.eig_global.vec_infile);
     std::vector<ColorSpinorField *> &B = RV->Components();
 
+    if (isNativeVectorFile(vec_infile)) {
+      loadVectorsNative(B, vec_infile);
+      profile.TPSTOP(QUDA_PROFILE_IO);
+      profile.TPSTART(QUDA_PROFILE_INIT);
+      return;
+    }
+
     const int Nvec = B.size();
     printfQuda("Start loading %d vectors from %s\n", Nvec, vec_infile.c_str());
 
@@ -393,7 +401,9 @@ namespace quda
     std::string vec_outfile(param.eig_global.vec_outfile);
     std::vector<ColorSpinorField*> &B = RV->Components();
 
-    if (strcmp(param.eig_global.vec_outfile,"")!=0) {
+    if (strcmp(param.eig_global.vec_outfile, "") != 0 && useNativeVectorFile()) {
+      saveVectorsNative(B, vec_outfile);
+    } else if (strcmp(param.eig_global.vec_outfile,"")!=0) {
       const int Nvec = B.size();
       printfQuda("Start saving %d vectors to %s\n", Nvec, vec_outfile.c_str());
 
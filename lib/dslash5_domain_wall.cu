@@ -175,7 +175,7 @@ public:
                          dslash5invCPU<Float, nColor, false, false, M5_INV_ZMOBIUS, shared, var_inverse>(arg);
         }
       } else {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
         if (arg.type == DSLASH5_DWF) {
           if (arg.xpay)
             arg.dagger ? launch(dslash5GPU<Float, nColor, true, true, DSLASH5_DWF, Arg>, tp, arg, stream) :
@@ -43,7 +43,12 @@ namespace quda {
     unsigned int sharedBytesPerBlock(const TuneParam &param) const { return 0; }
     bool tuneGridDim() const { return false; } // Don't tune the grid dimensions
     bool tuneAuxDim() const { return true; } // Do tune the aux dimensions
-    unsigned int minThreads() const { return color_col_stride * X.VolumeCB(); } // 4-d volume since this x threads only
+    unsigned int minThreads() const
+    {
+      // the CPU variant is threaded over the 4-d sites of both parities
+      if (out.Location() == QUDA_CPU_FIELD_LOCATION) return nParity * X.VolumeCB();
+      return color_col_stride * X.VolumeCB(); // 4-d volume since this x threads only
+    }
 
     bool advanceBlockDim(TuneParam &param) const
     {
@@ -222,10 +227,13 @@ namespace quda {
 	  errorQuda("Unsupported field order colorspinor=%d gauge=%d combination\n", inA.FieldOrder(), Y.FieldOrder());
 
 	DslashCoarseArg<Float,yFloat,ghostFloat,Ns,Nc,QUDA_SPACE_SPIN_COLOR_FIELD_ORDER,QUDA_QDP_GAUGE_ORDER> arg(out, inA, inB, Y, X, (Float)kappa, parity);
+
+        const TuneParam &tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
+        HostLaunch launch(tp);
 	coarseDslash<Float,nDim,Ns,Nc,Mc,dslash,clover,dagger,type>(arg);
       } else {
 
-        const TuneParam &tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        const TuneParam &tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
 	if (out.FieldOrder() != QUDA_FLOAT2_FIELD_ORDER || Y.FieldOrder() != QUDA_FLOAT2_GAUGE_ORDER)
 	  errorQuda("Unsupported field order colorspinor=%d gauge=%d combination\n", inA.FieldOrder(), Y.FieldOrder());
@@ -307,18 +315,22 @@ namespace quda {
       }
     }
 
+    QudaFieldLocation tuneLocation() const { return out.Location(); }
+
     TuneKey tuneKey() const {
       return TuneKey(out.VolString(), typeid(*this).name(), aux);
     }
 
     void preTune() {
       saveOut = new char[out.Bytes()];
-      cudaMemcpy(saveOut, out.V(), out.Bytes(), cudaMemcpyDeviceToHost);
+      if (out.Location() == QUDA_CPU_FIELD_LOCATION) memcpy(saveOut, out.V(), out.Bytes());
+      else cudaMemcpy(saveOut, out.V(), out.Bytes(), cudaMemcpyDeviceToHost);
     }
 
     void postTune()
     {
-      cudaMemcpy(out.V(), saveOut, out.Bytes(), cudaMemcpyHostToDevice);
+      if (out.Location() == QUDA_CPU_FIELD_LOCATION) memcpy(out.V(), saveOut, out.Bytes());
+      else cudaMemcpy(out.V(), saveOut, out.Bytes(), cudaMemcpyHostToDevice);
       delete[] saveOut;
     }
 
@@ -703,7 +715,7 @@ namespace quda {
    virtual ~DslashCoarsePolicyTune() { setPolicyTuning(false); }
 
    inline void apply(const cudaStream_t &stream) {
-     TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+     TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
      if (tp.aux.x >= (int)policies.size()) errorQuda("Requested policy that is outside of range");
      if (policies[tp.aux.x] == DslashCoarsePolicy::DSLASH_COARSE_POLICY_DISABLED ) errorQuda("Requested policy is disabled");
@@ -722,7 +734,11 @@ namespace quda {
     return false;
    }
 
-   bool advanceTuneParam(TuneParam &param) const { return advanceAux(param); }
+   // the communication policies only apply to GPU fields
+   bool advanceTuneParam(TuneParam &param) const
+   {
+     return dslash.out.Location() == QUDA_CUDA_FIELD_LOCATION ? advanceAux(param) : false;
+   }
 
    void initTuneParam(TuneParam &param) const  {
      Tunable::initTuneParam(param);
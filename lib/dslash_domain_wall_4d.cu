@@ -30,7 +30,7 @@ namespace quda
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       Dslash::setParam(tp);
       typedef typename mapper<typename Arg::Float>::type real;
 #ifdef JITIFY
@@ -29,7 +29,7 @@ namespace quda
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       Dslash::setParam(tp);
       Dslash::template instantiate<packStaggeredShmem>(tp, stream);
     }
@@ -205,7 +205,7 @@ public:
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
       if (in.Nspin() == 4) {
         using Arg = PackArg<Float, nColor, 4, spin_project>;
@@ -2194,7 +2194,7 @@ public:
    virtual ~DslashPolicyTune() { setPolicyTuning(false); }
 
    void apply(const cudaStream_t &stream) {
-     TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+     TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
      if (tp.aux.x >= static_cast<int>(policies.size())) errorQuda("Requested policy that is outside of range");
      if (static_cast<QudaDslashPolicy>(tp.aux.x) == QudaDslashPolicy::QUDA_DSLASH_POLICY_DISABLED)  errorQuda("Requested policy is disabled");
@@ -2271,6 +2271,7 @@ public:
      strcat(key.aux, comm_dim_topology_string());
      strcat(key.aux, comm_config_string()); // any change in P2P/GDR will be stored as a separate tunecache entry
      strcat(key.aux, policy_string);        // any change in policies enabled will be stored as a separate entry
+     key.rehash();
      dslashParam.kernel_type = kernel_type;
      return key;
    }
@@ -273,7 +273,7 @@ namespace quda {
       if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
 	gammaCPU<Float,nColor>(arg);
       } else {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	switch (arg.d) {
 	case 4: gammaGPU<Float,nColor,4> <<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg); break;
 	default: errorQuda("%d not instantiated", arg.d);
@@ -392,7 +392,7 @@ namespace quda {
 	if (arg.doublet) twistGammaCPU<true,Float,nColor>(arg);
 	twistGammaCPU<false,Float,nColor>(arg);
       } else {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	if (arg.doublet)
 	  switch (arg.d) {
 	  case 4: twistGammaGPU<true,Float,nColor,4> <<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg); break;
@@ -586,7 +586,7 @@ namespace quda {
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
 	cloverCPU<Float,nSpin,nColor>(arg);
       } else {
@@ -744,7 +744,7 @@ namespace quda {
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
 	if (arg.inverse) twistCloverCPU<true,Float,nSpin,nColor>(arg);
 	else twistCloverCPU<false,Float,nSpin,nColor>(arg);
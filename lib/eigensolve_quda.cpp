@@ -8,8 +8,10 @@
 #include <quda_internal.h>
 #include <eigensolve_quda.h>
 #include <qio_field.h>
+#include <vector_io.h>
 #include <color_spinor_field.h>
 #include <blas_quda.h>
+#include <blas_host.h>
 #include <util_quda.h>
 
 #include <Eigen/Eigenvalues>
@@ -115,12 +117,31 @@ namespace quda
 
   void EigenSolver::matVec(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in)
   {
-    if (!tmp1 || !tmp2) {
+    // A host Krylov space is applied through device copies of the
+    // operands, unless the operator can itself act on host fields
+    const bool stage = in.Location() == QUDA_CPU_FIELD_LOCATION && !mat.isCoarse();
+    if (stage && d_vecs_tmp.size() == 0) {
       ColorSpinorParam param(in);
+      param.location = QUDA_CUDA_FIELD_LOCATION;
+      param.create = QUDA_ZERO_FIELD_CREATE;
+      param.setPrecision(in.Precision(), in.Precision(), true);
+      if (param.nSpin == 4) param.gammaBasis = QUDA_UKQCD_GAMMA_BASIS;
+      for (int i = 0; i < 2; i++) d_vecs_tmp.push_back(ColorSpinorField::Create(param));
+    }
+
+    if (!tmp1 || !tmp2) {
+      ColorSpinorParam param(stage ? *d_vecs_tmp[0] : in);
       if (!tmp1) tmp1 = ColorSpinorField::Create(param);
       if (!tmp2) tmp2 = ColorSpinorField::Create(param);
     }
-    mat(out, in, *tmp1, *tmp2);
+
+    if (stage) {
+      *d_vecs_tmp[0] = in;
+      mat(*d_vecs_tmp[1], *d_vecs_tmp[0], *tmp1, *tmp2);
+      out = *d_vecs_tmp[1];
+    } else {
+      mat(out, in, *tmp1, *tmp2);
+    }
   }
 
   void EigenSolver::chebyOp(const DiracMatrix &mat, ColorSpinorField &out, const ColorSpinorField &in)
@@ -440,6 +461,11 @@ namespace quda
 
   void EigenSolver::loadVectors(std::vector<ColorSpinorField *> &eig_vecs, std::string vec_infile)
   {
+    // native checkpoints are streamed straight into the fields and do not need QIO
+    if (isNativeVectorFile(vec_infile)) {
+      loadVectorsNative(eig_vecs, vec_infile);
+      return;
+    }
 
 #ifdef HAVE_QIO
     const int Nvec = eig_vecs.size();
@@ -543,6 +569,10 @@ namespace quda
 
   void EigenSolver::saveVectors(const std::vector<ColorSpinorField *> &eig_vecs, std::string vec_outfile)
   {
+    if (useNativeVectorFile()) {
+      saveVectorsNative(eig_vecs, vec_outfile);
+      return;
+    }
 
 #ifdef HAVE_QIO
     const int Nvec = eig_vecs.size();
@@ -662,6 +692,7 @@ namespace quda
   {
     if (tmp1) delete tmp1;
     if (tmp2) delete tmp2;
+    for (auto &v : d_vecs_tmp) delete v;
     host_free(residua);
     host_free(Qmat);
   }
@@ -1075,8 +1106,19 @@ namespace quda
     // Multi-BLAS friendly array to store part of Ritz matrix we want
     double *ritz_mat_keep = (double *)safe_malloc((dim * iter_keep) * sizeof(double));
 
-    // If we have memory availible, do the entire rotation
-    if (batched_rotate <= 0 || batched_rotate >= iter_keep) {
+    if (kSpace[0]->Location() == QUDA_CPU_FIELD_LOCATION) {
+      // A host Krylov space is rotated in place as a blocked matrix
+      // product, so no extra space is needed and kSpace keeps its size
+      std::vector<ColorSpinorField *> vecs_ptr;
+      vecs_ptr.reserve(dim);
+      for (int j = 0; j < dim; j++) {
+        vecs_ptr.push_back(kSpace[num_locked + j]);
+        for (int i = 0; i < iter_keep; i++) { ritz_mat_keep[j * iter_keep + i] = ritz_mat[i * dim + j]; }
+      }
+
+      blas::flops += hostblas::RotateVectors(vecs_ptr, ritz_mat_keep, iter_keep);
+    } else if (batched_rotate <= 0 || batched_rotate >= iter_keep) {
+      // If we have memory availible, do the entire rotation
       if ((int)kSpace.size() < offset + iter_keep) {
         if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Resizing kSpace to %d vectors\n", offset + iter_keep);
         kSpace.reserve(offset + iter_keep);
@@ -254,7 +254,7 @@ namespace quda {
       virtual ~CopySpinorEx() {}
 
       void apply(const cudaStream_t &stream){
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
         if(location == QUDA_CPU_FIELD_LOCATION){
           copyInterior<FloatOut,FloatIn,Ns,Nc,OutOrder,InOrder,Basis,extend>(arg);    
@@ -204,7 +204,7 @@ namespace quda {
 
   public:
     ExtractGhostEx(ExtractGhostExArg<Order,nDim,dim> &arg, bool extract, 
-		   const GaugeField &meta, QudaFieldLocation location)
+		   const GaugeField &meta, QudaFieldLocation location, int split_dim = -1, int split_part = 0)
       : arg(arg), extract(extract), meta(meta), location(location) {
       int dA = arg.A1[dim]-arg.A0[dim];
       int dB = arg.B1[dim]-arg.B0[dim];
@@ -212,6 +212,11 @@ namespace quda {
       size = arg.R[dim]*dA*dB*dC*arg.order.geometry;
       writeAuxString("prec=%lu,stride=%d,extract=%d,dimension=%d,geometry=%d",
 		     sizeof(Float),arg.order.stride, extract, dim, arg.order.geometry);
+      if (split_dim >= 0) {
+        char split[32];
+        sprintf(split, ",split=%d,part=%d", split_dim, split_part);
+        strcat(aux, split);
+      }
     }
     virtual ~ExtractGhostEx() { ; }
   
@@ -220,7 +225,7 @@ namespace quda {
 	if (location==QUDA_CPU_FIELD_LOCATION) {
 	  extractGhostEx<Float,length,nDim,dim,Order,true>(arg);
 	} else {
-	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	  tp.grid.y = 2;
 	  tp.grid.z = 2;
 	  extractGhostExKernel<Float,length,nDim,dim,Order,true> 
@@ -230,7 +235,7 @@ namespace quda {
 	if (location==QUDA_CPU_FIELD_LOCATION) {
 	  extractGhostEx<Float,length,nDim,dim,Order,false>(arg);
 	} else {
-	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	  tp.grid.y = 2;
 	  tp.grid.z = 2;
 	  extractGhostExKernel<Float,length,nDim,dim,Order,false> 
@@ -255,7 +260,8 @@ namespace quda {
   */
   template <typename Float, int length, typename Order>
   void extractGhostEx(Order order, const int dim, const int *surfaceCB, const int *E, 
-		      const int *R, bool extract, const GaugeField &u, QudaFieldLocation location) {
+		      const int *R, bool extract, const GaugeField &u, QudaFieldLocation location,
+		      int split_dim, bool split_halo) {
     const int nDim = 4;
     //loop variables: a, b, c with a the most signifcant and c the least significant
     //A0, B0, C0 the minimum value
@@ -297,28 +303,64 @@ namespace quda {
       localParity[dim] = ((X[dim] % 2 ==1) && (commDim(dim) > 1)) ? 1 : 0;
     //      localParity[dim] = (X[dim]%2==0 || commDim(dim)) ? 0 : 1;
 
-    if (dim==0) {
-      ExtractGhostExArg<Order,nDim,0> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
-					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,0,Order> extractor(arg, extract, u, location);
-      extractor.apply(0);
-    } else if (dim==1) {
-      ExtractGhostExArg<Order,nDim,1> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
-					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,1,Order> extractor(arg, extract, u, location);
-      extractor.apply(0);
-    } else if (dim==2) {
-      ExtractGhostExArg<Order,nDim,2> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
-					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,2,Order> extractor(arg, extract, u, location);
-      extractor.apply(0);
-    } else if (dim==3) {
-      ExtractGhostExArg<Order,nDim,3> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
-					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,3,Order> extractor(arg, extract, u, location);
-      extractor.apply(0);
+    auto run = [&](int part) {
+      if (dim==0) {
+        ExtractGhostExArg<Order,nDim,0> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
+                                            C0, C1, fSrc, fBuf, localParity);
+        ExtractGhostEx<Float,length,nDim,0,Order> extractor(arg, extract, u, location, split_dim, part);
+        extractor.apply(0);
+      } else if (dim==1) {
+        ExtractGhostExArg<Order,nDim,1> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
+                                            C0, C1, fSrc, fBuf, localParity);
+        ExtractGhostEx<Float,length,nDim,1,Order> extractor(arg, extract, u, location, split_dim, part);
+        extractor.apply(0);
+      } else if (dim==2) {
+        ExtractGhostExArg<Order,nDim,2> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
+                                            C0, C1, fSrc, fBuf, localParity);
+        ExtractGhostEx<Float,length,nDim,2,Order> extractor(arg, extract, u, location, split_dim, part);
+        extractor.apply(0);
+      } else if (dim==3) {
+        ExtractGhostExArg<Order,nDim,3> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
+                                            C0, C1, fSrc, fBuf, localParity);
+        ExtractGhostEx<Float,length,nDim,3,Order> extractor(arg, extract, u, location, split_dim, part);
+        extractor.apply(0);
+      } else {
+        errorQuda("Invalid dim=%d", dim);
+      }
+    };
+
+    if (split_dim < 0) {
+      run(0);
     } else {
-      errorQuda("Invalid dim=%d", dim);
+      if (split_dim >= dim) errorQuda("Cannot split dim=%d face along dimension %d", dim, split_dim);
+
+      // the face of dim runs over the full extended range of each
+      // lower dimension, with a, b, c the remaining dimensions from
+      // the most to the least significant, so find the loop bounds
+      // belonging to split_dim
+      int *lo = nullptr, *hi = nullptr;
+      int pos = 0;
+      for (int e = nDim - 1; e >= 0; e--) {
+        if (e == dim) continue;
+        if (e == split_dim) {
+          lo = pos == 0 ? A0 : (pos == 1 ? B0 : C0);
+          hi = pos == 0 ? A1 : (pos == 1 ? B1 : C1);
+        }
+        pos++;
+      }
+
+      if (!split_halo) {
+        lo[dim] = R[split_dim];
+        hi[dim] = X[split_dim] + R[split_dim];
+        run(0);
+      } else if (R[split_dim] > 0) {
+        lo[dim] = 0;
+        hi[dim] = R[split_dim];
+        run(1);
+        lo[dim] = X[split_dim] + R[split_dim];
+        hi[dim] = E[split_dim];
+        run(2);
+      }
     }
 
     checkCudaError();
@@ -326,7 +368,8 @@ namespace quda {
 
   /** This is the template driver for extractGhost */
   template <typename Float>
-  void extractGhostEx(const GaugeField &u, int dim, const int *R, Float **Ghost, bool extract) {
+  void extractGhostEx(const GaugeField &u, int dim, const int *R, Float **Ghost, bool extract, int split_dim,
+                      bool split_halo) {
 
     const int length = 18;
 
@@ -336,12 +379,12 @@ namespace quda {
     if (u.isNative()) {
       if (u.Reconstruct() == QUDA_RECONSTRUCT_NO) {
         typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type G;
-        extractGhostEx<Float, length>(G(u, 0, Ghost), dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+        extractGhostEx<Float, length>(G(u, 0, Ghost), dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
       } else if (u.Reconstruct() == QUDA_RECONSTRUCT_12) {
 #if QUDA_RECONSTRUCT & 2
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_12>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_12", QUDA_RECONSTRUCT);
 #endif
@@ -349,7 +392,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 1
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_8>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost), 
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_8", QUDA_RECONSTRUCT);
 #endif
@@ -357,7 +400,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 2
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_13>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_13", QUDA_RECONSTRUCT);
 #endif
@@ -365,7 +408,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 1
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_9>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_9", QUDA_RECONSTRUCT);
 #endif
@@ -374,7 +417,7 @@ namespace quda {
       
 #ifdef BUILD_QDP_INTERFACE
       extractGhostEx<Float,length>(QDPOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("QDP interface has not been built\n");
 #endif
@@ -383,7 +426,7 @@ namespace quda {
 
 #ifdef BUILD_QDPJIT_INTERFACE
       extractGhostEx<Float,length>(QDPJITOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("QDPJIT interface has not been built\n");
 #endif
@@ -392,7 +435,7 @@ namespace quda {
 
 #ifdef BUILD_CPS_INTERFACE
       extractGhostEx<Float,length>(CPSOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("CPS interface has not been built\n");
 #endif
@@ -401,7 +444,7 @@ namespace quda {
 
 #ifdef BUILD_MILC_INTERFACE
       extractGhostEx<Float,length>(MILCOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("MILC interface has not been built\n");
 #endif
@@ -410,7 +453,7 @@ namespace quda {
 
 #ifdef BUILD_BQCD_INTERFACE
       extractGhostEx<Float,length>(BQCDOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("BQCD interface has not been built\n");
 #endif
@@ -419,7 +462,7 @@ namespace quda {
 
 #ifdef BUILD_TIFR_INTERFACE
       extractGhostEx<Float,length>(TIFROrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_halo);
 #else
       errorQuda("TIFR interface has not been built\n");
 #endif
@@ -431,23 +474,23 @@ namespace quda {
   }
 
   void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, 
-				 void **ghost, bool extract) {
+				 void **ghost, bool extract, int split_dim, bool split_halo) {
 
     if (u.Precision() == QUDA_DOUBLE_PRECISION) {
 #if QUDA_PRECISION & 8
-      extractGhostEx(u, dim, R, (double**)ghost, extract);
+      extractGhostEx(u, dim, R, (double**)ghost, extract, split_dim, split_halo);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable double precision", QUDA_PRECISION);
 #endif
     } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
 #if QUDA_PRECISION & 4
-      extractGhostEx(u, dim, R, (float**)ghost, extract);
+      extractGhostEx(u, dim, R, (float**)ghost, extract, split_dim, split_halo);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable single precision", QUDA_PRECISION);
 #endif
     } else if (u.Precision() == QUDA_HALF_PRECISION) {
 #if QUDA_PRECISION & 2
-      extractGhostEx(u, dim, R, (short**)ghost, extract);      
+      extractGhostEx(u, dim, R, (short**)ghost, extract, split_dim, split_halo);      
 #else
       errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
 #endif
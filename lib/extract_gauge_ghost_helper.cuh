@@ -203,7 +203,7 @@ namespace quda {
 	if (extract) extractGhost<Float,length,nDim,Order,true>(arg);
 	else extractGhost<Float,length,nDim,Order,false>(arg);
       } else {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	if (extract) {
 	  extractGhostKernel<Float, length, nDim, Order, true>
 	    <<<tp.grid, tp.block, tp.shared_bytes, stream>>>(arg);
@@ -34,7 +34,7 @@ public:
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
       using namespace jitify::reflection;
       jitify_error = program->kernel("quda::computeAPEStep").instantiate(Type<Arg>())
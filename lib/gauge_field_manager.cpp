@@ -0,0 +1,203 @@
+#include <cstdlib>
+#include <tuple>
+
+#include <quda_internal.h>
+#include <gauge_field_manager.h>
+
+namespace quda {
+
+  static TimeProfile profileGaugeManager("GaugeFieldManager");
+
+  static const char *role_name[GAUGE_FIELD_ROLES] = {"sloppy", "precondition", "refinement", "extended"};
+
+  // memory budget for unreferenced copies, from QUDA_GAUGE_CACHE_SIZE in MiB
+  static size_t gaugeCacheBudget()
+  {
+    static bool init = false;
+    static size_t budget = 0;
+    if (!init) {
+      char *budget_env = getenv("QUDA_GAUGE_CACHE_SIZE");
+      if (budget_env) {
+        long size = atol(budget_env);
+        if (size < 0) errorQuda("Invalid QUDA_GAUGE_CACHE_SIZE=%s", budget_env);
+        budget = static_cast<size_t>(size) * 1024 * 1024;
+      }
+      init = true;
+    }
+    return budget;
+  }
+
+  bool GaugeFieldManager::Key::operator<(const Key &other) const
+  {
+    return std::tie(precision, reconstruct, R[0], R[1], R[2], R[3])
+      < std::tie(other.precision, other.reconstruct, other.R[0], other.R[1], other.R[2], other.R[3]);
+  }
+
+  bool GaugeFieldManager::Key::operator==(const Key &other) const { return !(*this < other) && !(other < *this); }
+
+  GaugeFieldManager::GaugeFieldManager(const char *name, cudaGaugeField *const &source) :
+    name(name),
+    source(source),
+    role_set {},
+    role_field {}
+  {
+  }
+
+  GaugeFieldManager::~GaugeFieldManager()
+  {
+    // the fields are freed by clear() in endQuda, before the device is released
+    if (!cache.empty()) warningQuda("%s gauge field manager destroyed with %lu derived copies", name, cache.size());
+  }
+
+  bool GaugeFieldManager::isSource(const Key &key) const
+  {
+    return source && key.precision == source->Precision() && key.reconstruct == source->Reconstruct() && key.R[0] == 0
+      && key.R[1] == 0 && key.R[2] == 0 && key.R[3] == 0;
+  }
+
+  cudaGaugeField *GaugeFieldManager::build(const Key &key)
+  {
+    if (!key.R[0] && !key.R[1] && !key.R[2] && !key.R[3]) {
+      GaugeFieldParam param(*source);
+      param.create = QUDA_NULL_FIELD_CREATE;
+      param.reconstruct = key.reconstruct;
+      param.setPrecision(key.precision, true);
+      auto *field = new cudaGaugeField(param);
+      field->copy(*source);
+      return field;
+    }
+
+    // extended copies are built from the non-extended copy at the same precision and reconstruction
+    Key base_key = key;
+    for (int d = 0; d < 4; d++) base_key.R[d] = 0;
+    cudaGaugeField *base = acquire(base_key);
+
+    cudaGaugeField *field = createExtendedGauge(*base, key.R, profileGaugeManager);
+
+    release(base);
+    return field;
+  }
+
+  cudaGaugeField *GaugeFieldManager::acquire(const Key &key)
+  {
+    if (!source) errorQuda("No precise %s gauge field to derive from", name);
+    if (isSource(key)) return source;
+
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+      cudaGaugeField *field = build(key);
+      it = cache.insert({key, {field, 0, 0}}).first;
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Built %s gauge field copy with precision %d, reconstruct %d, R = %d %d %d %d (%lu bytes)\n", name,
+                   key.precision, key.reconstruct, key.R[0], key.R[1], key.R[2], key.R[3], field->Bytes());
+    }
+
+    it->second.ref_count++;
+    it->second.last_use = ++clock;
+    return it->second.field;
+  }
+
+  void GaugeFieldManager::release(cudaGaugeField *field)
+  {
+    if (!field || field == source) return;
+
+    for (auto &entry : cache) {
+      if (entry.second.field != field) continue;
+      if (entry.second.ref_count <= 0) errorQuda("Releasing unreferenced %s gauge field copy", name);
+      entry.second.ref_count--;
+      entry.second.last_use = ++clock;
+      evict();
+      return;
+    }
+    errorQuda("Releasing %s gauge field copy %p not held by the manager", name, field);
+  }
+
+  void GaugeFieldManager::evict()
+  {
+    const size_t budget = gaugeCacheBudget();
+
+    while (true) {
+      size_t unreferenced = 0;
+      auto lru = cache.end();
+      for (auto it = cache.begin(); it != cache.end(); it++) {
+        if (it->second.ref_count > 0) continue;
+        unreferenced += it->second.field->Bytes();
+        if (lru == cache.end() || it->second.last_use < lru->second.last_use) lru = it;
+      }
+      if (unreferenced <= budget || lru == cache.end()) break;
+
+      delete lru->second.field;
+      cache.erase(lru);
+    }
+  }
+
+  void GaugeFieldManager::setRole(GaugeFieldRole role, QudaPrecision precision, QudaReconstructType reconstruct,
+                                  const int *R)
+  {
+    Key key = {precision, reconstruct, {0, 0, 0, 0}};
+    if (R)
+      for (int d = 0; d < 4; d++) key.R[d] = R[d];
+    if (role_set[role] && role_key[role] == key) return;
+
+    unsetRole(role);
+    role_key[role] = key;
+    role_set[role] = true;
+  }
+
+  void GaugeFieldManager::unsetRole(GaugeFieldRole role)
+  {
+    if (role_field[role]) release(role_field[role]);
+    role_field[role] = nullptr;
+    role_set[role] = false;
+  }
+
+  cudaGaugeField *GaugeFieldManager::get(GaugeFieldRole role)
+  {
+    if (!role_set[role]) return nullptr;
+    // roles matching the precise field follow it, so are never left pointing at a replaced field
+    if (isSource(role_key[role])) return source;
+    if (!role_field[role]) role_field[role] = acquire(role_key[role]);
+    return role_field[role];
+  }
+
+  void GaugeFieldManager::clear()
+  {
+    for (int role = 0; role < GAUGE_FIELD_ROLES; role++) {
+      role_field[role] = nullptr;
+      role_set[role] = false;
+    }
+
+    for (auto &entry : cache) {
+      if (entry.second.ref_count > 0 && getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Freeing %s gauge field copy with %d references\n", name, entry.second.ref_count);
+      delete entry.second.field;
+    }
+    cache.clear();
+  }
+
+  size_t GaugeFieldManager::Bytes() const
+  {
+    size_t bytes = 0;
+    for (auto &entry : cache) bytes += entry.second.field->Bytes();
+    return bytes;
+  }
+
+  void GaugeFieldManager::print() const
+  {
+    printfQuda("%s gauge field manager: %lu derived copies, %lu bytes\n", name, cache.size(), Bytes());
+    for (int role = 0; role < GAUGE_FIELD_ROLES; role++) {
+      if (!role_set[role]) continue;
+      const Key &key = role_key[role];
+      printfQuda("  role %-12s precision %d, reconstruct %d, R = %d %d %d %d, %s\n", role_name[role], key.precision,
+                 key.reconstruct, key.R[0], key.R[1], key.R[2], key.R[3],
+                 isSource(key) ? "precise field" : role_field[role] ? "built" : "not yet built");
+    }
+    for (auto &entry : cache) {
+      const Key &key = entry.first;
+      printfQuda("  copy precision %d, reconstruct %d, R = %d %d %d %d: %lu bytes, %d references\n", key.precision,
+                 key.reconstruct, key.R[0], key.R[1], key.R[2], key.R[3], entry.second.field->Bytes(),
+                 entry.second.ref_count);
+    }
+  }
+
+} // namespace quda
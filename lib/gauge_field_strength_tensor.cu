@@ -36,7 +36,7 @@ public:
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
       using namespace jitify::reflection;
       jitify_error = program->kernel("quda::computeFmunuKernel").instantiate(Type<Arg>())
@@ -56,11 +56,37 @@ public:
 
   }; // Fmunu
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void FmunuCPU(GaugeField &f, const GaugeField &u)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    FmunuArg<Float, nColor, recon, G, G> arg(f, u);
+    computeFmunuCPU(arg);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon> struct FmunuHost {
+    FmunuHost(const GaugeField &u, GaugeField &f)
+    {
+      if (u.Order() != f.Order()) errorQuda("Mismatched orders %d %d", u.Order(), f.Order());
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) {
+        FmunuCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(f, u);
+      } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
+        FmunuCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(f, u);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", u.Order());
+      }
+    }
+  };
+
   void computeFmunu(GaugeField &f, const GaugeField &u)
   {
 #ifdef GPU_GAUGE_TOOLS
     checkPrecision(f, u);
-    instantiate<Fmunu,ReconstructWilson>(u, f); // u must be first here for correct template instantiation
+    if (checkLocation(f, u) == QUDA_CUDA_FIELD_LOCATION) {
+      instantiate<Fmunu,ReconstructWilson>(u, f); // u must be first here for correct template instantiation
+    } else {
+      instantiate<FmunuHost,ReconstructNone>(u, f);
+    }
 #else
     errorQuda("Gauge tools are not built");
 #endif // GPU_GAUGE_TOOLS
@@ -30,7 +30,7 @@ namespace quda {
     void apply(const cudaStream_t &stream){
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION){
 	for (int i=0; i<2; i++) ((double*)arg.result_h)[i] = 0.0;
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
         using namespace jitify::reflection;
         jitify_error = program->kernel("quda::computePlaq")
@@ -49,15 +49,34 @@ namespace quda {
     long long bytes() const { return 6ll*2*arg.threads*4*arg.U.Bytes(); }
   };
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  double2 plaquetteCPU(const GaugeField &U, int &threads)
+  {
+    GaugePlaqArg<Float, nColor, recon, typename gauge_order_mapper<Float, order, nColor>::type> arg(U);
+    threads = arg.threads;
+    return computePlaqCPU(arg);
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon> struct Plaquette {
     Plaquette(const GaugeField &U, double2 &plq)
     {
-      GaugePlaqArg<Float, nColor, recon> arg(U);
-      GaugePlaq<decltype(arg)> gaugePlaq(arg, U);
-      gaugePlaq.apply(0);
-      qudaDeviceSynchronize();
-      comm_allreduce_array((double*)arg.result_h, 2);
-      for (int i=0; i<2; i++) ((double*)&plq)[i] = ((double*)arg.result_h)[i] / (9.*2*arg.threads*comm_size());
+      int threads = 0;
+      if (U.Location() == QUDA_CUDA_FIELD_LOCATION) {
+        GaugePlaqArg<Float, nColor, recon> arg(U);
+        GaugePlaq<decltype(arg)> gaugePlaq(arg, U);
+        gaugePlaq.apply(0);
+        qudaDeviceSynchronize();
+        plq = *((double2 *)arg.result_h);
+        threads = arg.threads;
+      } else if (U.Order() == QUDA_QDP_GAUGE_ORDER) {
+        plq = plaquetteCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(U, threads);
+      } else if (U.Order() == QUDA_MILC_GAUGE_ORDER) {
+        plq = plaquetteCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(U, threads);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", U.Order());
+      }
+      comm_allreduce_array((double*)&plq, 2);
+      for (int i=0; i<2; i++) ((double*)&plq)[i] /= (9.*2*threads*comm_size());
     }
   };
 
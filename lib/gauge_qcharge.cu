@@ -31,7 +31,7 @@ public:
     {
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
         arg.result_h[0] = 0.;
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
         using namespace jitify::reflection;
         jitify_error = program->kernel("quda::qChargeComputeKernel")
@@ -55,9 +55,40 @@ public:
     long long bytes() const { return 2 * arg.threads * ((6 * 18) + Arg::density) * sizeof(typename Arg::Float); }
   }; // QChargeCompute
 
+  template <typename Float, int nColor, QudaReconstructType recon, bool density, QudaGaugeFieldOrder order>
+  double QChargeCPU(const GaugeField &Fmunu, void *qDensity, double *q_t)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type F;
+    QChargeArg<Float, nColor, recon, density, F> arg(Fmunu, (Float *)qDensity);
+    return qChargeComputeCPU(arg, q_t);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon, bool density>
+  double QChargeCPU(const GaugeField &Fmunu, void *qDensity, double *q_t)
+  {
+    double charge = 0.0;
+    if (Fmunu.Order() == QUDA_QDP_GAUGE_ORDER) {
+      charge = QChargeCPU<Float, nColor, recon, density, QUDA_QDP_GAUGE_ORDER>(Fmunu, qDensity, q_t);
+    } else if (Fmunu.Order() == QUDA_MILC_GAUGE_ORDER) {
+      charge = QChargeCPU<Float, nColor, recon, density, QUDA_MILC_GAUGE_ORDER>(Fmunu, qDensity, q_t);
+    } else {
+      errorQuda("Gauge order %d not supported on CPU", Fmunu.Order());
+    }
+    return charge;
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon> struct QCharge {
-    QCharge(const GaugeField &Fmunu, double &charge, void *qDensity, bool density)
+    QCharge(const GaugeField &Fmunu, double &charge, void *qDensity, bool density, double *q_t = nullptr)
     {
+      if (Fmunu.Location() == QUDA_CPU_FIELD_LOCATION) {
+        if (density)
+          charge = QChargeCPU<Float, nColor, recon, true>(Fmunu, qDensity, q_t);
+        else
+          charge = QChargeCPU<Float, nColor, recon, false>(Fmunu, qDensity, q_t);
+        comm_allreduce(&charge);
+        return;
+      }
+
       if (!Fmunu.isNative()) errorQuda("Topological charge computation only supported on native ordered fields");
 
       if (density) {
@@ -103,4 +134,25 @@ public:
 #endif // GPU_GAUGE_TOOLS
     return charge;
   }
+
+  double computeQChargeTimeSlice(const GaugeField &Fmunu, double *q_t)
+  {
+    double charge = 0.0;
+#ifdef GPU_GAUGE_TOOLS
+    if (Fmunu.Location() != QUDA_CPU_FIELD_LOCATION) errorQuda("Only supported for CPU fields");
+
+    const int nt = Fmunu.X()[3];
+    const int nt_global = nt * comm_dim(3);
+    std::vector<double> q_local(nt);
+    instantiate<QCharge,ReconstructNone>(Fmunu, charge, nullptr, false, q_local.data());
+
+    for (int t = 0; t < nt_global; t++) q_t[t] = 0.0;
+    for (int t = 0; t < nt; t++) q_t[comm_coord(3) * nt + t] = q_local[t];
+    comm_allreduce_array(q_t, nt_global);
+#else
+    errorQuda("Gauge tools are not built");
+#endif // GPU_GAUGE_TOOLS
+    return charge;
+  }
+
 } // namespace quda
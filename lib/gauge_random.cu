@@ -124,7 +124,7 @@ namespace quda {
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       computeGenGauss<<<tp.grid, tp.block, tp.shared_bytes>>>(arg);
     }
 
@@ -35,7 +35,7 @@ public:
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
       using namespace jitify::reflection;
       jitify_error = program->kernel("quda::computeSTOUTStep").instantiate(Type<Arg>())
@@ -54,12 +54,44 @@ public:
     long long bytes() const { return 3 * ((1 + 2 * 6) * arg.in.Bytes() + arg.out.Bytes()) * arg.threads; }
   }; // GaugeSTOUT
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void STOUTStepCPU(GaugeField &out, const GaugeField &in, double rho, double epsilon, bool improved)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    if (improved) {
+      GaugeSTOUTArg<Float, nColor, recon, 4, G> arg(out, in, rho, epsilon);
+      computeOvrImpSTOUTStepCPU(arg);
+    } else {
+      GaugeSTOUTArg<Float, nColor, recon, 3, G> arg(out, in, rho);
+      computeSTOUTStepCPU(arg);
+    }
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon> struct GaugeSTOUTCPU {
+    GaugeSTOUTCPU(GaugeField &out, const GaugeField &in, double rho, double epsilon, bool improved)
+    {
+      if (out.Order() != in.Order()) errorQuda("Mismatched orders %d %d", out.Order(), in.Order());
+      if (in.Order() == QUDA_QDP_GAUGE_ORDER) {
+        STOUTStepCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(out, in, rho, epsilon, improved);
+      } else if (in.Order() == QUDA_MILC_GAUGE_ORDER) {
+        STOUTStepCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(out, in, rho, epsilon, improved);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", in.Order());
+      }
+    }
+  };
+
   void STOUTStep(GaugeField &out, const GaugeField &in, double rho)
   {
 #ifdef GPU_GAUGE_TOOLS
     checkPrecision(out, in);
     checkReconstruct(out, in);
 
+    if (checkLocation(out, in) == QUDA_CPU_FIELD_LOCATION) {
+      instantiate<GaugeSTOUTCPU, ReconstructNone>(out, in, rho, 0.0, false);
+      return;
+    }
+
     if (!out.isNative()) errorQuda("Order %d with %d reconstruct not supported", in.Order(), in.Reconstruct());
     if (!in.isNative()) errorQuda("Order %d with %d reconstruct not supported", out.Order(), out.Reconstruct());
 
@@ -95,7 +127,7 @@ public:
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 #ifdef JITIFY
       using namespace jitify::reflection;
       jitify_error = program->kernel("quda::computeOvrImpSTOUTStep").instantiate(Type<Arg>())
@@ -120,6 +152,11 @@ public:
     checkPrecision(out, in);
     checkReconstruct(out, in);
 
+    if (checkLocation(out, in) == QUDA_CPU_FIELD_LOCATION) {
+      instantiate<GaugeSTOUTCPU, ReconstructNone>(out, in, rho, epsilon, true);
+      return;
+    }
+
     if (!out.isNative()) errorQuda("Order %d with %d reconstruct not supported", in.Order(), in.Reconstruct());
     if (!in.isNative()) errorQuda("Order %d with %d reconstruct not supported", out.Order(), out.Reconstruct());
 
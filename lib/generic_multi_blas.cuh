@@ -0,0 +1,224 @@
+#pragma once
+
+/**
+   Host (CPU field) implementation of the multi-blas kernels.
+
+   The fields are contiguous arrays of complex numbers, with the
+   elementwise functors acting on each element independently of the
+   field order, so all fields are treated as flat arrays and streamed
+   in blocks of multi_blas_host_block(NXZ) elements.  For each block,
+   the NYW outputs are accumulated over all NXZ inputs in turn, such
+   that the NXZ input blocks are kept in cache and re-used for each of
+   the NYW outputs, i.e., each block is computed as a small NXZ x NYW
+   matrix product.  The blocks are distributed over the OpenMP
+   threads.
+*/
+
+/**
+   @brief Number of complex elements per cache block, chosen such
+   that the NXZ input blocks and the output block fit within a
+   typical per-core L2 cache.
+   @param[in] nxz Number of input vectors
+   @param[in] bytes Bytes per complex element
+*/
+inline int multi_blas_host_block(int nxz, size_t bytes)
+{
+  constexpr size_t cache_bytes = 256 * 1024;
+  int block = 16;
+  while (block < 1024 && 2 * block * (nxz + 2) * bytes <= cache_bytes) block *= 2;
+  return block;
+}
+
+/**
+   @brief The extent of the elements of a CPU field that are streamed
+   by the host multi-blas kernels: the physical elements of each
+   parity, skipping any padding
+*/
+struct HostMultiBlasExtent {
+  size_t parity_length; // complex elements per parity, excluding the pad
+  size_t parity_stride; // complex elements per parity, including the pad
+  int nParity;
+  HostMultiBlasExtent(const ColorSpinorField &f) :
+    parity_length(f.RealLength() / (2 * f.SiteSubset())),
+    parity_stride(f.Length() / (2 * f.SiteSubset())),
+    nParity(f.SiteSubset())
+  {
+  }
+};
+
+template <typename RegType, typename Float> inline RegType host_multi_load(const Float *v, size_t i)
+{
+  RegType r;
+  r.x = v[2 * i + 0];
+  r.y = v[2 * i + 1];
+  return r;
+}
+
+template <typename RegType, typename Float> inline void host_multi_save(Float *v, size_t i, const RegType &r)
+{
+  v[2 * i + 0] = r.x;
+  v[2 * i + 1] = r.y;
+}
+
+/**
+   @brief Check the fields are compatible with the host multi-blas
+   kernels, which stream them as flat arrays
+*/
+inline void checkHostMultiFields(std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                                 std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w)
+{
+  for (auto v : {&x, &y, &z, &w}) {
+    for (auto f : *v) {
+      if (f->FieldOrder() != x[0]->FieldOrder())
+        errorQuda("Mismatched field orders %d %d", f->FieldOrder(), x[0]->FieldOrder());
+      if (f->SiteSubset() != x[0]->SiteSubset() || f->RealLength() != x[0]->RealLength())
+        errorQuda("Mismatched field lengths %lu %lu", f->RealLength(), x[0]->RealLength());
+      if (f->Precision() != QUDA_DOUBLE_PRECISION && f->Precision() != QUDA_SINGLE_PRECISION)
+        errorQuda("Precision %d not supported for CPU fields", f->Precision());
+    }
+  }
+}
+
+/**
+   @brief Convert the coefficient matrices to the register precision
+   and set the host constant pointers the functors read from.  The
+   storage is held by the caller for the lifetime of the kernel.
+*/
+template <int NXZ, typename Float2, typename T>
+void setHostMultiCoeff(std::vector<Float2> &A, std::vector<Float2> &B, std::vector<Float2> &C, const coeff_array<T> &a,
+                       const coeff_array<T> &b, const coeff_array<T> &c, int NYW)
+{
+  auto convert = [NYW](std::vector<Float2> &M, const T *m) -> signed char * {
+    if (!m) return nullptr;
+    M.resize(NXZ * NYW);
+    for (int i = 0; i < NXZ; i++)
+      for (int j = 0; j < NYW; j++) M[NYW * i + j] = make_Float2<Float2>(Complex(m[NYW * i + j]));
+    return reinterpret_cast<signed char *>(M.data());
+  };
+  Amatrix_h = convert(A, a.data);
+  Bmatrix_h = convert(B, b.data);
+  Cmatrix_h = convert(C, c.data);
+}
+
+/**
+   Generic host multi-blas kernel
+   @tparam NXZ Number of x (and z) vectors
+   @tparam RegType Register type (double2 or float2)
+   @tparam Float Storage precision of the x and z vectors
+   @tparam yFloat Storage precision of the y vectors
+   @tparam wFloat Storage precision of the w vectors
+*/
+template <int NXZ, typename RegType, typename Float, typename yFloat, typename wFloat, typename write, typename Functor>
+void genericMultiBlas(std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                      std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w, Functor f)
+{
+  const int NYW = y.size();
+  const HostMultiBlasExtent extent(*x[0]);
+  const size_t block = multi_blas_host_block(NXZ, sizeof(RegType));
+  const size_t blocks_per_parity = (extent.parity_length + block - 1) / block;
+
+  std::vector<const Float *> X(NXZ), Z(NXZ);
+  std::vector<yFloat *> Y(NYW);
+  std::vector<wFloat *> W(NYW);
+  std::vector<size_t> x_stride(NXZ), z_stride(NXZ), y_stride(NYW), w_stride(NYW);
+  for (int l = 0; l < NXZ; l++) {
+    X[l] = static_cast<const Float *>(x[l]->V());
+    Z[l] = static_cast<const Float *>(z[l]->V());
+    x_stride[l] = HostMultiBlasExtent(*x[l]).parity_stride;
+    z_stride[l] = HostMultiBlasExtent(*z[l]).parity_stride;
+  }
+  for (int k = 0; k < NYW; k++) {
+    Y[k] = static_cast<yFloat *>(y[k]->V());
+    W[k] = static_cast<wFloat *>(w[k]->V());
+    y_stride[k] = HostMultiBlasExtent(*y[k]).parity_stride;
+    w_stride[k] = HostMultiBlasExtent(*w[k]).parity_stride;
+  }
+
+#pragma omp parallel
+  {
+    std::vector<RegType> y_(block), w_(block);
+    RegType zero_;
+    ::quda::zero(zero_);
+
+#pragma omp for schedule(static)
+    for (size_t parity_block = 0; parity_block < extent.nParity * blocks_per_parity; parity_block++) {
+      const int parity = parity_block / blocks_per_parity;
+      const size_t begin = (parity_block - parity * blocks_per_parity) * block;
+      const size_t end = std::min(begin + block, extent.parity_length);
+
+      for (int k = 0; k < NYW; k++) {
+        const size_t y_offset = parity * y_stride[k], w_offset = parity * w_stride[k];
+        for (size_t i = begin; i < end; i++) {
+          y_[i - begin] = host_multi_load<RegType>(Y[k], y_offset + i);
+          w_[i - begin] = Functor::use_w || write::W ? host_multi_load<RegType>(W[k], w_offset + i) : zero_;
+        }
+
+        for (size_t i = begin; i < end; i++) {
+          for (int l = 0; l < NXZ; l++) {
+            RegType x_ = host_multi_load<RegType>(X[l], parity * x_stride[l] + i);
+            RegType z_ = Functor::use_z ? host_multi_load<RegType>(Z[l], parity * z_stride[l] + i) : zero_;
+            f(x_, y_[i - begin], z_, w_[i - begin], k, l);
+          }
+        }
+
+        for (size_t i = begin; i < end; i++) {
+          if (write::Y) host_multi_save(Y[k], y_offset + i, y_[i - begin]);
+          if (write::W) host_multi_save(W[k], w_offset + i, w_[i - begin]);
+        }
+      }
+    }
+  }
+}
+
+template <int NXZ, typename RegType, typename Float, typename yFloat, typename wFloat,
+          template <int MXZ, typename Float_, typename FloatN> class Functor, typename write, typename T>
+void genericMultiBlas(const coeff_array<T> &a, const coeff_array<T> &b, const coeff_array<T> &c,
+                      std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                      std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w)
+{
+  typedef typename scalar<RegType>::type real;
+  typedef typename vector<real, 2>::type Float2;
+
+  const int NYW = y.size();
+  Functor<NXZ, Float2, RegType> f(NYW);
+
+  std::vector<Float2> A, B, C;
+  setHostMultiCoeff<NXZ>(A, B, C, a, b, c, NYW);
+
+  genericMultiBlas<NXZ, RegType, Float, yFloat, wFloat, write>(x, y, z, w, f);
+
+  Amatrix_h = nullptr;
+  Bmatrix_h = nullptr;
+  Cmatrix_h = nullptr;
+
+  blas::bytes += (f.streams() - 2) * x[0]->Bytes() + 2 * y[0]->Bytes();
+  blas::flops += f.flops() * x[0]->RealLength();
+}
+
+/**
+   Driver for the host multi-blas, dispatching on the precisions of
+   the x and y vectors.  Since the elementwise functors are
+   independent of the field order, we only require that all fields
+   share the same order.
+*/
+template <int NXZ, template <int MXZ, typename Float, typename FloatN> class Functor, typename write, typename T>
+void genericMultiBlas(const coeff_array<T> &a, const coeff_array<T> &b, const coeff_array<T> &c,
+                      std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                      std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w)
+{
+  checkHostMultiFields(x, y, z, w);
+
+  if (x[0]->Precision() == QUDA_DOUBLE_PRECISION && y[0]->Precision() == QUDA_DOUBLE_PRECISION) {
+    genericMultiBlas<NXZ, double2, double, double, double, Functor, write>(a, b, c, x, y, z, w);
+  } else if (x[0]->Precision() == QUDA_SINGLE_PRECISION && y[0]->Precision() == QUDA_SINGLE_PRECISION) {
+    genericMultiBlas<NXZ, float2, float, float, float, Functor, write>(a, b, c, x, y, z, w);
+  } else if (x[0]->Precision() == QUDA_SINGLE_PRECISION && y[0]->Precision() == QUDA_DOUBLE_PRECISION) {
+    // w may be of either precision in the mixed-precision kernels
+    if (w[0]->Precision() == QUDA_DOUBLE_PRECISION)
+      genericMultiBlas<NXZ, double2, float, double, double, Functor, write>(a, b, c, x, y, z, w);
+    else
+      genericMultiBlas<NXZ, double2, float, double, float, Functor, write>(a, b, c, x, y, z, w);
+  } else {
+    errorQuda("Precision combination x=%d y=%d not supported", x[0]->Precision(), y[0]->Precision());
+  }
+}
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <generic_multi_blas.cuh>
+
+/**
+   Host (CPU field) implementation of the multi-reduce kernels.  The
+   fields are streamed in cache blocks as for the host multi-blas,
+   with all NXZ x NYW reductions (and any writes to y and w) computed
+   in a single pass over the fields.  The blocks are split into a
+   fixed number of contiguous slabs, each of which accumulates its
+   own partial sums, with the partials then summed in slab order, so
+   the result does not depend on the number of threads.
+*/
+
+/**
+   @brief Number of slabs the host multi-reductions are split into
+*/
+constexpr size_t multi_reduce_host_slabs = 64;
+
+template <int NXZ, typename ReduceType, typename RegType, typename Float, typename yFloat, typename wFloat,
+          typename write, typename Reducer>
+void genericMultiReduce(ReduceType result[], std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                        std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w, Reducer r)
+{
+  const int NYW = y.size();
+  const HostMultiBlasExtent extent(*x[0]);
+  const size_t block = multi_blas_host_block(NXZ, sizeof(RegType));
+  const size_t blocks_per_parity = (extent.parity_length + block - 1) / block;
+  const size_t n_block = extent.nParity * blocks_per_parity;
+  const size_t n_slab = std::min(n_block, multi_reduce_host_slabs);
+
+  std::vector<const Float *> X(NXZ), Z(NXZ);
+  std::vector<yFloat *> Y(NYW);
+  std::vector<wFloat *> W(NYW);
+  std::vector<size_t> x_stride(NXZ), z_stride(NXZ), y_stride(NYW), w_stride(NYW);
+  for (int l = 0; l < NXZ; l++) {
+    X[l] = static_cast<const Float *>(x[l]->V());
+    Z[l] = static_cast<const Float *>(z[l]->V());
+    x_stride[l] = HostMultiBlasExtent(*x[l]).parity_stride;
+    z_stride[l] = HostMultiBlasExtent(*z[l]).parity_stride;
+  }
+  for (int k = 0; k < NYW; k++) {
+    Y[k] = static_cast<yFloat *>(y[k]->V());
+    W[k] = static_cast<wFloat *>(w[k]->V());
+    y_stride[k] = HostMultiBlasExtent(*y[k]).parity_stride;
+    w_stride[k] = HostMultiBlasExtent(*w[k]).parity_stride;
+  }
+
+  // partial sums of each slab, ordered as the result (NXZ-major)
+  std::vector<ReduceType> partial(n_slab * NXZ * NYW);
+
+#pragma omp parallel
+  {
+    std::vector<RegType> y_(block), w_(block);
+    RegType zero_;
+    ::quda::zero(zero_);
+
+#pragma omp for schedule(static)
+    for (size_t slab = 0; slab < n_slab; slab++) {
+      ReduceType *sum = &partial[slab * NXZ * NYW];
+      for (int i = 0; i < NXZ * NYW; i++) ::quda::zero(sum[i]);
+
+      for (size_t parity_block = (slab * n_block) / n_slab; parity_block < ((slab + 1) * n_block) / n_slab;
+           parity_block++) {
+        const int parity = parity_block / blocks_per_parity;
+        const size_t begin = (parity_block - parity * blocks_per_parity) * block;
+        const size_t end = std::min(begin + block, extent.parity_length);
+
+        for (int k = 0; k < NYW; k++) {
+          const size_t y_offset = parity * y_stride[k], w_offset = parity * w_stride[k];
+          for (size_t i = begin; i < end; i++) {
+            y_[i - begin] = host_multi_load<RegType>(Y[k], y_offset + i);
+            w_[i - begin] = Reducer::use_w || write::W ? host_multi_load<RegType>(W[k], w_offset + i) : zero_;
+          }
+
+          // the NXZ sums are independent, so we loop over them innermost
+          ReduceType block_sum[NXZ];
+          for (int l = 0; l < NXZ; l++) ::quda::zero(block_sum[l]);
+          r.pre();
+          for (size_t i = begin; i < end; i++) {
+            for (int l = 0; l < NXZ; l++) {
+              RegType x_ = host_multi_load<RegType>(X[l], parity * x_stride[l] + i);
+              RegType z_ = Reducer::use_z ? host_multi_load<RegType>(Z[l], parity * z_stride[l] + i) : zero_;
+              r(block_sum[l], x_, y_[i - begin], z_, w_[i - begin], k, l);
+            }
+          }
+          for (int l = 0; l < NXZ; l++) {
+            r.post(block_sum[l]);
+            sum[l * NYW + k] += block_sum[l];
+          }
+
+          for (size_t i = begin; i < end; i++) {
+            if (write::Y) host_multi_save(Y[k], y_offset + i, y_[i - begin]);
+            if (write::W) host_multi_save(W[k], w_offset + i, w_[i - begin]);
+          }
+        }
+      }
+    }
+  }
+
+  for (int i = 0; i < NXZ * NYW; i++) ::quda::zero(result[i]);
+  for (size_t slab = 0; slab < n_slab; slab++)
+    for (int i = 0; i < NXZ * NYW; i++) result[i] += partial[slab * NXZ * NYW + i];
+}
+
+template <int NXZ, typename doubleN, typename RegType, typename Float, typename yFloat, typename wFloat,
+          template <int MXZ, typename ReducerType, typename Float_, typename FloatN> class Reducer, typename write,
+          typename T>
+void genericMultiReduce(doubleN result[], const coeff_array<T> &a, const coeff_array<T> &b, const coeff_array<T> &c,
+                        std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                        std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w)
+{
+  typedef typename scalar<RegType>::type real;
+  typedef typename vector<real, 2>::type Float2;
+
+  // we don't have quad precision support on the host so use doubleN instead of ReduceType
+  const int NYW = y.size();
+  Reducer<NXZ, doubleN, Float2, RegType> r(a, b, c, NYW);
+
+  std::vector<Float2> A, B, C;
+  setHostMultiCoeff<NXZ>(A, B, C, a, b, c, NYW);
+
+  genericMultiReduce<NXZ, doubleN, RegType, Float, yFloat, wFloat, write>(result, x, y, z, w, r);
+
+  Amatrix_h = nullptr;
+  Bmatrix_h = nullptr;
+  Cmatrix_h = nullptr;
+
+  blas::bytes += NYW * NXZ * r.streams() * x[0]->Bytes();
+  blas::flops += NYW * NXZ * r.flops() * x[0]->RealLength();
+}
+
+/**
+   Driver for the host multi-reduce, dispatching on the precisions of
+   the x and y vectors.  The result is the local (per-process)
+   reduction, with the global reduction left to the caller as for the
+   device kernels.
+*/
+template <int NXZ, typename doubleN, template <int MXZ, typename ReducerType, typename Float, typename FloatN> class Reducer,
+          typename write, typename T>
+void genericMultiReduce(doubleN result[], const coeff_array<T> &a, const coeff_array<T> &b, const coeff_array<T> &c,
+                        std::vector<ColorSpinorField *> &x, std::vector<ColorSpinorField *> &y,
+                        std::vector<ColorSpinorField *> &z, std::vector<ColorSpinorField *> &w)
+{
+  checkHostMultiFields(x, y, z, w);
+
+  if (x[0]->Precision() == QUDA_DOUBLE_PRECISION && y[0]->Precision() == QUDA_DOUBLE_PRECISION) {
+    genericMultiReduce<NXZ, doubleN, double2, double, double, double, Reducer, write>(result, a, b, c, x, y, z, w);
+  } else if (x[0]->Precision() == QUDA_SINGLE_PRECISION && y[0]->Precision() == QUDA_SINGLE_PRECISION) {
+    genericMultiReduce<NXZ, doubleN, float2, float, float, float, Reducer, write>(result, a, b, c, x, y, z, w);
+  } else if (x[0]->Precision() == QUDA_SINGLE_PRECISION && y[0]->Precision() == QUDA_DOUBLE_PRECISION) {
+    if (w[0]->Precision() == QUDA_DOUBLE_PRECISION)
+      genericMultiReduce<NXZ, doubleN, double2, float, double, double, Reducer, write>(result, a, b, c, x, y, z, w);
+    else
+      genericMultiReduce<NXZ, doubleN, double2, float, double, float, Reducer, write>(result, a, b, c, x, y, z, w);
+  } else {
+    errorQuda("Precision combination x=%d y=%d not supported", x[0]->Precision(), y[0]->Precision());
+  }
+}
@@ -75,11 +75,12 @@ namespace quda {
           seven(path_coeff_array[4]), lepage(path_coeff_array[5]) { }
     };
 
-    template <typename real_, int nColor_, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO>
+    template <typename real_, int nColor_, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO,
+              typename G_ = typename gauge_mapper<real_,reconstruct>::type>
     struct BaseForceArg {
       using real = real_;
       static constexpr int nColor = nColor_;
-      typedef typename gauge_mapper<real,reconstruct>::type G;
+      typedef G_ G;
       const G link;
       int threads;
       int X[4]; // regular grid dims
@@ -113,10 +114,12 @@ namespace quda {
       }
     };
 
-    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO>
-    struct FatLinkArg : public BaseForceArg<real, nColor, reconstruct> {
-      using BaseForceArg = BaseForceArg<real, nColor, reconstruct>;
-      typedef typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type F;
+    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO,
+              typename F_ = typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type,
+              typename G_ = typename gauge_mapper<real,reconstruct>::type>
+    struct FatLinkArg : public BaseForceArg<real, nColor, reconstruct, G_> {
+      using BaseForceArg = BaseForceArg<real, nColor, reconstruct, G_>;
+      typedef F_ F;
       F outA;
       F outB;
       F pMu;
@@ -184,14 +187,9 @@ namespace quda {
     };
 
     template <typename Arg>
-    __global__ void oneLinkTermKernel(Arg arg)
+    __device__ __host__ void oneLinkTerm(Arg &arg, int x_cb, int parity, int sig)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
-      int sig = blockIdx.z * blockDim.z + threadIdx.z;
-      if (sig >= 4) return;
 
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
@@ -205,6 +203,18 @@ namespace quda {
       arg.outA(sig, e_cb, parity) = force;
     }
 
+    template <typename Arg>
+    __global__ void oneLinkTermKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      int sig = blockIdx.z * blockDim.z + threadIdx.z;
+      if (sig >= 4) return;
+
+      oneLinkTerm(arg, x_cb, parity, sig);
+    }
+
 
     /********************************allLinkKernel*********************************************
      *
@@ -230,14 +240,10 @@ namespace quda {
      *
      ************************************************************************************************/
     template <int sig_positive, int mu_positive, typename Arg>
-    __global__ void allLinkKernel(Arg arg)
+    __device__ __host__ void allLink(Arg &arg, int x_cb, int parity)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
 
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
-
       int x[4];
       getCoords(x, x_cb, arg.D, parity);
       for (int d=0; d<4; d++) x[d] += arg.base_idx[d];
@@ -296,6 +302,15 @@ namespace quda {
       arg.outB(0, point_d, 1-parity) = shortP;
     }
 
+    template <int sig_positive, int mu_positive, typename Arg>
+    __global__ void allLinkKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      allLink<sig_positive, mu_positive>(arg, x_cb, parity);
+    }
+
 
     /**************************middleLinkKernel*****************************
      *
@@ -339,14 +354,10 @@ namespace quda {
      *
      ****************************************************************************/
     template <int sig_positive, int mu_positive, bool pMu, bool qMu, bool qPrev, typename Arg>
-    __global__ void middleLinkKernel(Arg arg)
+    __device__ __host__ void middleLink(Arg &arg, int x_cb, int parity)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
 
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
-
       int x[4];
       getCoords(x, x_cb, arg.D, parity);
 
@@ -424,6 +435,15 @@ namespace quda {
 
     }
 
+    template <int sig_positive, int mu_positive, bool pMu, bool qMu, bool qPrev, typename Arg>
+    __global__ void middleLinkKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      middleLink<sig_positive, mu_positive, pMu, qMu, qPrev>(arg, x_cb, parity);
+    }
+
     /***********************************sideLinkKernel***************************
      *
      * In general we need
@@ -455,12 +475,9 @@ namespace quda {
      *
      *********************************************************************************/
     template <int mu_positive, typename Arg>
-    __global__ void sideLinkKernel(Arg arg)
+    __device__ __host__ void sideLink(Arg &arg, int x_cb, int parity)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
 
       int x[4];
       getCoords(x, x_cb ,arg.D, parity);
@@ -509,15 +526,21 @@ namespace quda {
       }
     }
 
-    // Flop count, in two-number pair (matrix_mult, matrix_add)
-    // 		(0,1)
     template <int mu_positive, typename Arg>
-    __global__ void sideLinkShortKernel(Arg arg)
+    __global__ void sideLinkKernel(Arg arg)
     {
-      typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
       int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
       if (x_cb >= arg.threads) return;
       int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      sideLink<mu_positive>(arg, x_cb, parity);
+    }
+
+    // Flop count, in two-number pair (matrix_mult, matrix_add)
+    // 		(0,1)
+    template <int mu_positive, typename Arg>
+    __device__ __host__ void sideLinkShort(Arg &arg, int x_cb, int parity)
+    {
+      typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
 
       int x[4];
       getCoords(x, x_cb, arg.D, parity);
@@ -549,6 +572,15 @@ namespace quda {
       arg.outA(posDir(arg.mu), point_d, parity_) = oprod;
     }
 
+    template <int mu_positive, typename Arg>
+    __global__ void sideLinkShortKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      sideLinkShort<mu_positive>(arg, x_cb, parity);
+    }
+
     template <typename Arg>
     class FatLinkForce : public TunableVectorYZ {
 
@@ -587,7 +619,7 @@ namespace quda {
       }
 
       void apply(const cudaStream_t &stream) {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
         switch (type) {
         case FORCE_ONE_LINK:
           oneLinkTermKernel<Arg> <<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg);
@@ -744,132 +776,276 @@ namespace quda {
       }
     };
 
-    template <typename real, int nColor, QudaReconstructType recon>
-    struct HisqStaplesForce {
-      HisqStaplesForce(GaugeField &Pmu, GaugeField &P3, GaugeField &P5, GaugeField &Pnumu,
-                       GaugeField &Qmu, GaugeField &Qnumu, GaugeField &newOprod,
-                       const GaugeField &oprod, const GaugeField &link,
-                       const double *path_coeff_array)
-      {
-        PathCoefficients<real> act_path_coeff(path_coeff_array);
-        real OneLink = act_path_coeff.one;
-        real ThreeSt = act_path_coeff.three;
-        real mThreeSt = -ThreeSt;
-        real FiveSt  = act_path_coeff.five;
-        real mFiveSt  = -FiveSt;
-        real SevenSt = act_path_coeff.seven;
-        real Lepage  = act_path_coeff.lepage;
-        real mLepage  = -Lepage;
-
-        FatLinkArg<real, nColor> arg(newOprod, oprod, link, OneLink, FORCE_ONE_LINK);
-        FatLinkForce<decltype(arg)> oneLink(arg, link, 0, 0, FORCE_ONE_LINK);
-        oneLink.apply(0);
-
-        for (int sig=0; sig<8; sig++) {
-          for (int mu=0; mu<8; mu++) {
-            if ( (mu == sig) || (mu == opp_dir(sig))) continue;
-
-            //3-link
-            //Kernel A: middle link
-            FatLinkArg<real, nColor> middleLinkArg( newOprod, Pmu, P3, Qmu, oprod, link, mThreeSt, 2, FORCE_MIDDLE_LINK);
-            FatLinkForce<decltype(arg)> middleLink(middleLinkArg, link, sig, mu, FORCE_MIDDLE_LINK);
-            middleLink.apply(0);
+    /**
+       @brief Run a force term over all sites of the working set on the
+       host.  The per-site cores are those used by the kernels, and
+       every write of a given term goes to a site reached through a
+       fixed shift, so the sites can be distributed over the threads
+       exactly as they are over the device threads.
+    */
+    template <typename Arg, typename Site> void forceSitesCPU(const Arg &arg, Site site)
+    {
+#pragma omp parallel for collapse(2) schedule(runtime)
+      for (int parity = 0; parity < 2; parity++) {
+        for (int x_cb = 0; x_cb < arg.threads; x_cb++) site(x_cb, parity);
+      }
+    }
 
-            for (int nu=0; nu < 8; nu++) {
-              if (nu == sig || nu == opp_dir(sig) || nu == mu || nu == opp_dir(mu)) continue;
+    /**
+       @brief Host counterpart of FatLinkForce: same construction and
+       the same template variant selection in apply, for host-ordered
+       (QDP / MILC) fields.
+    */
+    template <typename Arg>
+    class FatLinkForceCPU {
 
-              //5-link: middle link
-              //Kernel B
-              FatLinkArg<real, nColor> middleLinkArg( newOprod, Pnumu, P5, Qnumu, Pmu, Qmu, link, FiveSt, 1, FORCE_MIDDLE_LINK);
-              FatLinkForce<decltype(arg)> middleLink(middleLinkArg, link, sig, nu, FORCE_MIDDLE_LINK);
-              middleLink.apply(0);
+      Arg &arg;
+      const HisqForceType type;
 
-              for (int rho = 0; rho < 8; rho++) {
-                if (rho == sig || rho == opp_dir(sig) || rho == mu || rho == opp_dir(mu) || rho == nu || rho == opp_dir(nu)) continue;
+    public:
+      FatLinkForceCPU(Arg &arg, const GaugeField &, int sig, int mu, HisqForceType type)
+        : arg(arg), type(type) {
+        arg.sig = sig;
+        arg.mu = mu;
+      }
 
-                //7-link: middle link and side link
-                FatLinkArg<real, nColor> arg(newOprod, P5, Pnumu, Qnumu, link, SevenSt, FiveSt != 0 ? SevenSt/FiveSt : 0, 1, FORCE_ALL_LINK, true);
-                FatLinkForce<decltype(arg)> all(arg, link, sig, rho, FORCE_ALL_LINK);
-                all.apply(0);
+      void apply(const cudaStream_t &) {
+        switch (type) {
+        case FORCE_ONE_LINK:
+          forceSitesCPU(arg, [&](int x_cb, int parity) { for (int sig = 0; sig < 4; sig++) oneLinkTerm(arg, x_cb, parity, sig); });
+          break;
+        case FORCE_ALL_LINK:
+          if (goes_forward(arg.sig) && goes_forward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { allLink<1,1>(arg, x_cb, parity); });
+          else if (goes_forward(arg.sig) && goes_backward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { allLink<1,0>(arg, x_cb, parity); });
+          else if (goes_backward(arg.sig) && goes_forward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { allLink<0,1>(arg, x_cb, parity); });
+          else
+            forceSitesCPU(arg, [&](int x_cb, int parity) { allLink<0,0>(arg, x_cb, parity); });
+          break;
+        case FORCE_MIDDLE_LINK:
+          if (!arg.p_mu || !arg.q_mu) errorQuda("Expect p_mu=%d and q_mu=%d to both be true", arg.p_mu, arg.q_mu);
+          if (arg.q_prev) {
+            if (goes_forward(arg.sig) && goes_forward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,1,true,true,true>(arg, x_cb, parity); });
+            else if (goes_forward(arg.sig) && goes_backward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,0,true,true,true>(arg, x_cb, parity); });
+            else if (goes_backward(arg.sig) && goes_forward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,1,true,true,true>(arg, x_cb, parity); });
+            else
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,0,true,true,true>(arg, x_cb, parity); });
+          } else {
+            if (goes_forward(arg.sig) && goes_forward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,1,true,true,false>(arg, x_cb, parity); });
+            else if (goes_forward(arg.sig) && goes_backward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,0,true,true,false>(arg, x_cb, parity); });
+            else if (goes_backward(arg.sig) && goes_forward(arg.mu))
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,1,true,true,false>(arg, x_cb, parity); });
+            else
+              forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,0,true,true,false>(arg, x_cb, parity); });
+          }
+          break;
+        case FORCE_LEPAGE_MIDDLE_LINK:
+          if (arg.p_mu || arg.q_mu || !arg.q_prev)
+            errorQuda("Expect p_mu=%d and q_mu=%d to both be false and q_prev=%d true", arg.p_mu, arg.q_mu, arg.q_prev);
+          if (goes_forward(arg.sig) && goes_forward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,1,false,false,true>(arg, x_cb, parity); });
+          else if (goes_forward(arg.sig) && goes_backward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<1,0,false,false,true>(arg, x_cb, parity); });
+          else if (goes_backward(arg.sig) && goes_forward(arg.mu))
+            forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,1,false,false,true>(arg, x_cb, parity); });
+          else
+            forceSitesCPU(arg, [&](int x_cb, int parity) { middleLink<0,0,false,false,true>(arg, x_cb, parity); });
+          break;
+        case FORCE_SIDE_LINK:
+          if (goes_forward(arg.mu)) forceSitesCPU(arg, [&](int x_cb, int parity) { sideLink<1>(arg, x_cb, parity); });
+          else                      forceSitesCPU(arg, [&](int x_cb, int parity) { sideLink<0>(arg, x_cb, parity); });
+          break;
+        case FORCE_SIDE_LINK_SHORT:
+          if (goes_forward(arg.mu)) forceSitesCPU(arg, [&](int x_cb, int parity) { sideLinkShort<1>(arg, x_cb, parity); });
+          else                      forceSitesCPU(arg, [&](int x_cb, int parity) { sideLinkShort<0>(arg, x_cb, parity); });
+          break;
+        default:
+          errorQuda("Undefined force type %d", type);
+        }
+      }
+    };
+
+    /**
+       @brief The staple-sharing HISQ fat-link force sequence.  The
+       accessor type F and the launcher Force select between the
+       device (FatLinkForce) and host (FatLinkForceCPU) engines.
+    */
+    template <typename real, int nColor, typename F, template <typename> class Force>
+    void hisqStaplesForce(GaugeField &Pmu, GaugeField &P3, GaugeField &P5, GaugeField &Pnumu,
+                          GaugeField &Qmu, GaugeField &Qnumu, GaugeField &newOprod,
+                          const GaugeField &oprod, const GaugeField &link,
+                          const double *path_coeff_array)
+    {
+      PathCoefficients<real> act_path_coeff(path_coeff_array);
+      real OneLink = act_path_coeff.one;
+      real ThreeSt = act_path_coeff.three;
+      real mThreeSt = -ThreeSt;
+      real FiveSt  = act_path_coeff.five;
+      real mFiveSt  = -FiveSt;
+      real SevenSt = act_path_coeff.seven;
+      real Lepage  = act_path_coeff.lepage;
+      real mLepage  = -Lepage;
+
+      FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> arg(newOprod, oprod, link, OneLink, FORCE_ONE_LINK);
+      Force<decltype(arg)> oneLink(arg, link, 0, 0, FORCE_ONE_LINK);
+      oneLink.apply(0);
+
+      for (int sig=0; sig<8; sig++) {
+        for (int mu=0; mu<8; mu++) {
+          if ( (mu == sig) || (mu == opp_dir(sig))) continue;
+
+          //3-link
+          //Kernel A: middle link
+          FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> middleLinkArg( newOprod, Pmu, P3, Qmu, oprod, link, mThreeSt, 2, FORCE_MIDDLE_LINK);
+          Force<decltype(arg)> middleLink(middleLinkArg, link, sig, mu, FORCE_MIDDLE_LINK);
+          middleLink.apply(0);
+
+          for (int nu=0; nu < 8; nu++) {
+            if (nu == sig || nu == opp_dir(sig) || nu == mu || nu == opp_dir(mu)) continue;
+
+            //5-link: middle link
+            //Kernel B
+            FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> middleLinkArg( newOprod, Pnumu, P5, Qnumu, Pmu, Qmu, link, FiveSt, 1, FORCE_MIDDLE_LINK);
+            Force<decltype(arg)> middleLink(middleLinkArg, link, sig, nu, FORCE_MIDDLE_LINK);
+            middleLink.apply(0);
+
+            for (int rho = 0; rho < 8; rho++) {
+              if (rho == sig || rho == opp_dir(sig) || rho == mu || rho == opp_dir(mu) || rho == nu || rho == opp_dir(nu)) continue;
 
-              }//rho
+              //7-link: middle link and side link
+              FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> arg(newOprod, P5, Pnumu, Qnumu, link, SevenSt, FiveSt != 0 ? SevenSt/FiveSt : 0, 1, FORCE_ALL_LINK, true);
+              Force<decltype(arg)> all(arg, link, sig, rho, FORCE_ALL_LINK);
+              all.apply(0);
 
-              //5-link: side link
-              FatLinkArg<real, nColor> arg(newOprod, P3, P5, Qmu, link, mFiveSt, (ThreeSt != 0 ? FiveSt/ThreeSt : 0), 1, FORCE_SIDE_LINK);
-              FatLinkForce<decltype(arg)> side(arg, link, sig, nu, FORCE_SIDE_LINK);
-              side.apply(0);
+            }//rho
 
-            } //nu
+            //5-link: side link
+            FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> arg(newOprod, P3, P5, Qmu, link, mFiveSt, (ThreeSt != 0 ? FiveSt/ThreeSt : 0), 1, FORCE_SIDE_LINK);
+            Force<decltype(arg)> side(arg, link, sig, nu, FORCE_SIDE_LINK);
+            side.apply(0);
 
-            //lepage
-            if (Lepage != 0.) {
-              FatLinkArg<real, nColor> middleLinkArg( newOprod, P5, Pmu, Qmu, link, Lepage, 2, FORCE_LEPAGE_MIDDLE_LINK);
-              FatLinkForce<decltype(arg)> middleLink(middleLinkArg, link, sig, mu, FORCE_LEPAGE_MIDDLE_LINK);
-              middleLink.apply(0);
+          } //nu
 
-              FatLinkArg<real, nColor> arg(newOprod, P3, P5, Qmu, link, mLepage, (ThreeSt != 0 ? Lepage/ThreeSt : 0), 2, FORCE_SIDE_LINK);
-              FatLinkForce<decltype(arg)> side(arg, link, sig, mu, FORCE_SIDE_LINK);
-              side.apply(0);
-            } // Lepage != 0.0
+          //lepage
+          if (Lepage != 0.) {
+            FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> middleLinkArg( newOprod, P5, Pmu, Qmu, link, Lepage, 2, FORCE_LEPAGE_MIDDLE_LINK);
+            Force<decltype(arg)> middleLink(middleLinkArg, link, sig, mu, FORCE_LEPAGE_MIDDLE_LINK);
+            middleLink.apply(0);
 
-            // 3-link side link
-            FatLinkArg<real, nColor> arg(newOprod, P3, link, ThreeSt, 1, FORCE_SIDE_LINK_SHORT);
-            FatLinkForce<decltype(arg)> side(arg, P3, sig, mu, FORCE_SIDE_LINK_SHORT);
+            FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> arg(newOprod, P3, P5, Qmu, link, mLepage, (ThreeSt != 0 ? Lepage/ThreeSt : 0), 2, FORCE_SIDE_LINK);
+            Force<decltype(arg)> side(arg, link, sig, mu, FORCE_SIDE_LINK);
             side.apply(0);
-          }//mu
-        }//sig
+          } // Lepage != 0.0
+
+          // 3-link side link
+          FatLinkArg<real, nColor, QUDA_RECONSTRUCT_NO, F, F> arg(newOprod, P3, link, ThreeSt, 1, FORCE_SIDE_LINK_SHORT);
+          Force<decltype(arg)> side(arg, P3, sig, mu, FORCE_SIDE_LINK_SHORT);
+          side.apply(0);
+        }//mu
+      }//sig
+    }
+
+    template <typename real, int nColor, QudaReconstructType recon>
+    struct HisqStaplesForce {
+      HisqStaplesForce(GaugeField &Pmu, GaugeField &P3, GaugeField &P5, GaugeField &Pnumu,
+                       GaugeField &Qmu, GaugeField &Qnumu, GaugeField &newOprod,
+                       const GaugeField &oprod, const GaugeField &link,
+                       const double *path_coeff_array)
+      {
+        typedef typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type F;
+        hisqStaplesForce<real, nColor, F, FatLinkForce>(Pmu, P3, P5, Pnumu, Qmu, Qnumu, newOprod, oprod, link, path_coeff_array);
+      }
+    };
+
+    template <typename real, int nColor, QudaReconstructType recon>
+    struct HisqStaplesForceCPU {
+      HisqStaplesForceCPU(GaugeField &Pmu, GaugeField &P3, GaugeField &P5, GaugeField &Pnumu,
+                          GaugeField &Qmu, GaugeField &Qnumu, GaugeField &newOprod,
+                          const GaugeField &oprod, const GaugeField &link,
+                          const double *path_coeff_array)
+      {
+        if (link.Order() != oprod.Order() || link.Order() != newOprod.Order())
+          errorQuda("Mismatched orders %d %d %d", link.Order(), oprod.Order(), newOprod.Order());
+        if (link.Order() == QUDA_QDP_GAUGE_ORDER) {
+          typedef typename gauge_order_mapper<real,QUDA_QDP_GAUGE_ORDER,nColor>::type F;
+          hisqStaplesForce<real, nColor, F, FatLinkForceCPU>(Pmu, P3, P5, Pnumu, Qmu, Qnumu, newOprod, oprod, link, path_coeff_array);
+        } else if (link.Order() == QUDA_MILC_GAUGE_ORDER) {
+          typedef typename gauge_order_mapper<real,QUDA_MILC_GAUGE_ORDER,nColor>::type F;
+          hisqStaplesForce<real, nColor, F, FatLinkForceCPU>(Pmu, P3, P5, Pnumu, Qmu, Qnumu, newOprod, oprod, link, path_coeff_array);
+        } else {
+          errorQuda("Gauge order %d not supported on CPU", link.Order());
+        }
       }
     };
 
     void hisqStaplesForce(GaugeField &newOprod, const GaugeField &oprod, const GaugeField &link, const double path_coeff_array[6])
     {
-      if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
-      if (!oprod.isNative()) errorQuda("Unsupported gauge order %d", oprod.Order());
-      if (!newOprod.isNative()) errorQuda("Unsupported gauge order %d", newOprod.Order());
-      if (checkLocation(newOprod,oprod,link) == QUDA_CPU_FIELD_LOCATION) errorQuda("CPU not implemented");
+      QudaFieldLocation location = checkLocation(newOprod,oprod,link);
+      if (location == QUDA_CUDA_FIELD_LOCATION) {
+        if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
+        if (!oprod.isNative()) errorQuda("Unsupported gauge order %d", oprod.Order());
+        if (!newOprod.isNative()) errorQuda("Unsupported gauge order %d", newOprod.Order());
+      }
 
       // create color matrix fields with zero padding
       GaugeFieldParam gauge_param(link);
       gauge_param.reconstruct = QUDA_RECONSTRUCT_NO;
-      gauge_param.order = QUDA_FLOAT2_GAUGE_ORDER;
+      gauge_param.order = location == QUDA_CUDA_FIELD_LOCATION ? QUDA_FLOAT2_GAUGE_ORDER : link.Order();
       gauge_param.geometry = QUDA_SCALAR_GEOMETRY;
+      if (location == QUDA_CPU_FIELD_LOCATION) gauge_param.create = QUDA_ZERO_FIELD_CREATE;
 
-      cudaGaugeField Pmu(gauge_param);
-      cudaGaugeField P3(gauge_param);
-      cudaGaugeField P5(gauge_param);
-      cudaGaugeField Pnumu(gauge_param);
-      cudaGaugeField Qmu(gauge_param);
-      cudaGaugeField Qnumu(gauge_param);
+      GaugeField *Pmu = GaugeField::Create(gauge_param);
+      GaugeField *P3 = GaugeField::Create(gauge_param);
+      GaugeField *P5 = GaugeField::Create(gauge_param);
+      GaugeField *Pnumu = GaugeField::Create(gauge_param);
+      GaugeField *Qmu = GaugeField::Create(gauge_param);
+      GaugeField *Qnumu = GaugeField::Create(gauge_param);
 
       QudaPrecision precision = checkPrecision(oprod, link, newOprod);
-      instantiate<HisqStaplesForce, ReconstructNone>(Pmu, P3, P5, Pnumu, Qmu, Qnumu, newOprod, oprod, link, path_coeff_array);
+      if (location == QUDA_CUDA_FIELD_LOCATION) {
+        instantiate<HisqStaplesForce, ReconstructNone>(*Pmu, *P3, *P5, *Pnumu, *Qmu, *Qnumu, newOprod, oprod, link, path_coeff_array);
+        cudaDeviceSynchronize();
+        checkCudaError();
+      } else {
+        instantiate<HisqStaplesForceCPU, ReconstructNone>(*Pmu, *P3, *P5, *Pnumu, *Qmu, *Qnumu, newOprod, oprod, link, path_coeff_array);
+      }
 
-      cudaDeviceSynchronize();
-      checkCudaError();
+      delete Pmu;
+      delete P3;
+      delete P5;
+      delete Pnumu;
+      delete Qmu;
+      delete Qnumu;
     }
 
-    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO>
-    struct CompleteForceArg : public BaseForceArg<real, nColor, reconstruct> {
+    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO,
+              typename F_ = typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type,
+              typename G_ = typename gauge_mapper<real,reconstruct>::type>
+    struct CompleteForceArg : public BaseForceArg<real, nColor, reconstruct, G_> {
 
-      typedef typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type F;
+      typedef F_ F;
       F outA;        // force output accessor
       const F oProd; // force input accessor
       const real coeff;
 
       CompleteForceArg(GaugeField &force, const GaugeField &link)
-        : BaseForceArg<real, nColor, reconstruct>(link, 0), outA(force), oProd(force), coeff(0.0)
+        : BaseForceArg<real, nColor, reconstruct, G_>(link, 0), outA(force), oProd(force), coeff(0.0)
       { }
 
     };
 
     // Flops count: 4 matrix multiplications per lattice site = 792 Flops per site
     template <typename Arg>
-    __global__ void completeForceKernel(Arg arg)
+    __device__ __host__ void completeForce(Arg &arg, int x_cb, int parity)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
 
       int x[4];
       getCoords(x, x_cb, arg.X, parity);
@@ -890,17 +1066,28 @@ namespace quda {
       }
     }
 
-    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO>
-    struct LongLinkArg : public BaseForceArg<real, nColor, reconstruct> {
+    template <typename Arg>
+    __global__ void completeForceKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      completeForce(arg, x_cb, parity);
+    }
+
+    template <typename real, int nColor, QudaReconstructType reconstruct=QUDA_RECONSTRUCT_NO,
+              typename F_ = typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type,
+              typename G_ = typename gauge_mapper<real,reconstruct>::type>
+    struct LongLinkArg : public BaseForceArg<real, nColor, reconstruct, G_> {
 
       typedef typename gauge::FloatNOrder<real,18,2,11> M;
-      typedef typename gauge_mapper<real,QUDA_RECONSTRUCT_NO>::type F;
+      typedef F_ F;
       F outA;
       const F oProd;
       const real coeff;
 
       LongLinkArg(GaugeField &newOprod, const GaugeField &link, const GaugeField &oprod, real coeff)
-        : BaseForceArg<real, nColor, reconstruct>(link,0), outA(newOprod), oProd(oprod), coeff(coeff)
+        : BaseForceArg<real, nColor, reconstruct, G_>(link,0), outA(newOprod), oProd(oprod), coeff(coeff)
       { }
 
     };
@@ -909,12 +1096,9 @@ namespace quda {
     // 				   (24, 12)
     // 4968 Flops per site in total
     template <typename Arg>
-    __global__ void longLinkKernel(Arg arg)
+    __device__ __host__ void longLink(Arg &arg, int x_cb, int parity)
     {
       typedef Matrix<complex<typename Arg::real>, Arg::nColor> Link;
-      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
-      if (x_cb >= arg.threads) return;
-      int parity = blockIdx.y * blockDim.y + threadIdx.y;
 
       int x[4];
       int dx[4] = {0,0,0,0};
@@ -970,6 +1154,15 @@ namespace quda {
 
     }
 
+    template <typename Arg>
+    __global__ void longLinkKernel(Arg arg)
+    {
+      int x_cb = blockIdx.x * blockDim.x + threadIdx.x;
+      if (x_cb >= arg.threads) return;
+      int parity = blockIdx.y * blockDim.y + threadIdx.y;
+      longLink(arg, x_cb, parity);
+    }
+
     template <typename Arg>
     class HisqForce : public TunableVectorY {
 
@@ -988,7 +1181,7 @@ namespace quda {
       }
 
       void apply(const cudaStream_t &stream) {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
         switch (type) {
         case FORCE_LONG_LINK:
           longLinkKernel<Arg><<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg); break;
@@ -1059,14 +1252,41 @@ namespace quda {
       }
     };
 
+    template <typename real, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+    void hisqLongLinkForceCPU(GaugeField &newOprod, const GaugeField &oldOprod, const GaugeField &link, double coeff)
+    {
+      typedef typename gauge_order_mapper<real,order,nColor>::type F;
+      LongLinkArg<real, nColor, recon, F, F> arg(newOprod, link, oldOprod, coeff);
+      forceSitesCPU(arg, [&](int x_cb, int parity) { longLink(arg, x_cb, parity); });
+    }
+
+    template <typename real, int nColor, QudaReconstructType recon>
+    struct HisqLongLinkForceCPU {
+      HisqLongLinkForceCPU(GaugeField &newOprod, const GaugeField &oldOprod, const GaugeField &link, double coeff)
+      {
+        if (link.Order() != oldOprod.Order() || link.Order() != newOprod.Order())
+          errorQuda("Mismatched orders %d %d %d", link.Order(), oldOprod.Order(), newOprod.Order());
+        if (link.Order() == QUDA_QDP_GAUGE_ORDER) {
+          hisqLongLinkForceCPU<real, nColor, recon, QUDA_QDP_GAUGE_ORDER>(newOprod, oldOprod, link, coeff);
+        } else if (link.Order() == QUDA_MILC_GAUGE_ORDER) {
+          hisqLongLinkForceCPU<real, nColor, recon, QUDA_MILC_GAUGE_ORDER>(newOprod, oldOprod, link, coeff);
+        } else {
+          errorQuda("Gauge order %d not supported on CPU", link.Order());
+        }
+      }
+    };
+
     void hisqLongLinkForce(GaugeField &newOprod, const GaugeField &oldOprod, const GaugeField &link, double coeff)
     {
-      if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
-      if (!oldOprod.isNative()) errorQuda("Unsupported gauge order %d", oldOprod.Order());
-      if (!newOprod.isNative()) errorQuda("Unsupported gauge order %d", newOprod.Order());
-      if (checkLocation(newOprod,oldOprod,link) == QUDA_CPU_FIELD_LOCATION) errorQuda("CPU not implemented");
       checkPrecision(newOprod, link, oldOprod);
-      instantiate<HisqLongLinkForce, ReconstructNone>(newOprod, oldOprod, link, coeff);
+      if (checkLocation(newOprod,oldOprod,link) == QUDA_CUDA_FIELD_LOCATION) {
+        if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
+        if (!oldOprod.isNative()) errorQuda("Unsupported gauge order %d", oldOprod.Order());
+        if (!newOprod.isNative()) errorQuda("Unsupported gauge order %d", newOprod.Order());
+        instantiate<HisqLongLinkForce, ReconstructNone>(newOprod, oldOprod, link, coeff);
+      } else {
+        instantiate<HisqLongLinkForceCPU, ReconstructNone>(newOprod, oldOprod, link, coeff);
+      }
     }
 
     template <typename real, int nColor, QudaReconstructType recon>
@@ -1081,13 +1301,39 @@ namespace quda {
       }
     };
 
+    template <typename real, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+    void hisqCompleteForceCPU(GaugeField &force, const GaugeField &link)
+    {
+      typedef typename gauge_order_mapper<real,order,nColor>::type F;
+      CompleteForceArg<real, nColor, recon, F, F> arg(force, link);
+      forceSitesCPU(arg, [&](int x_cb, int parity) { completeForce(arg, x_cb, parity); });
+    }
+
+    template <typename real, int nColor, QudaReconstructType recon>
+    struct HisqCompleteForceCPU {
+      HisqCompleteForceCPU(GaugeField &force, const GaugeField &link)
+      {
+        if (link.Order() != force.Order()) errorQuda("Mismatched orders %d %d", link.Order(), force.Order());
+        if (link.Order() == QUDA_QDP_GAUGE_ORDER) {
+          hisqCompleteForceCPU<real, nColor, recon, QUDA_QDP_GAUGE_ORDER>(force, link);
+        } else if (link.Order() == QUDA_MILC_GAUGE_ORDER) {
+          hisqCompleteForceCPU<real, nColor, recon, QUDA_MILC_GAUGE_ORDER>(force, link);
+        } else {
+          errorQuda("Gauge order %d not supported on CPU", link.Order());
+        }
+      }
+    };
+
     void hisqCompleteForce(GaugeField &force, const GaugeField &link)
     {
-      if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
-      if (!force.isNative()) errorQuda("Unsupported gauge order %d", force.Order());
-      if (checkLocation(force,link) == QUDA_CPU_FIELD_LOCATION) errorQuda("CPU not implemented");
       checkPrecision(link, force);
-      instantiate<HisqCompleteForce, ReconstructNone>(force, link);
+      if (checkLocation(force,link) == QUDA_CUDA_FIELD_LOCATION) {
+        if (!link.isNative()) errorQuda("Unsupported gauge order %d", link.Order());
+        if (!force.isNative()) errorQuda("Unsupported gauge order %d", force.Order());
+        instantiate<HisqCompleteForce, ReconstructNone>(force, link);
+      } else {
+        instantiate<HisqCompleteForceCPU, ReconstructNone>(force, link);
+      }
     }
 
   } // namespace fermion_force
@@ -75,6 +75,8 @@
 #include <contract_quda.h>
 
 #include <momentum.h>
+#include <async_writer.h>
+#include <gauge_field_manager.h>
 
 
 #include <cuda_profiler_api.h>
@@ -116,22 +118,14 @@ void closeMagma(){
 }
 
 cudaGaugeField *gaugePrecise = nullptr;
-cudaGaugeField *gaugeSloppy = nullptr;
-cudaGaugeField *gaugePrecondition = nullptr;
-cudaGaugeField *gaugeRefinement = nullptr;
-cudaGaugeField *gaugeExtended = nullptr;
-
 cudaGaugeField *gaugeFatPrecise = nullptr;
-cudaGaugeField *gaugeFatSloppy = nullptr;
-cudaGaugeField *gaugeFatPrecondition = nullptr;
-cudaGaugeField *gaugeFatRefinement = nullptr;
-cudaGaugeField *gaugeFatExtended = nullptr;
-
-cudaGaugeField *gaugeLongExtended = nullptr;
 cudaGaugeField *gaugeLongPrecise = nullptr;
-cudaGaugeField *gaugeLongSloppy = nullptr;
-cudaGaugeField *gaugeLongPrecondition = nullptr;
-cudaGaugeField *gaugeLongRefinement = nullptr;
+
+// the sloppy, preconditioner, refinement and extended copies of the
+// resident gauge fields, which are only built when first used
+static GaugeFieldManager gaugeManager("Wilson", gaugePrecise);
+static GaugeFieldManager gaugeFatManager("fat", gaugeFatPrecise);
+static GaugeFieldManager gaugeLongManager("long", gaugeLongPrecise);
 
 cudaGaugeField *gaugeSmeared = nullptr;
 
@@ -689,32 +683,6 @@ void initQuda(int dev)
   initQudaMemory();
 }
 
-// helper for creating extended gauge fields
-static cudaGaugeField* createExtendedGauge(cudaGaugeField &in, const int *R, TimeProfile &profile,
-					   bool redundant_comms=false, QudaReconstructType recon=QUDA_RECONSTRUCT_INVALID)
-{
-  profile.TPSTART(QUDA_PROFILE_INIT);
-  GaugeFieldParam gParamEx(in);
-  gParamEx.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
-  gParamEx.pad = 0;
-  gParamEx.nFace = 1;
-  for (int d = 0; d < 4; d++) {
-    gParamEx.x[d] += 2 * R[d];
-    gParamEx.r[d] = R[d];
-  }
-  auto *out = new cudaGaugeField(gParamEx);
-
-  // copy input field into the extended device gauge field
-  copyExtendedGauge(*out, in, QUDA_CUDA_FIELD_LOCATION);
-
-  profile.TPSTOP(QUDA_PROFILE_INIT);
-
-  // now fill up the halos
-  out->exchangeExtendedGhost(R,profile,redundant_comms);
-
-  return out;
-}
-
 // This is a flag used to signal when we have downloaded new gauge
 // field.  Set by loadGaugeQuda and consumed by loadCloverQuda as one
 // possible flag to indicate we need to recompute the clover field
@@ -762,24 +730,15 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
   // free any current gauge field before new allocations to reduce memory overhead
   switch (param->type) {
     case QUDA_WILSON_LINKS:
-      if (gaugeRefinement != gaugeSloppy && gaugeRefinement) delete gaugeRefinement;
-      if (gaugeSloppy != gaugePrecondition && gaugePrecise != gaugePrecondition && gaugePrecondition)
-        delete gaugePrecondition;
-      if (gaugePrecise != gaugeSloppy && gaugeSloppy) delete gaugeSloppy;
+      gaugeManager.clear();
       if (gaugePrecise && !param->use_resident_gauge) delete gaugePrecise;
       break;
     case QUDA_ASQTAD_FAT_LINKS:
-      if (gaugeFatRefinement != gaugeFatSloppy && gaugeFatRefinement) delete gaugeFatRefinement;
-      if (gaugeFatSloppy != gaugeFatPrecondition && gaugeFatPrecise != gaugeFatPrecondition && gaugeFatPrecondition)
-        delete gaugeFatPrecondition;
-      if (gaugeFatPrecise != gaugeFatSloppy && gaugeFatSloppy) delete gaugeFatSloppy;
+      gaugeFatManager.clear();
       if (gaugeFatPrecise && !param->use_resident_gauge) delete gaugeFatPrecise;
       break;
     case QUDA_ASQTAD_LONG_LINKS:
-      if (gaugeLongRefinement != gaugeLongSloppy && gaugeLongRefinement) delete gaugeLongRefinement;
-      if (gaugeLongSloppy != gaugeLongPrecondition && gaugeLongPrecise != gaugeLongPrecondition && gaugeLongPrecondition)
-        delete gaugeLongPrecondition;
-      if (gaugeLongPrecise != gaugeLongSloppy && gaugeLongSloppy) delete gaugeLongSloppy;
+      gaugeLongManager.clear();
       if (gaugeLongPrecise) delete gaugeLongPrecise;
       break;
     case QUDA_SMEARED_LINKS:
@@ -829,91 +788,34 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
     return;
   }
 
-  // creating sloppy fields isn't really compute, but it is work done on the gpu
-  profileGauge.TPSTART(QUDA_PROFILE_COMPUTE);
-
-  // switch the parameters for creating the mirror sloppy cuda gauge field
-  gauge_param.reconstruct = param->reconstruct_sloppy;
-  gauge_param.setPrecision(param->cuda_prec_sloppy, true);
-  cudaGaugeField *sloppy = nullptr;
-  if (param->cuda_prec == param->cuda_prec_sloppy && param->reconstruct == param->reconstruct_sloppy) {
-    sloppy = precise;
-  } else {
-    sloppy = new cudaGaugeField(gauge_param);
-    sloppy->copy(*precise);
-  }
-
-  // switch the parameters for creating the mirror preconditioner cuda gauge field
-  gauge_param.reconstruct = param->reconstruct_precondition;
-  gauge_param.setPrecision(param->cuda_prec_precondition, true);
-  cudaGaugeField *precondition = nullptr;
-  if (param->cuda_prec == param->cuda_prec_precondition && param->reconstruct == param->reconstruct_precondition) {
-    precondition = precise;
-  } else if (param->cuda_prec_sloppy == param->cuda_prec_precondition
-             && param->reconstruct_sloppy == param->reconstruct_precondition) {
-    precondition = sloppy;
-  } else {
-    precondition = new cudaGaugeField(gauge_param);
-    precondition->copy(*precise);
-  }
-
-  // switch the parameters for creating the refinement cuda gauge field
-  gauge_param.reconstruct = param->reconstruct_refinement_sloppy;
-  gauge_param.setPrecision(param->cuda_prec_refinement_sloppy, true);
-  cudaGaugeField *refinement = nullptr;
-  if (param->cuda_prec_sloppy == param->cuda_prec_refinement_sloppy
-      && param->reconstruct_sloppy == param->reconstruct_refinement_sloppy) {
-    refinement = sloppy;
-  } else {
-    refinement = new cudaGaugeField(gauge_param);
-    refinement->copy(*sloppy);
-  }
-
-  profileGauge.TPSTOP(QUDA_PROFILE_COMPUTE);
-
-  // create an extended preconditioning field
-  cudaGaugeField* extended = nullptr;
-  if (param->overlap){
-    int R[4]; // domain-overlap widths in different directions
-    for (int i=0; i<4; ++i) R[i] = param->overlap*commDimPartitioned(i);
-    extended = createExtendedGauge(*precondition, R, profileGauge);
-  }
-
+  // the sloppy, preconditioner, refinement and extended copies are only recorded here, and built on first use
+  GaugeFieldManager *manager = nullptr;
   switch (param->type) {
     case QUDA_WILSON_LINKS:
       gaugePrecise = precise;
-      gaugeSloppy = sloppy;
-      gaugePrecondition = precondition;
-      gaugeRefinement = refinement;
-
-      if(param->overlap) gaugeExtended = extended;
+      manager = &gaugeManager;
       break;
     case QUDA_ASQTAD_FAT_LINKS:
       gaugeFatPrecise = precise;
-      gaugeFatSloppy = sloppy;
-      gaugeFatPrecondition = precondition;
-      gaugeFatRefinement = refinement;
-
-      if(param->overlap){
-        if(gaugeFatExtended) errorQuda("Extended gauge fat field already allocated");
-	gaugeFatExtended = extended;
-      }
+      manager = &gaugeFatManager;
       break;
     case QUDA_ASQTAD_LONG_LINKS:
       gaugeLongPrecise = precise;
-      gaugeLongSloppy = sloppy;
-      gaugeLongPrecondition = precondition;
-      gaugeLongRefinement = refinement;
-
-      if(param->overlap){
-        if(gaugeLongExtended) errorQuda("Extended gauge long field already allocated");
-   	gaugeLongExtended = extended;
-      }
+      manager = &gaugeLongManager;
       break;
     default:
       errorQuda("Invalid gauge type %d", param->type);
   }
 
+  manager->setRole(GAUGE_FIELD_SLOPPY, param->cuda_prec_sloppy, param->reconstruct_sloppy);
+  manager->setRole(GAUGE_FIELD_PRECONDITION, param->cuda_prec_precondition, param->reconstruct_precondition);
+  manager->setRole(GAUGE_FIELD_REFINEMENT, param->cuda_prec_refinement_sloppy, param->reconstruct_refinement_sloppy);
+  if (param->overlap) {
+    int R[4]; // domain-overlap widths in different directions
+    for (int i=0; i<4; ++i) R[i] = param->overlap*commDimPartitioned(i);
+    manager->setRole(GAUGE_FIELD_EXTENDED, param->cuda_prec_precondition, param->reconstruct_precondition, R);
+  }
+
   profileGauge.TPSTART(QUDA_PROFILE_FREE);
   delete in;
   profileGauge.TPSTOP(QUDA_PROFILE_FREE);
@@ -1228,56 +1130,30 @@ void freeSloppyGaugeQuda()
 {
   if (!initialized) errorQuda("QUDA not initialized");
 
-  if (gaugeSloppy != gaugeRefinement && gaugeRefinement) delete gaugeRefinement;
-  if (gaugeSloppy != gaugePrecondition && gaugePrecise != gaugePrecondition && gaugePrecondition)
-    delete gaugePrecondition;
-  if (gaugePrecise != gaugeSloppy && gaugeSloppy) delete gaugeSloppy;
-
-  gaugeRefinement = nullptr;
-  gaugePrecondition = nullptr;
-  gaugeSloppy = nullptr;
-
-  if (gaugeLongSloppy != gaugeLongRefinement && gaugeLongRefinement) delete gaugeLongRefinement;
-  if (gaugeLongSloppy != gaugeLongPrecondition && gaugeLongPrecise != gaugeLongPrecondition && gaugeLongPrecondition)
-    delete gaugeLongPrecondition;
-  if (gaugeLongPrecise != gaugeLongSloppy && gaugeLongSloppy) delete gaugeLongSloppy;
-
-  gaugeLongRefinement = nullptr;
-  gaugeLongPrecondition = nullptr;
-  gaugeLongSloppy = nullptr;
-
-  if (gaugeFatSloppy != gaugeFatRefinement && gaugeFatRefinement) delete gaugeFatRefinement;
-  if (gaugeFatSloppy != gaugeFatPrecondition && gaugeFatPrecise != gaugeFatPrecondition && gaugeFatPrecondition)
-    delete gaugeFatPrecondition;
-  if (gaugeFatPrecise != gaugeFatSloppy && gaugeFatSloppy) delete gaugeFatSloppy;
-
-  gaugeFatRefinement = nullptr;
-  gaugeFatPrecondition = nullptr;
-  gaugeFatSloppy = nullptr;
+  for (auto manager : {&gaugeManager, &gaugeLongManager, &gaugeFatManager}) {
+    manager->unsetRole(GAUGE_FIELD_REFINEMENT);
+    manager->unsetRole(GAUGE_FIELD_PRECONDITION);
+    manager->unsetRole(GAUGE_FIELD_SLOPPY);
+  }
 }
 
 void freeGaugeQuda(void)
 {
   if (!initialized) errorQuda("QUDA not initialized");
 
-  freeSloppyGaugeQuda();
+  // this also frees the extended copies
+  gaugeManager.clear();
+  gaugeLongManager.clear();
+  gaugeFatManager.clear();
 
   if (gaugePrecise) delete gaugePrecise;
-  if (gaugeExtended) delete gaugeExtended;
-
   gaugePrecise = nullptr;
-  gaugeExtended = nullptr;
 
   if (gaugeLongPrecise) delete gaugeLongPrecise;
-  if (gaugeLongExtended) delete gaugeLongExtended;
-
   gaugeLongPrecise = nullptr;
-  gaugeLongExtended = nullptr;
 
   if (gaugeFatPrecise) delete gaugeFatPrecise;
-
   gaugeFatPrecise = nullptr;
-  gaugeFatExtended = nullptr;
 
   if (gaugeSmeared) delete gaugeSmeared;
 
@@ -1291,146 +1167,12 @@ void freeGaugeQuda(void)
 
 void loadSloppyGaugeQuda(const QudaPrecision *prec, const QudaReconstructType *recon)
 {
-  // first do SU3 links (if they exist)
-  if (gaugePrecise) {
-    GaugeFieldParam gauge_param(*gaugePrecise);
-    // switch the parameters for creating the mirror sloppy cuda gauge field
-
-    gauge_param.reconstruct = recon[0];
-    gauge_param.setPrecision(prec[0], true);
-
-    if (gaugeSloppy) errorQuda("gaugeSloppy already exists");
-
-    if (gauge_param.Precision() == gaugePrecise->Precision() && gauge_param.reconstruct == gaugePrecise->Reconstruct()) {
-      gaugeSloppy = gaugePrecise;
-    } else {
-      gaugeSloppy = new cudaGaugeField(gauge_param);
-      gaugeSloppy->copy(*gaugePrecise);
-    }
-
-    // switch the parameters for creating the mirror preconditioner cuda gauge field
-    gauge_param.reconstruct = recon[1];
-    gauge_param.setPrecision(prec[1], true);
-
-    if (gaugePrecondition) errorQuda("gaugePrecondition already exists");
-
-    if (gauge_param.Precision() == gaugePrecise->Precision() && gauge_param.reconstruct == gaugePrecise->Reconstruct()) {
-      gaugePrecondition = gaugePrecise;
-    } else if (gauge_param.Precision() == gaugeSloppy->Precision()
-               && gauge_param.reconstruct == gaugeSloppy->Reconstruct()) {
-      gaugePrecondition = gaugeSloppy;
-    } else {
-      gaugePrecondition = new cudaGaugeField(gauge_param);
-      gaugePrecondition->copy(*gaugePrecise);
-    }
-
-    // switch the parameters for creating the mirror refinement cuda gauge field
-    gauge_param.reconstruct = recon[2];
-    gauge_param.setPrecision(prec[2], true);
-
-    if (gaugeRefinement) errorQuda("gaugeRefinement already exists");
-
-    if (gauge_param.Precision() == gaugeSloppy->Precision() && gauge_param.reconstruct == gaugeSloppy->Reconstruct()) {
-      gaugeRefinement = gaugeSloppy;
-    } else {
-      gaugeRefinement = new cudaGaugeField(gauge_param);
-      gaugeRefinement->copy(*gaugeSloppy);
-    }
-  }
-
-  // fat links (if they exist)
-  if (gaugeFatPrecise) {
-    GaugeFieldParam gauge_param(*gaugeFatPrecise);
-
-    gauge_param.setPrecision(prec[0], true);
-
-    if (gaugeFatSloppy) errorQuda("gaugeFatSloppy already exists");
-
-    if (gauge_param.Precision() == gaugeFatPrecise->Precision()
-        && gauge_param.reconstruct == gaugeFatPrecise->Reconstruct()) {
-      gaugeFatSloppy = gaugeFatPrecise;
-    } else {
-      gaugeFatSloppy = new cudaGaugeField(gauge_param);
-      gaugeFatSloppy->copy(*gaugeFatPrecise);
-    }
-
-    // switch the parameters for creating the mirror preconditioner cuda gauge field
-    gauge_param.setPrecision(prec[1], true);
-
-    if (gaugeFatPrecondition) errorQuda("gaugeFatPrecondition already exists\n");
-
-    if (gauge_param.Precision() == gaugeFatPrecise->Precision()
-        && gauge_param.reconstruct == gaugeFatPrecise->Reconstruct()) {
-      gaugeFatPrecondition = gaugeFatPrecise;
-    } else if (gauge_param.Precision() == gaugeFatSloppy->Precision()
-               && gauge_param.reconstruct == gaugeFatSloppy->Reconstruct()) {
-      gaugeFatPrecondition = gaugeFatSloppy;
-    } else {
-      gaugePrecondition = new cudaGaugeField(gauge_param);
-      gaugePrecondition->copy(*gaugeFatPrecise);
-    }
-
-    // switch the parameters for creating the mirror refinement cuda gauge field
-    gauge_param.setPrecision(prec[2], true);
-
-    if (gaugeFatRefinement) errorQuda("gaugeFatRefinement already exists\n");
-
-    if (gauge_param.Precision() == gaugeFatSloppy->Precision()
-        && gauge_param.reconstruct == gaugeFatSloppy->Reconstruct()) {
-      gaugeFatRefinement = gaugeFatSloppy;
-    } else {
-      gaugeFatRefinement = new cudaGaugeField(gauge_param);
-      gaugeFatRefinement->copy(*gaugeFatSloppy);
-    }
-  }
-
-  // long links (if they exist)
-  if (gaugeLongPrecise) {
-    GaugeFieldParam gauge_param(*gaugeLongPrecise);
-
-    gauge_param.reconstruct = recon[0];
-    gauge_param.setPrecision(prec[0], true);
-
-    if (gaugeLongSloppy) errorQuda("gaugeLongSloppy already exists");
-
-    if (gauge_param.Precision() == gaugeLongPrecise->Precision()
-        && gauge_param.reconstruct == gaugeLongPrecise->Reconstruct()) {
-      gaugeLongSloppy = gaugeLongPrecise;
-    } else {
-      gaugeLongSloppy = new cudaGaugeField(gauge_param);
-      gaugeLongSloppy->copy(*gaugeLongPrecise);
-    }
-
-    // switch the parameters for creating the mirror preconditioner cuda gauge field
-    gauge_param.reconstruct = recon[1];
-    gauge_param.setPrecision(prec[1], true);
-
-    if (gaugeLongPrecondition) errorQuda("gaugeLongPrecondition already exists\n");
-
-    if (gauge_param.Precision() == gaugeLongPrecise->Precision()
-        && gauge_param.reconstruct == gaugeLongPrecise->Reconstruct()) {
-      gaugeLongPrecondition = gaugeLongPrecise;
-    } else if (gauge_param.Precision() == gaugeLongSloppy->Precision()
-               && gauge_param.reconstruct == gaugeLongSloppy->Reconstruct()) {
-      gaugeLongPrecondition = gaugeLongSloppy;
-    } else {
-      gaugePrecondition = new cudaGaugeField(gauge_param);
-      gaugePrecondition->copy(*gaugeLongPrecise);
-    }
-
-    // switch the parameters for creating the mirror refinement cuda gauge field
-    gauge_param.reconstruct = recon[2];
-    gauge_param.setPrecision(prec[2], true);
-
-    if (gaugeLongRefinement) errorQuda("gaugeLongRefinement already exists\n");
-
-    if (gauge_param.Precision() == gaugeLongSloppy->Precision()
-        && gauge_param.reconstruct == gaugeLongSloppy->Reconstruct()) {
-      gaugeLongRefinement = gaugeLongSloppy;
-    } else {
-      gaugeLongRefinement = new cudaGaugeField(gauge_param);
-      gaugeLongRefinement->copy(*gaugeLongSloppy);
-    }
+  // the copies are built on first use; fat links are never reconstructed
+  const GaugeFieldRole roles[] = {GAUGE_FIELD_SLOPPY, GAUGE_FIELD_PRECONDITION, GAUGE_FIELD_REFINEMENT};
+  for (int i = 0; i < 3; i++) {
+    if (gaugePrecise) gaugeManager.setRole(roles[i], prec[i], recon[i]);
+    if (gaugeFatPrecise) gaugeFatManager.setRole(roles[i], prec[i], gaugeFatPrecise->Reconstruct());
+    if (gaugeLongPrecise) gaugeLongManager.setRole(roles[i], prec[i], recon[i]);
   }
 }
 
@@ -1474,6 +1216,12 @@ void endQuda(void)
 
   if (!initialized) return;
 
+  if (getVerbosity() >= QUDA_VERBOSE) {
+    gaugeManager.print();
+    gaugeFatManager.print();
+    gaugeLongManager.print();
+  }
+
   freeGaugeQuda();
   freeCloverQuda();
 
@@ -1486,12 +1234,14 @@ void endQuda(void)
 
   LatticeField::freeGhostBuffer();
   cpuColorSpinorField::freeGhostBuffer();
+  cpuGaugeField::freeExtendedGhostBuffer();
 
   cublas::destroy();
   blas::end();
 
   pool::flush_pinned();
   pool::flush_device();
+  pool::flush_host();
 
   host_free(num_failures_h);
   num_failures_h = nullptr;
@@ -1508,7 +1258,11 @@ void endQuda(void)
   saveProfile();
 
   // flush any outstanding force monitoring (if enabled)
-  flushForceMonitor();
+  freeForceMonitor();
+
+  // wait for the background writes of the profile and force monitor
+  asyncWriteFinalize();
+  reportProfileErrors();
 
   initialized = false;
 
@@ -1671,13 +1425,26 @@ namespace quda {
   }
 
 
+  // point the Dirac operator at the gauge field copies used in a given role, which builds them on first use
+  static void setDiracGauge(DiracParam &diracParam, QudaInvertParam *inv_param, GaugeFieldRole role)
+  {
+    if (inv_param->dslash_type == QUDA_ASQTAD_DSLASH) {
+      diracParam.fatGauge = gaugeFatManager.get(role);
+      diracParam.longGauge = gaugeLongManager.get(role);
+      diracParam.gauge = diracParam.fatGauge;
+    } else {
+      diracParam.gauge = gaugeManager.get(role);
+      diracParam.fatGauge = nullptr;
+      diracParam.longGauge = nullptr;
+    }
+    if (!diracParam.gauge) errorQuda("Gauge field copy for role %d has not been set", role);
+  }
+
   void setDiracSloppyParam(DiracParam &diracParam, QudaInvertParam *inv_param, const bool pc)
   {
     setDiracParam(diracParam, inv_param, pc);
 
-    diracParam.gauge = inv_param->dslash_type == QUDA_ASQTAD_DSLASH ? gaugeFatSloppy : gaugeSloppy;
-    diracParam.fatGauge = gaugeFatSloppy;
-    diracParam.longGauge = gaugeLongSloppy;
+    setDiracGauge(diracParam, inv_param, GAUGE_FIELD_SLOPPY);
     diracParam.clover = cloverSloppy;
 
     for (int i=0; i<4; i++) {
@@ -1693,9 +1460,7 @@ namespace quda {
   {
     setDiracParam(diracParam, inv_param, pc);
 
-    diracParam.gauge = inv_param->dslash_type == QUDA_ASQTAD_DSLASH ? gaugeFatRefinement : gaugeRefinement;
-    diracParam.fatGauge = gaugeFatRefinement;
-    diracParam.longGauge = gaugeLongRefinement;
+    setDiracGauge(diracParam, inv_param, GAUGE_FIELD_REFINEMENT);
     diracParam.clover = cloverRefinement;
 
     for (int i=0; i<4; i++) {
@@ -1712,15 +1477,7 @@ namespace quda {
   {
     setDiracParam(diracParam, inv_param, pc);
 
-    if (inv_param->overlap) {
-      diracParam.gauge = inv_param->dslash_type == QUDA_ASQTAD_DSLASH ? gaugeFatExtended : gaugeExtended;
-      diracParam.fatGauge = gaugeFatExtended;
-      diracParam.longGauge = gaugeLongExtended;
-    } else {
-      diracParam.gauge = inv_param->dslash_type == QUDA_ASQTAD_DSLASH ? gaugeFatPrecondition : gaugePrecondition;
-      diracParam.fatGauge = gaugeFatPrecondition;
-      diracParam.longGauge = gaugeLongPrecondition;
-    }
+    setDiracGauge(diracParam, inv_param, inv_param->overlap ? GAUGE_FIELD_EXTENDED : GAUGE_FIELD_PRECONDITION);
     diracParam.clover = cloverPrecondition;
 
     for (int i=0; i<4; i++) {
@@ -1731,7 +1488,7 @@ namespace quda {
     if(inv_param->inv_type == QUDA_PCG_INVERTER && inv_param->dslash_type == QUDA_ASQTAD_DSLASH
        && inv_param->dslash_type_precondition == QUDA_STAGGERED_DSLASH) {
        diracParam.type = pc ? QUDA_STAGGEREDPC_DIRAC : QUDA_STAGGERED_DIRAC;
-       diracParam.gauge = gaugeFatPrecondition;
+       diracParam.gauge = gaugeFatManager.get(GAUGE_FIELD_PRECONDITION);
     }
 
     if (diracParam.gauge->Precision() != inv_param->cuda_prec_precondition)
@@ -2144,22 +1901,23 @@ quda::cudaGaugeField *checkGauge(QudaInvertParam *param)
       errorQuda("Solve precision %d doesn't match gauge precision %d", param->cuda_prec, gaugePrecise->Precision());
     }
 
-    if (param->cuda_prec_sloppy != gaugeSloppy->Precision()
-        || param->cuda_prec_precondition != gaugePrecondition->Precision()
-        || param->cuda_prec_refinement_sloppy != gaugeRefinement->Precision()) {
+    if (param->cuda_prec_sloppy != gaugeManager.roleKey(GAUGE_FIELD_SLOPPY).precision
+        || param->cuda_prec_precondition != gaugeManager.roleKey(GAUGE_FIELD_PRECONDITION).precision
+        || param->cuda_prec_refinement_sloppy != gaugeManager.roleKey(GAUGE_FIELD_REFINEMENT).precision) {
       QudaPrecision precision[3]
           = {param->cuda_prec_sloppy, param->cuda_prec_precondition, param->cuda_prec_refinement_sloppy};
-      QudaReconstructType recon[3]
-          = {gaugeSloppy->Reconstruct(), gaugePrecondition->Reconstruct(), gaugeRefinement->Reconstruct()};
+      QudaReconstructType recon[3] = {gaugeManager.roleKey(GAUGE_FIELD_SLOPPY).reconstruct,
+                                      gaugeManager.roleKey(GAUGE_FIELD_PRECONDITION).reconstruct,
+                                      gaugeManager.roleKey(GAUGE_FIELD_REFINEMENT).reconstruct};
       freeSloppyGaugeQuda();
       loadSloppyGaugeQuda(precision, recon);
     }
 
-    if (gaugeSloppy == nullptr) errorQuda("Sloppy gauge field doesn't exist");
-    if (gaugePrecondition == nullptr) errorQuda("Precondition gauge field doesn't exist");
-    if (gaugeRefinement == nullptr) errorQuda("Refinement gauge field doesn't exist");
+    if (!gaugeManager.hasRole(GAUGE_FIELD_SLOPPY)) errorQuda("Sloppy gauge field doesn't exist");
+    if (!gaugeManager.hasRole(GAUGE_FIELD_PRECONDITION)) errorQuda("Precondition gauge field doesn't exist");
+    if (!gaugeManager.hasRole(GAUGE_FIELD_REFINEMENT)) errorQuda("Refinement gauge field doesn't exist");
     if (param->overlap) {
-      if (gaugeExtended == nullptr) errorQuda("Extended gauge field doesn't exist");
+      if (!gaugeManager.hasRole(GAUGE_FIELD_EXTENDED)) errorQuda("Extended gauge field doesn't exist");
     }
     cudaGauge = gaugePrecise;
   } else {
@@ -2170,34 +1928,35 @@ quda::cudaGaugeField *checkGauge(QudaInvertParam *param)
       errorQuda("Solve precision %d doesn't match gauge precision %d", param->cuda_prec, gaugeFatPrecise->Precision());
     }
 
-    if (param->cuda_prec_sloppy != gaugeFatSloppy->Precision()
-        || param->cuda_prec_precondition != gaugeFatPrecondition->Precision()
-        || param->cuda_prec_refinement_sloppy != gaugeFatRefinement->Precision()
-        || param->cuda_prec_sloppy != gaugeLongSloppy->Precision()
-        || param->cuda_prec_precondition != gaugeLongPrecondition->Precision()
-        || param->cuda_prec_refinement_sloppy != gaugeLongRefinement->Precision()) {
+    if (param->cuda_prec_sloppy != gaugeFatManager.roleKey(GAUGE_FIELD_SLOPPY).precision
+        || param->cuda_prec_precondition != gaugeFatManager.roleKey(GAUGE_FIELD_PRECONDITION).precision
+        || param->cuda_prec_refinement_sloppy != gaugeFatManager.roleKey(GAUGE_FIELD_REFINEMENT).precision
+        || param->cuda_prec_sloppy != gaugeLongManager.roleKey(GAUGE_FIELD_SLOPPY).precision
+        || param->cuda_prec_precondition != gaugeLongManager.roleKey(GAUGE_FIELD_PRECONDITION).precision
+        || param->cuda_prec_refinement_sloppy != gaugeLongManager.roleKey(GAUGE_FIELD_REFINEMENT).precision) {
 
       QudaPrecision precision[3]
         = {param->cuda_prec_sloppy, param->cuda_prec_precondition, param->cuda_prec_refinement_sloppy};
       // recon is always no for fat links, so just use long reconstructs here
-      QudaReconstructType recon[3]
-        = {gaugeLongSloppy->Reconstruct(), gaugeLongPrecondition->Reconstruct(), gaugeLongRefinement->Reconstruct()};
+      QudaReconstructType recon[3] = {gaugeLongManager.roleKey(GAUGE_FIELD_SLOPPY).reconstruct,
+                                      gaugeLongManager.roleKey(GAUGE_FIELD_PRECONDITION).reconstruct,
+                                      gaugeLongManager.roleKey(GAUGE_FIELD_REFINEMENT).reconstruct};
       freeSloppyGaugeQuda();
       loadSloppyGaugeQuda(precision, recon);
     }
 
-    if (gaugeFatSloppy == nullptr) errorQuda("Sloppy gauge fat field doesn't exist");
-    if (gaugeFatPrecondition == nullptr) errorQuda("Precondition gauge fat field doesn't exist");
-    if (gaugeFatRefinement == nullptr) errorQuda("Refinement gauge fat field doesn't exist");
+    if (!gaugeFatManager.hasRole(GAUGE_FIELD_SLOPPY)) errorQuda("Sloppy gauge fat field doesn't exist");
+    if (!gaugeFatManager.hasRole(GAUGE_FIELD_PRECONDITION)) errorQuda("Precondition gauge fat field doesn't exist");
+    if (!gaugeFatManager.hasRole(GAUGE_FIELD_REFINEMENT)) errorQuda("Refinement gauge fat field doesn't exist");
     if (param->overlap) {
-      if (gaugeFatExtended == nullptr) errorQuda("Extended gauge fat field doesn't exist");
+      if (!gaugeFatManager.hasRole(GAUGE_FIELD_EXTENDED)) errorQuda("Extended gauge fat field doesn't exist");
     }
 
-    if (gaugeLongSloppy == nullptr) errorQuda("Sloppy gauge long field doesn't exist");
-    if (gaugeLongPrecondition == nullptr) errorQuda("Precondition gauge long field doesn't exist");
-    if (gaugeLongRefinement == nullptr) errorQuda("Refinement gauge long field doesn't exist");
+    if (!gaugeLongManager.hasRole(GAUGE_FIELD_SLOPPY)) errorQuda("Sloppy gauge long field doesn't exist");
+    if (!gaugeLongManager.hasRole(GAUGE_FIELD_PRECONDITION)) errorQuda("Precondition gauge long field doesn't exist");
+    if (!gaugeLongManager.hasRole(GAUGE_FIELD_REFINEMENT)) errorQuda("Refinement gauge long field doesn't exist");
     if (param->overlap) {
-      if (gaugeLongExtended == nullptr) errorQuda("Extended gauge long field doesn't exist");
+      if (!gaugeLongManager.hasRole(GAUGE_FIELD_EXTENDED)) errorQuda("Extended gauge long field doesn't exist");
     }
     cudaGauge = gaugeFatPrecise;
   }
@@ -2330,9 +2089,16 @@ void eigensolveQuda(void **host_evecs, double _Complex *host_evals, QudaEigParam
   }
 
   ColorSpinorParam cudaParam(cpuParam);
-  cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
   cudaParam.create = QUDA_ZERO_FIELD_CREATE;
-  cudaParam.setPrecision(eig_param->cuda_prec_ritz, eig_param->cuda_prec_ritz, true);
+  if (eig_param->location == QUDA_CPU_FIELD_LOCATION) {
+    // Keep the Krylov space on the host, only the operator is applied on the device
+    if (eig_param->cuda_prec_ritz != QUDA_DOUBLE_PRECISION && eig_param->cuda_prec_ritz != QUDA_SINGLE_PRECISION)
+      errorQuda("Precision %d not supported for a host Krylov space", eig_param->cuda_prec_ritz);
+    cudaParam.setPrecision(eig_param->cuda_prec_ritz);
+  } else {
+    cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
+    cudaParam.setPrecision(eig_param->cuda_prec_ritz, eig_param->cuda_prec_ritz, true);
+  }
 
   std::vector<Complex> evals(eig_param->nConv, 0.0);
   std::vector<ColorSpinorField *> kSpace;
@@ -5015,6 +4781,8 @@ double momActionQuda(void* momentum, QudaGaugeParam* param)
   return action;
 }
 
+void flushForceMonitorQuda() { flushForceMonitor(); }
+
 /*
   The following functions are for the Fortran interface.
 */
@@ -5727,6 +5495,49 @@ void contractQuda(const void *hp_x, const void *hp_y, void *h_result, const Quda
   profileContract.TPSTOP(QUDA_PROFILE_TOTAL);
 }
 
+void contractMomentumQuda(const void *hp_x, const void *hp_y, void *h_result, const QudaContractType cType,
+                          const int *mom, int n_mom, QudaInvertParam *param, const int *X)
+{
+  profileContract.TPSTART(QUDA_PROFILE_TOTAL);
+  profileContract.TPSTART(QUDA_PROFILE_INIT);
+  // wrap CPU host side pointers
+  ColorSpinorParam cpuParam((void *)hp_x, *param, X, false, param->input_location);
+  ColorSpinorField *h_x = ColorSpinorField::Create(cpuParam);
+
+  cpuParam.v = (void *)hp_y;
+  ColorSpinorField *h_y = ColorSpinorField::Create(cpuParam);
+
+  // Create device parameter
+  ColorSpinorParam cudaParam(cpuParam);
+  cudaParam.location = QUDA_CUDA_FIELD_LOCATION;
+  cudaParam.create = QUDA_NULL_FIELD_CREATE;
+  cudaParam.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  cudaParam.setPrecision(cpuParam.Precision(), cpuParam.Precision(), true);
+
+  ColorSpinorField *x = ColorSpinorField::Create(cudaParam);
+  ColorSpinorField *y = ColorSpinorField::Create(cudaParam);
+  profileContract.TPSTOP(QUDA_PROFILE_INIT);
+
+  profileContract.TPSTART(QUDA_PROFILE_H2D);
+  *x = *h_x;
+  *y = *h_y;
+  profileContract.TPSTOP(QUDA_PROFILE_H2D);
+
+  // only the projected time-slice sums are returned to the host
+  profileContract.TPSTART(QUDA_PROFILE_COMPUTE);
+  contractMomentumQuda(*x, *y, h_result, cType, mom, n_mom);
+  profileContract.TPSTOP(QUDA_PROFILE_COMPUTE);
+
+  profileContract.TPSTART(QUDA_PROFILE_FREE);
+  delete x;
+  delete y;
+  delete h_y;
+  delete h_x;
+  profileContract.TPSTOP(QUDA_PROFILE_FREE);
+
+  profileContract.TPSTOP(QUDA_PROFILE_TOTAL);
+}
+
 double qChargeQuda()
 {
   profileQCharge.TPSTART(QUDA_PROFILE_TOTAL);
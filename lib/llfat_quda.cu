@@ -15,10 +15,12 @@
 
 namespace quda {
 
-  template <typename Float, int nColor, QudaReconstructType recon>
+  template <typename Float, int nColor, QudaReconstructType recon,
+            typename Link_ = typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type,
+            typename Gauge_ = typename gauge_mapper<Float, recon, 18, QUDA_STAGGERED_PHASE_MILC>::type>
   struct LinkArg {
-    typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type Link;
-    typedef typename gauge_mapper<Float, recon, 18, QUDA_STAGGERED_PHASE_MILC>::type Gauge;
+    typedef Link_ Link;
+    typedef Gauge_ Gauge;
 
     Link link;
     Gauge u;
@@ -53,11 +55,10 @@ namespace quda {
   };
 
   template <typename Float, int dir, typename Arg>
-  __device__ void longLinkDir(Arg &arg, int idx, int parity) {
-    int x[4];
+  __device__ __host__ void longLinkDir(Arg &arg, int idx, int parity) {
+    int x[4], y[4];
     int dx[4] = {0, 0, 0, 0};
 
-    auto y = arg.u.coords;
     getCoords(x, idx, arg.X, parity);
     for (int d=0; d<4; d++) x[d] += arg.border[d];
 
@@ -93,6 +94,19 @@ namespace quda {
     return;
   }
 
+  template <typename Float, typename Arg> void computeLongLinkCPU(Arg &arg)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < (int)arg.threads; idx++) {
+        longLinkDir<Float, 0>(arg, idx, parity);
+        longLinkDir<Float, 1>(arg, idx, parity);
+        longLinkDir<Float, 2>(arg, idx, parity);
+        longLinkDir<Float, 3>(arg, idx, parity);
+      }
+    }
+  }
+
   template <typename Float, int nColor, QudaReconstructType recon>
   class LongLink : public TunableVectorYZ {
     LinkArg<Float, nColor, recon> arg;
@@ -113,7 +127,7 @@ namespace quda {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       computeLongLink<Float><<<tp.grid,tp.block,tp.shared_bytes>>>(arg);
     }
 
@@ -123,21 +137,41 @@ namespace quda {
     long long bytes() const { return 2*4*arg.threads*(3*arg.u.Bytes()+arg.link.Bytes()); }
   };
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void longLinkCPU(const GaugeField &u, GaugeField &lng, double coeff)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    LinkArg<Float, nColor, recon, G, G> arg(lng, u, coeff);
+    computeLongLinkCPU<Float>(arg);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon> struct LongLinkHost {
+    LongLinkHost(const GaugeField &u, GaugeField &lng, double coeff)
+    {
+      if (u.Order() != lng.Order()) errorQuda("Mismatched orders %d %d", u.Order(), lng.Order());
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) {
+        longLinkCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(u, lng, coeff);
+      } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
+        longLinkCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(u, lng, coeff);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", u.Order());
+      }
+    }
+  };
+
   void computeLongLink(GaugeField &lng, const GaugeField &u, double coeff)
   {
-    instantiate<LongLink, ReconstructNo12>(u, lng, coeff); // u first arg so we pick its recon
+    if (checkLocation(lng, u) == QUDA_CUDA_FIELD_LOCATION) {
+      instantiate<LongLink, ReconstructNo12>(u, lng, coeff); // u first arg so we pick its recon
+    } else {
+      instantiate<LongLinkHost, ReconstructNone>(u, lng, coeff);
+    }
   }
 
   template <typename Float, typename Arg>
-  __global__ void computeOneLink(Arg arg)
+  __device__ __host__ void oneLinkDir(Arg &arg, int idx, int parity, int dir)
   {
-    int idx = blockIdx.x*blockDim.x + threadIdx.x;
-    int parity = blockIdx.y * blockDim.y + threadIdx.y;
-    int dir =  blockIdx.z * blockDim.z + threadIdx.z;
-    if (idx >= arg.threads) return;
-    if (dir >= 4) return;
-
-    auto x = arg.u.coords;
+    int x[4];
     getCoords(x, idx, arg.X, parity);
     for (int d=0; d<4; d++) x[d] += arg.border[d];
 
@@ -146,8 +180,28 @@ namespace quda {
     Link a = arg.u(dir, linkIndex(x,arg.E), parity);
 
     arg.link(dir, idx, parity) = arg.coeff*a;
+  }
 
-    return;
+  template <typename Float, typename Arg>
+  __global__ void computeOneLink(Arg arg)
+  {
+    int idx = blockIdx.x*blockDim.x + threadIdx.x;
+    int parity = blockIdx.y * blockDim.y + threadIdx.y;
+    int dir =  blockIdx.z * blockDim.z + threadIdx.z;
+    if (idx >= arg.threads) return;
+    if (dir >= 4) return;
+
+    oneLinkDir<Float>(arg, idx, parity, dir);
+  }
+
+  template <typename Float, typename Arg> void computeOneLinkCPU(Arg &arg)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < (int)arg.threads; idx++) {
+        for (int dir = 0; dir < 4; dir++) oneLinkDir<Float>(arg, idx, parity, dir);
+      }
+    }
   }
 
   template <typename Float, int nColor, QudaReconstructType recon>
@@ -170,7 +224,7 @@ namespace quda {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       computeOneLink<Float><<<tp.grid,tp.block>>>(arg);
     }
 
@@ -179,11 +233,37 @@ namespace quda {
     long long bytes() const { return 2*4*arg.threads*(arg.u.Bytes()+arg.link.Bytes()); }
   };
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void oneLinkCPU(const GaugeField &u, GaugeField &fat, double coeff)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    LinkArg<Float, nColor, recon, G, G> arg(fat, u, coeff);
+    computeOneLinkCPU<Float>(arg);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon> struct OneLinkHost {
+    OneLinkHost(const GaugeField &u, GaugeField &fat, double coeff)
+    {
+      if (u.Order() != fat.Order()) errorQuda("Mismatched orders %d %d", u.Order(), fat.Order());
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) {
+        oneLinkCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(u, fat, coeff);
+      } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
+        oneLinkCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(u, fat, coeff);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", u.Order());
+      }
+    }
+  };
+
   void computeOneLink(GaugeField &fat, const GaugeField &u, double coeff)
   {
     if (u.StaggeredPhase() != QUDA_STAGGERED_PHASE_MILC && u.Reconstruct() != QUDA_RECONSTRUCT_NO)
       errorQuda("Staggered phase type %d not supported", u.StaggeredPhase());
-    instantiate<OneLink, ReconstructNo12>(u, fat, coeff);
+    if (checkLocation(fat, u) == QUDA_CUDA_FIELD_LOCATION) {
+      instantiate<OneLink, ReconstructNo12>(u, fat, coeff);
+    } else {
+      instantiate<OneLinkHost, ReconstructNone>(u, fat, coeff);
+    }
   }
 
   template <typename Float, typename Fat, typename Staple, typename Mulink, typename Gauge>
@@ -232,9 +312,9 @@ namespace quda {
   };
 
   template<typename Float, int mu, int nu, typename Arg>
-  __device__ inline void computeStaple(Matrix<complex<Float>,3> &staple, Arg &arg, int x[], int parity) {
+  __device__ __host__ inline void computeStaple(Matrix<complex<Float>,3> &staple, Arg &arg, int x[], int parity) {
     typedef Matrix<complex<Float>,3> Link;
-    int *y = arg.u.coords, *y_mu = arg.mulink.coords, dx[4] = {0, 0, 0, 0};
+    int y[4], y_mu[4], dx[4] = {0, 0, 0, 0};
 
     /* Computes the upper staple :
      *                 mu (B)
@@ -285,15 +365,14 @@ namespace quda {
     }
   }
 
+  /**
+     @brief Compute the staple of site idx in the direction
+     mu_map[mu_idx], adding it to the fat link of the interior sites
+     and optionally saving it for the next level of staples
+  */
   template<typename Float, bool save_staple, typename Arg>
-  __global__ void computeStaple(Arg arg, int nu)
+  __device__ __host__ void computeStapleSite(Arg &arg, int idx, int parity, int mu_idx, int nu)
   {
-    int idx = blockIdx.x*blockDim.x + threadIdx.x;
-    int parity = blockIdx.y*blockDim.y + threadIdx.y;
-    if (idx >= arg.threads) return;
-
-    int mu_idx = blockIdx.z*blockDim.z + threadIdx.z;
-    if (mu_idx >= arg.n_mu) return;
     int mu;
     switch(mu_idx) {
     case 0: mu = arg.mu_map[0]; break;
@@ -347,7 +426,50 @@ namespace quda {
     }
 
     if (save_staple) arg.staple(mu, linkIndex(x, arg.E), parity) = staple;
-    return;
+  }
+
+  template<typename Float, bool save_staple, typename Arg>
+  __global__ void computeStaple(Arg arg, int nu)
+  {
+    int idx = blockIdx.x*blockDim.x + threadIdx.x;
+    int parity = blockIdx.y*blockDim.y + threadIdx.y;
+    if (idx >= arg.threads) return;
+
+    int mu_idx = blockIdx.z*blockDim.z + threadIdx.z;
+    if (mu_idx >= arg.n_mu) return;
+
+    computeStapleSite<Float, save_staple>(arg, idx, parity, mu_idx, nu);
+  }
+
+  /**
+     @brief Host staple computation.  As on the device, each (site,
+     mu) pair only writes its own fat link and staple, so the sites
+     are distributed over the threads without synchronization.
+  */
+  template<typename Float, bool save_staple, typename Arg>
+  void computeStapleCPU(Arg &arg, int nu)
+  {
+#pragma omp parallel for collapse(2) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < (int)arg.threads; idx++) {
+        for (int mu_idx = 0; mu_idx < arg.n_mu; mu_idx++) computeStapleSite<Float, save_staple>(arg, idx, parity, mu_idx, nu);
+      }
+    }
+  }
+
+  // compute the map for z thread index to mu index in the kernel
+  // mu != nu 3 -> n_mu = 3
+  // mu != nu != rho 2 -> n_mu = 2
+  // mu != nu != rho != sig 1 -> n_mu = 1
+  template <typename Arg> void setStapleMap(Arg &arg, int nu, int dir1, int dir2)
+  {
+    arg.n_mu = 3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 );
+    int j=0;
+    for (int i=0; i<4; i++) {
+      if (i==nu || i==dir1 || i==dir2) continue; // skip these dimensions
+      arg.mu_map[j++] = i;
+    }
+    assert(j == arg.n_mu);
   }
 
   template <typename Float, typename Arg>
@@ -366,21 +488,11 @@ namespace quda {
       : TunableVectorYZ(2,(3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 ))),
 	arg(arg), meta(meta), nu(nu), dir1(dir1), dir2(dir2), save_staple(save_staple)
 	{
-	  // compute the map for z thread index to mu index in the kernel
-	  // mu != nu 3 -> n_mu = 3
-	  // mu != nu != rho 2 -> n_mu = 2
-	  // mu != nu != rho != sig 1 -> n_mu = 1
-	  arg.n_mu = 3 - ( (dir1 > -1) ? 1 : 0 ) - ( (dir2 > -1) ? 1 : 0 );
-	  int j=0;
-	  for (int i=0; i<4; i++) {
-	    if (i==nu || i==dir1 || i==dir2) continue; // skip these dimensions
-	    arg.mu_map[j++] = i;
-	  }
-	  assert(j == arg.n_mu);
+	  setStapleMap(arg, nu, dir1, dir2);
 	}
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (save_staple)
 	computeStaple<Float,true><<<tp.grid,tp.block>>>(arg, nu);
       else
@@ -427,11 +539,45 @@ namespace quda {
     }
   };
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void stapleCPU(const GaugeField &u, GaugeField &fat, GaugeField &staple, const GaugeField &mulink,
+                 int nu, int dir1, int dir2, double coeff, bool save_staple)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    StapleArg<Float,G,G,G,G> arg(G(fat), G(staple), G(mulink), G(u), coeff, fat, u);
+    setStapleMap(arg, nu, dir1, dir2);
+    if (save_staple)
+      computeStapleCPU<Float,true>(arg, nu);
+    else
+      computeStapleCPU<Float,false>(arg, nu);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon>
+  struct StapleHost {
+    StapleHost(const GaugeField &u, GaugeField &fat, GaugeField &staple, const GaugeField &mulink,
+               int nu, int dir1, int dir2, double coeff, bool save_staple)
+    {
+      if (u.Order() != fat.Order() || u.Order() != staple.Order() || u.Order() != mulink.Order())
+        errorQuda("Mismatched orders %d %d %d %d", u.Order(), fat.Order(), staple.Order(), mulink.Order());
+      if (u.Order() == QUDA_QDP_GAUGE_ORDER) {
+        stapleCPU<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
+      } else if (u.Order() == QUDA_MILC_GAUGE_ORDER) {
+        stapleCPU<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", u.Order());
+      }
+    }
+  };
+
   // Compute the staple field for direction nu,excluding the directions dir1 and dir2.
   void computeStaple(GaugeField &fat, GaugeField &staple, const GaugeField &mulink, const GaugeField &u,
 		     int nu, int dir1, int dir2, double coeff, bool save_staple)
   {
-    instantiate<Staple_, ReconstructNo12>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
+    if (checkLocation(fat, staple, mulink, u) == QUDA_CUDA_FIELD_LOCATION) {
+      instantiate<Staple_, ReconstructNo12>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
+    } else {
+      instantiate<StapleHost, ReconstructNone>(u, fat, staple, mulink, nu, dir1, dir2, coeff, save_staple);
+    }
   }
 
   void fatLongKSLink(GaugeField *fat, GaugeField *lng, const GaugeField& u, const double *coeff)
@@ -481,8 +627,10 @@ namespace quda {
       } //nu
     }
 
-    qudaDeviceSynchronize();
-    checkCudaError();
+    if (u.Location() == QUDA_CUDA_FIELD_LOCATION) {
+      qudaDeviceSynchronize();
+      checkCudaError();
+    }
 
     delete staple;
     delete staple1;
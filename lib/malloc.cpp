@@ -2,9 +2,17 @@
 #include <cstdio>
 #include <string>
 #include <map>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
 #include <unistd.h> // for getpagesize()
 #include <execinfo.h> // for backtrace
+#include <sys/mman.h> // for madvise()
 #include <quda_internal.h>
+#include <numa_affinity.h>
 
 #ifdef USE_QDPJIT
 #include "qdp_quda.h"
@@ -23,18 +31,21 @@ namespace quda
   {
 
   public:
-    std::string func;
-    std::string file;
+    // these point to __func__ and __FILE__ literals at the call site, so need not be copied
+    const char *func;
+    const char *file;
     int line;
     size_t size;
     size_t base_size;
+    bool pooled; // whether this allocation belongs to the host memory pool
 #ifdef QUDA_BACKWARDSCPP
     backward::StackTrace st;
 #endif
 
-    MemAlloc() : line(-1), size(0), base_size(0) {}
+    MemAlloc() : func(""), file(""), line(-1), size(0), base_size(0), pooled(false) {}
 
-    MemAlloc(std::string func, std::string file, int line) : func(func), file(file), line(line), size(0), base_size(0)
+    MemAlloc(const char *func, const char *file, int line) :
+      func(func), file(file), line(line), size(0), base_size(0), pooled(false)
     {
 #ifdef QUDA_BACKWARDSCPP
       st.load_here(32);
@@ -50,6 +61,7 @@ namespace quda
         line = a.line;
         size = a.size;
         base_size = a.base_size;
+        pooled = a.pooled;
 #ifdef QUDA_BACKWARDSCPP
         st = a.st;
 #endif
@@ -58,9 +70,88 @@ namespace quda
     }
   };
 
-  static std::map<void *, MemAlloc> alloc[N_ALLOC_TYPE];
-  static long total_bytes[N_ALLOC_TYPE] = {0};
-  static long max_total_bytes[N_ALLOC_TYPE] = {0};
+  /**
+     An allocation call site.  Sites are interned into a static table
+     the first time they allocate, keyed on the func and file string
+     literals, line and allocation type, and accumulate the memory
+     allocated from that site.
+   */
+  struct AllocSite {
+    const char *func;
+    const char *file;
+    int line;
+    AllocType type;
+    long live_bytes;    // presently allocated from this site
+    long peak_bytes;    // maximum ever allocated at once from this site
+    long live_at_peak;  // allocated from this site when the total for this type last peaked (see site_update)
+    unsigned long epoch; // peak epoch of this type when live_at_peak was last updated
+    long count;         // number of allocations made from this site
+    long size_histogram[alloc_histogram_bins]; // allocations binned by floor(log2(size))
+  };
+
+  struct AllocSiteKey {
+    const char *func;
+    const char *file;
+    int line;
+    AllocType type;
+    bool operator==(const AllocSiteKey &other) const
+    {
+      return func == other.func && file == other.file && line == other.line && type == other.type;
+    }
+  };
+
+  struct AllocSiteHash {
+    size_t operator()(const AllocSiteKey &key) const
+    {
+      size_t h = reinterpret_cast<std::uintptr_t>(key.func) * 0x9e3779b97f4a7c15ull;
+      h ^= reinterpret_cast<std::uintptr_t>(key.file) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+      h ^= static_cast<size_t>(key.line) * N_ALLOC_TYPE + key.type + (h << 6) + (h >> 2);
+      return h;
+    }
+  };
+
+  /** What we store for each live allocation */
+  struct AllocRecord {
+    int site;
+    size_t base_size;
+    bool pooled;
+#ifdef QUDA_BACKWARDSCPP
+    backward::StackTrace st;
+#endif
+  };
+
+  /**
+     The live allocations are kept in a hash map sharded on the
+     pointer, so concurrent (de)allocations from OpenMP host code
+     rarely contend.  The site table and the byte counters are updated
+     under a single lock, which is held only for a handful of integer
+     updates.
+   */
+  static const int alloc_shards = 16;
+
+  struct AllocShard {
+    std::mutex mutex;
+    std::unordered_map<void *, AllocRecord> map;
+  };
+
+  static AllocShard alloc[N_ALLOC_TYPE][alloc_shards];
+
+  static AllocShard &alloc_shard(AllocType type, const void *ptr)
+  {
+    std::uintptr_t p = reinterpret_cast<std::uintptr_t>(ptr);
+    return alloc[type][((p >> 12) ^ (p >> 20)) % alloc_shards];
+  }
+
+  static std::mutex track_mutex;
+  static std::deque<AllocSite> alloc_sites;
+  static std::unordered_map<AllocSiteKey, int, AllocSiteHash> alloc_site_index;
+
+  /** incremented each time the total for a given type reaches a new peak */
+  static unsigned long peak_epoch[N_ALLOC_TYPE] = {0};
+
+  // written under track_mutex, but may be read without it
+  static std::atomic<long> total_bytes[N_ALLOC_TYPE];
+  static std::atomic<long> max_total_bytes[N_ALLOC_TYPE];
   static long total_host_bytes, max_total_host_bytes;
   static long total_pinned_bytes, max_total_pinned_bytes;
 
@@ -74,6 +165,16 @@ namespace quda
 
   long host_allocated_peak() { return max_total_bytes[HOST]; }
 
+  long device_allocated() { return total_bytes[DEVICE]; }
+
+  long pinned_allocated() { return total_bytes[PINNED]; }
+
+  long mapped_allocated() { return total_bytes[MAPPED]; }
+
+  long host_allocated() { return total_bytes[HOST]; }
+
+  static const char *alloc_type_str[] = {"Device", "Device Pinned", "Host  ", "Pinned", "Mapped", "Managed"};
+
   static void print_trace (void) {
     void *array[10];
     size_t size;
@@ -93,56 +194,188 @@ namespace quda
 
   static void print_alloc(AllocType type)
   {
-    const char *type_str[] = {"Device", "Device Pinned", "Host  ", "Pinned", "Mapped", "Managed"};
-    std::map<void *, MemAlloc>::iterator entry;
-
-    for (entry = alloc[type].begin(); entry != alloc[type].end(); entry++) {
-      void *ptr = entry->first;
-      MemAlloc a = entry->second;
-      printfQuda("%s  %15p  %15lu  %s(), %s:%d\n", type_str[type], ptr, (unsigned long)a.base_size, a.func.c_str(),
-                 a.file.c_str(), a.line);
+    for (auto &shard : alloc[type]) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (auto &entry : shard.map) {
+        void *ptr = entry.first;
+        const AllocRecord &a = entry.second;
+        const AllocSite &site = alloc_sites[a.site];
+        printfQuda("%s  %15p  %15lu  %s(), %s:%d\n", alloc_type_str[type], ptr, (unsigned long)a.base_size, site.func,
+                   site.file, site.line);
 #ifdef QUDA_BACKWARDSCPP
-      if (getRankVerbosity()) {
-        backward::Printer p;
-        p.print(a.st);
-      }
+        if (getRankVerbosity()) {
+          backward::Printer p;
+          p.print(a.st);
+        }
 #endif
+      }
     }
   }
 
-  static void track_malloc(const AllocType &type, const MemAlloc &a, void *ptr)
+  static bool alloc_empty(AllocType type)
+  {
+    for (auto &shard : alloc[type]) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (!shard.map.empty()) return false;
+    }
+    return true;
+  }
+
+  /**
+     @return Whether ptr is a live allocation of the given type
+   */
+  static bool is_tracked(AllocType type, void *ptr)
+  {
+    AllocShard &shard = alloc_shard(type, ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.map.count(ptr) > 0;
+  }
+
+  /**
+     @brief Intern the call site of an allocation (call with track_mutex held)
+   */
+  static int intern_site(AllocType type, const MemAlloc &a)
+  {
+    AllocSiteKey key = {a.func, a.file, a.line, type};
+    auto it = alloc_site_index.find(key);
+    if (it != alloc_site_index.end()) return it->second;
+
+    alloc_sites.emplace_back();
+    AllocSite &site = alloc_sites.back();
+    memset(&site, 0, sizeof(site));
+    site.func = a.func;
+    site.file = a.file;
+    site.line = a.line;
+    site.type = type;
+    site.epoch = peak_epoch[type];
+
+    int id = alloc_sites.size() - 1;
+    alloc_site_index[key] = id;
+    return id;
+  }
+
+  /**
+     @brief Apply a change in the bytes allocated from a site (call
+     with track_mutex held).  To attribute the peak of each memory
+     type to call sites without scanning all sites on every new peak,
+     each site lazily records its live bytes as of the last peak: the
+     live bytes of a site that has not changed since the last peak are
+     its bytes at the peak, so we only need to snapshot them before a
+     site changes for the first time after a new peak.
+   */
+  static void site_update(AllocSite &site, long delta)
   {
-    total_bytes[type] += a.base_size;
+    const AllocType type = site.type;
+    if (site.epoch != peak_epoch[type]) {
+      site.live_at_peak = site.live_bytes;
+      site.epoch = peak_epoch[type];
+    }
+
+    site.live_bytes += delta;
+    if (site.live_bytes > site.peak_bytes) site.peak_bytes = site.live_bytes;
+
+    total_bytes[type] += delta;
     if (total_bytes[type] > max_total_bytes[type]) {
-      max_total_bytes[type] = total_bytes[type];
+      max_total_bytes[type] = total_bytes[type].load();
+      site.epoch = ++peak_epoch[type];
+      site.live_at_peak = site.live_bytes;
     }
+
     if (type != DEVICE && type != DEVICE_PINNED) {
-      total_host_bytes += a.base_size;
-      if (total_host_bytes > max_total_host_bytes) {
-	max_total_host_bytes = total_host_bytes;
-      }
+      total_host_bytes += delta;
+      if (total_host_bytes > max_total_host_bytes) max_total_host_bytes = total_host_bytes;
     }
     if (type == PINNED || type == MAPPED) {
-      total_pinned_bytes += a.base_size;
-      if (total_pinned_bytes > max_total_pinned_bytes) {
-	max_total_pinned_bytes = total_pinned_bytes;
-      }
+      total_pinned_bytes += delta;
+      if (total_pinned_bytes > max_total_pinned_bytes) max_total_pinned_bytes = total_pinned_bytes;
     }
-    alloc[type][ptr] = a;
   }
 
+  static void track_malloc(const AllocType &type, const MemAlloc &a, void *ptr)
+  {
+    AllocRecord record;
+    record.base_size = a.base_size;
+    record.pooled = a.pooled;
+#ifdef QUDA_BACKWARDSCPP
+    record.st = a.st;
+#endif
+
+    {
+      std::lock_guard<std::mutex> lock(track_mutex);
+      record.site = intern_site(type, a);
+      AllocSite &site = alloc_sites[record.site];
+      site.count++;
+      int bin = 0;
+      while ((a.size >> (bin + 1)) && bin < alloc_histogram_bins - 1) bin++;
+      site.size_histogram[bin]++;
+      site_update(site, a.base_size);
+    }
 
-  static void track_free(const AllocType &type, void *ptr)
+    AllocShard &shard = alloc_shard(type, ptr);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.map[ptr] = record;
+  }
+
+
+  /**
+     @brief Stop tracking an allocation
+     @return The record of the allocation
+   */
+  static AllocRecord track_free(const AllocType &type, void *ptr)
   {
-    size_t size = alloc[type][ptr].base_size;
-    total_bytes[type] -= size;
-    if (type != DEVICE && type != DEVICE_PINNED) {
-      total_host_bytes -= size;
+    AllocRecord record;
+    {
+      AllocShard &shard = alloc_shard(type, ptr);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto it = shard.map.find(ptr);
+      if (it == shard.map.end()) errorQuda("Attempt to untrack invalid %s pointer %p", alloc_type_str[type], ptr);
+      record = it->second;
+      shard.map.erase(it);
     }
-    if (type == PINNED || type == MAPPED) {
-      total_pinned_bytes -= size;
+
+    std::lock_guard<std::mutex> lock(track_mutex);
+    site_update(alloc_sites[record.site], -static_cast<long>(record.base_size));
+    return record;
+  }
+
+  std::vector<AllocSiteStats> getAllocSites()
+  {
+    std::lock_guard<std::mutex> lock(track_mutex);
+    std::vector<AllocSiteStats> stats(alloc_sites.size());
+    for (size_t i = 0; i < alloc_sites.size(); i++) {
+      const AllocSite &site = alloc_sites[i];
+      AllocSiteStats &s = stats[i];
+      s.func = site.func;
+      s.file = site.file;
+      s.line = site.line;
+      s.type = alloc_type_str[site.type];
+      s.live_bytes = site.live_bytes;
+      s.peak_bytes = site.peak_bytes;
+      s.bytes_at_peak = site.epoch == peak_epoch[site.type] ? site.live_at_peak : site.live_bytes;
+      s.count = site.count;
+      for (int b = 0; b < alloc_histogram_bins; b++) s.size_histogram[b] = site.size_histogram[b];
+    }
+    return stats;
+  }
+
+  void printAllocSites(int max_sites)
+  {
+    std::vector<AllocSiteStats> stats = getAllocSites();
+    std::sort(stats.begin(), stats.end(),
+              [](const AllocSiteStats &a, const AllocSiteStats &b) { return a.bytes_at_peak > b.bytes_at_peak; });
+
+    printfQuda("Allocation sites by contribution to the peak (MB):\n");
+    printfQuda("Type           At peak       Peak       Live      Count  Location\n");
+    int n = 0;
+    for (auto &s : stats) {
+      if (n++ == max_sites) break;
+      printfQuda("%-13s %8.1f %10.1f %10.1f %10ld  %s(), %s:%d\n", s.type, s.bytes_at_peak / (double)(1 << 20),
+                 s.peak_bytes / (double)(1 << 20), s.live_bytes / (double)(1 << 20), s.count, s.func, s.file, s.line);
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE) {
+        for (int b = 0; b < alloc_histogram_bins; b++)
+          if (s.size_histogram[b]) printfQuda("    [2^%d, 2^%d) bytes: %ld allocations\n", b, b + 1, s.size_histogram[b]);
+      }
     }
-    alloc[type].erase(ptr);
   }
 
 
@@ -168,8 +401,7 @@ namespace quda
     int align = posix_memalign(&ptr, page_size, a.base_size);
     if (!ptr || align != 0) {
 #endif
-      errorQuda("Failed to allocate aligned host memory of size %zu (%s:%d in %s())\n", size, a.file.c_str(), a.line,
-                a.func.c_str());
+      errorQuda("Failed to allocate aligned host memory of size %zu (%s:%d in %s())\n", size, a.file, a.line, a.func);
     }
     return ptr;
   }
@@ -253,6 +485,128 @@ namespace quda
   }
 
 
+  namespace pool {
+
+    /** Hit and miss counts of a memory pool */
+    struct PoolStats {
+      long hits;
+      long misses;
+    };
+
+    static PoolStats device_stats = {0, 0};
+    static PoolStats pinned_stats = {0, 0};
+    static PoolStats host_stats = {0, 0};
+
+    /** whether to use a memory pool allocator for host memory (set by init()) */
+    static bool host_memory_pool = false;
+
+    /** host allocations smaller than this are passed straight through to malloc */
+    static const size_t host_pool_min_bytes = 1 << 16;
+
+    /** host allocations at least this large are aligned to and backed by huge pages where possible */
+    static const size_t host_huge_page_bytes = 1 << 21;
+
+    /** number of size classes per power of two, which bounds the internal fragmentation to 1/4 */
+    static const int host_pool_sub_classes = 4;
+
+    /** Cache of inactive host-memory allocations for each size class */
+    static std::vector<void *> hostCache[64 * host_pool_sub_classes];
+
+    /** Total size of the inactive host-memory allocations */
+    static size_t host_cached_bytes = 0;
+
+    /** Host allocations may be made from OpenMP threads, so the host pool is guarded by a lock */
+    static std::mutex host_pool_mutex;
+
+    /**
+       @brief Return the size class of a host allocation
+       @param[in] size Size of the requested allocation
+       @param[out] class_bytes Size of allocations in this size class
+       @return Size class index
+    */
+    static int host_size_class(size_t size, size_t &class_bytes)
+    {
+      int k = 0;
+      while (size >> (k + 1)) k++; // k = floor(log2(size))
+      size_t base = static_cast<size_t>(1) << k;
+      size_t step = base / host_pool_sub_classes;
+      size_t j = (size - base + step - 1) / step; // j == host_pool_sub_classes rounds up to the next power of two
+      class_bytes = base + j * step;
+      return k * host_pool_sub_classes + j;
+    }
+
+    /**
+       @brief Free all inactive host-memory allocations
+    */
+    static void host_pool_release()
+    {
+      for (auto &cache : hostCache) {
+        for (auto ptr : cache) free(ptr);
+        cache.clear();
+      }
+      host_cached_bytes = 0;
+    }
+
+    /**
+       @brief Allocate host memory from the pool, rounding up to the
+       size class.  New large allocations are backed by huge pages
+       and first touched in parallel so that the pages are placed on
+       the NUMA nodes of the threads that will use them.
+       @param[in,out] a Allocation record, updated with the size actually allocated
+       @param[in] size Size of allocation
+       @return Pointer to allocated memory, or nullptr on failure
+    */
+    static void *host_pool_malloc(MemAlloc &a, size_t size)
+    {
+      std::lock_guard<std::mutex> lock(host_pool_mutex);
+      size_t bytes;
+      int c = host_size_class(size, bytes);
+      a.base_size = bytes;
+      a.pooled = true;
+
+      if (!hostCache[c].empty()) {
+        void *ptr = hostCache[c].back();
+        hostCache[c].pop_back();
+        host_cached_bytes -= bytes;
+        host_stats.hits++;
+        return ptr;
+      }
+      host_stats.misses++;
+
+      void *ptr = nullptr;
+      for (int attempt = 0; attempt < 2 && !ptr; attempt++) {
+        if (attempt > 0) host_pool_release(); // out of memory, so give back the cache and try again
+        if (bytes >= host_huge_page_bytes) {
+          if (posix_memalign(&ptr, host_huge_page_bytes, bytes) != 0) ptr = nullptr;
+        } else {
+          ptr = malloc(bytes);
+        }
+      }
+
+      if (ptr && bytes >= host_huge_page_bytes) {
+#ifdef MADV_HUGEPAGE
+        madvise(ptr, bytes, MADV_HUGEPAGE); // advisory only, so we ignore failure
+#endif
+        numaFirstTouch(ptr, bytes);
+      }
+      return ptr;
+    }
+
+    /**
+       @brief Return a host allocation to the pool
+       @param[in] ptr Pointer to be (virtually) freed
+       @param[in] bytes Size class size of the allocation
+    */
+    static void host_pool_free(void *ptr, size_t bytes)
+    {
+      std::lock_guard<std::mutex> lock(host_pool_mutex);
+      size_t class_bytes;
+      hostCache[host_size_class(bytes, class_bytes)].push_back(ptr);
+      host_cached_bytes += bytes;
+    }
+
+  } // namespace pool
+
   /**
    * Perform a standard malloc() with error-checking.  This function
    * should only be called via the safe_malloc() macro, defined in
@@ -263,7 +617,7 @@ namespace quda
     MemAlloc a(func, file, line);
     a.size = a.base_size = size;
 
-    void *ptr = malloc(size);
+    void *ptr = (pool::host_memory_pool && size >= pool::host_pool_min_bytes) ? pool::host_pool_malloc(a, size) : malloc(size);
     if (!ptr) { errorQuda("Failed to allocate host memory of size %zu (%s:%d in %s())\n", size, file, line, func); }
     track_malloc(HOST, a, ptr);
 #ifdef HOST_DEBUG
@@ -364,7 +718,7 @@ namespace quda
 
 #ifndef QDP_USE_CUDA_MANAGED_MEMORY
     if (!ptr) { errorQuda("Attempt to free NULL device pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[DEVICE].count(ptr)) {
+    if (!is_tracked(DEVICE, ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
     cudaError_t err = cudaFree(ptr);
@@ -389,7 +743,7 @@ namespace quda
     }
 
     if (!ptr) { errorQuda("Attempt to free NULL device pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[DEVICE_PINNED].count(ptr)) {
+    if (!is_tracked(DEVICE_PINNED, ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
     CUresult err = cuMemFree((CUdeviceptr)ptr);
@@ -405,7 +759,7 @@ namespace quda
   void managed_free_(const char *func, const char *file, int line, void *ptr)
   {
     if (!ptr) { errorQuda("Attempt to free NULL managed pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[MANAGED].count(ptr)) {
+    if (!is_tracked(MANAGED, ptr)) {
       errorQuda("Attempt to free invalid managed pointer (%s:%d in %s())\n", file, line, func);
     }
     cudaError_t err = cudaFree(ptr);
@@ -421,15 +775,18 @@ namespace quda
   void host_free_(const char *func, const char *file, int line, void *ptr)
   {
     if (!ptr) { errorQuda("Attempt to free NULL host pointer (%s:%d in %s())\n", file, line, func); }
-    if (alloc[HOST].count(ptr)) {
-      track_free(HOST, ptr);
-      free(ptr);
-    } else if (alloc[PINNED].count(ptr)) {
+    if (is_tracked(HOST, ptr)) {
+      AllocRecord record = track_free(HOST, ptr);
+      if (record.pooled)
+        pool::host_pool_free(ptr, record.base_size);
+      else
+        free(ptr);
+    } else if (is_tracked(PINNED, ptr)) {
       cudaError_t err = cudaHostUnregister(ptr);
       if (err != cudaSuccess) { errorQuda("Failed to unregister pinned memory (%s:%d in %s())\n", file, line, func); }
       track_free(PINNED, ptr);
       free(ptr);
-    } else if (alloc[MAPPED].count(ptr)) {
+    } else if (is_tracked(MAPPED, ptr)) {
 #ifdef HOST_ALLOC
       cudaError_t err = cudaFreeHost(ptr);
       if (err != cudaSuccess) { errorQuda("Failed to free host memory (%s:%d in %s())\n", file, line, func); }
@@ -456,12 +813,22 @@ namespace quda
     printfQuda("Managed memory used = %.1f MB\n", max_total_bytes[MANAGED] / (double)(1 << 20));
     printfQuda("Page-locked host memory used = %.1f MB\n", max_total_pinned_bytes / (double)(1<<20));
     printfQuda("Total host memory used >= %.1f MB\n", max_total_host_bytes / (double)(1<<20));
+
+    if (pool::device_stats.hits + pool::device_stats.misses > 0)
+      printfQuda("Device memory pool: %ld hits, %ld misses\n", pool::device_stats.hits, pool::device_stats.misses);
+    if (pool::pinned_stats.hits + pool::pinned_stats.misses > 0)
+      printfQuda("Pinned memory pool: %ld hits, %ld misses\n", pool::pinned_stats.hits, pool::pinned_stats.misses);
+    if (pool::host_stats.hits + pool::host_stats.misses > 0)
+      printfQuda("Host memory pool: %ld hits, %ld misses, %.1f MB cached\n", pool::host_stats.hits,
+                 pool::host_stats.misses, pool::host_cached_bytes / (double)(1 << 20));
+    if (getVerbosity() >= QUDA_VERBOSE) printAllocSites();
   }
 
 
   void assertAllMemFree()
   {
-    if (!alloc[DEVICE].empty() || !alloc[DEVICE_PINNED].empty() || !alloc[HOST].empty() || !alloc[PINNED].empty() || !alloc[MAPPED].empty()) {
+    if (!alloc_empty(DEVICE) || !alloc_empty(DEVICE_PINNED) || !alloc_empty(HOST) || !alloc_empty(PINNED)
+        || !alloc_empty(MAPPED)) {
       warningQuda("The following internal memory allocations were not freed.");
       printfQuda("\n");
       print_alloc_header();
@@ -553,6 +920,16 @@ namespace quda
 	  warningQuda("Not using pinned memory pool allocator");
 	  pinned_memory_pool = false;
 	}
+
+	// host memory pool
+	char *enable_host_pool = getenv("QUDA_ENABLE_HOST_MEMORY_POOL");
+	if (!enable_host_pool || strcmp(enable_host_pool,"0")!=0) {
+	  warningQuda("Using host memory pool allocator");
+	  host_memory_pool = true;
+	} else {
+	  warningQuda("Not using host memory pool allocator");
+	  host_memory_pool = false;
+	}
 	pool_init = true;
       }
     }
@@ -565,13 +942,16 @@ namespace quda
 
 	if (pinnedCache.empty()) {
 	  ptr = quda::pinned_malloc_(func, file, line, nbytes);
+	  pinned_stats.misses++;
 	} else {
 	  it = pinnedCache.lower_bound(nbytes);
 	  if (it != pinnedCache.end()) { // sufficiently large allocation found
 	    nbytes = it->first;
 	    ptr = it->second;
 	    pinnedCache.erase(it);
+	    pinned_stats.hits++;
 	  } else { // sacrifice the smallest cached allocation
+	    pinned_stats.misses++;
 	    it = pinnedCache.begin();
 	    ptr = it->second;
 	    pinnedCache.erase(it);
@@ -607,13 +987,16 @@ namespace quda
 
 	if (deviceCache.empty()) {
 	  ptr = quda::device_malloc_(func, file, line, nbytes);
+	  device_stats.misses++;
 	} else {
 	  it = deviceCache.lower_bound(nbytes);
 	  if (it != deviceCache.end()) { // sufficiently large allocation found
 	    nbytes = it->first;
 	    ptr = it->second;
 	    deviceCache.erase(it);
+	    device_stats.hits++;
 	  } else { // sacrifice the smallest cached allocation
+	    device_stats.misses++;
 	    it = deviceCache.begin();
 	    ptr = it->second;
 	    deviceCache.erase(it);
@@ -653,6 +1036,12 @@ namespace quda
       }
     }
 
+    void flush_host()
+    {
+      std::lock_guard<std::mutex> lock(host_pool_mutex);
+      if (host_memory_pool) host_pool_release();
+    }
+
     void flush_device()
     {
       if (device_memory_pool) {
@@ -6,6 +6,9 @@
 #include <cub_helper.cuh>
 #include <instantiate.h>
 #include <fstream>
+#include <memory>
+#include <vector>
+#include <async_writer.h>
 
 namespace quda {
 
@@ -21,13 +24,26 @@ namespace quda {
     return monitor;
   }
 
-  static std::stringstream force_stream;
-  static long long force_count = 0;
-  static long long force_flush = 1000; // how many force samples we accumulate before flushing
+  static long long force_flush = 1000; // how many force samples we batch before flushing
 
-  void flushForceMonitor() {
-    if (!forceMonitor() || comm_rank() != 0) return;
+  /**
+     A force sample awaiting its reduction across ranks.  The
+     per-rank norms are reduced by the kernel directly into a device
+     slot owned by the monitor, and a batch of samples is only copied
+     back, reduced and written when flushed, so recording a force
+     neither synchronizes the device nor communicates.
+  */
+  struct ForceSample {
+    std::string fname;
+    double dt;
+  };
 
+  static std::vector<ForceSample> force_samples;
+  static double2 *force_norms_d = nullptr; // device, force_flush entries, allocated once and freed by endQuda
+
+  // format and write a reduced batch of samples, run by the background I/O thread
+  static void writeForceSamples(const std::vector<ForceSample> &samples, const std::vector<double> &norms)
+  {
     static std::string path = std::string(getenv("QUDA_RESOURCE_PATH"));
     static char *profile_fname = getenv("QUDA_PROFILE_OUTPUT_BASE");
 
@@ -40,29 +56,69 @@ namespace quda {
     } else {
       force_file.open(path.c_str(), std::ios_base::app);
     }
-    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Flushing force monitor data to %s\n", path.c_str());
+
+    std::stringstream force_stream;
+    for (size_t i = 0; i < samples.size(); i++) {
+      force_stream << samples[i].fname << "\t" << std::setprecision(5) << norms[2 * i + 0] << "\t"
+                   << std::setprecision(5) << norms[2 * i + 1] << "\t"
+                   << std::setprecision(5) << samples[i].dt << std::endl;
+    }
     force_file << force_stream.str();
 
     force_file.flush();
     force_file.close();
 
-    // empty the stream buffer
-    force_stream.clear();
-    force_stream.str(std::string());
-
     count++;
   }
 
-  void forceRecord(double2 &force, double dt, const char *fname) {
-    qudaDeviceSynchronize();
-    comm_allreduce_max_array((double*)&force, 2);
-
-    if (comm_rank()==0) {
-      force_stream << fname << "\t" << std::setprecision(5) << force.x << "\t"
-                   << std::setprecision(5) << force.y << "\t"
-                   << std::setprecision(5) << dt << std::endl;
-      if (++force_count % force_flush == 0) flushForceMonitor();
+  void flushForceMonitor() {
+    if (!forceMonitor() || force_samples.empty()) return;
+
+    // copy back the batch once its kernels have completed, then reduce the whole batch at once
+    const size_t n = force_samples.size();
+    std::vector<double> norms(2 * n);
+    qudaMemcpy(norms.data(), force_norms_d, n * sizeof(double2), cudaMemcpyDeviceToHost);
+    comm_allreduce_max_array(norms.data(), 2 * n);
+
+    if (comm_rank() == 0) {
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("Flushing %lu force monitor samples\n", n);
+      auto samples = std::make_shared<std::vector<ForceSample>>(std::move(force_samples));
+      auto reduced = std::make_shared<std::vector<double>>(std::move(norms));
+      asyncWrite([samples, reduced]() { writeForceSamples(*samples, *reduced); });
     }
+
+    force_samples.clear();
+  }
+
+  void freeForceMonitor()
+  {
+    flushForceMonitor();
+    if (force_norms_d) device_free(force_norms_d);
+    force_norms_d = nullptr;
+  }
+
+  /**
+     @brief Return the device slot into which the next force term
+     should reduce its norms.  The slot is owned by the monitor rather
+     than being the shared reduction buffer, which later reductions
+     may overwrite before the sample is flushed.
+  */
+  static double2 *forceSlot()
+  {
+    if (!force_norms_d) force_norms_d = static_cast<double2 *>(device_malloc(force_flush * sizeof(double2)));
+    return force_norms_d + force_samples.size();
+  }
+
+  /**
+     @brief Record the norms of a force term, reduced into the slot
+     returned by forceSlot by a kernel that may still be in flight
+     @param[in] dt Step size
+     @param[in] fname Name of the force term
+  */
+  static void forceRecord(double dt, const char *fname) {
+    force_samples.push_back({fname, dt});
+
+    if (static_cast<long long>(force_samples.size()) == force_flush) flushForceMonitor();
   }
 
   template <typename Float_, int nColor_, QudaReconstructType recon_>
@@ -133,7 +189,7 @@ namespace quda {
     void apply(const cudaStream_t &stream)
     {
       arg.result_h[0] = 0.0;
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       LAUNCH_KERNEL_LOCAL_PARITY(computeMomAction, (*this), tp, stream, arg, decltype(arg));
     }
 
@@ -237,14 +293,15 @@ namespace quda {
       arg(mom, coeff, force),
       meta(force)
     {
+      if (forceMonitor()) arg.result_d = forceSlot();
       apply(0);
-      if (forceMonitor()) forceRecord(*((double2*)arg.result_h), arg.coeff, fname);
+      if (forceMonitor()) forceRecord(arg.coeff, fname);
     }
 
     void apply(const cudaStream_t &stream)
     {
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	LAUNCH_KERNEL_LOCAL_PARITY(UpdateMomKernel, (*this), tp, stream, arg, Float);
       } else {
 	errorQuda("CPU not supported yet\n");
@@ -325,7 +382,7 @@ namespace quda {
 
     void apply(const cudaStream_t &stream)
     {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       ApplyUKernel<<<tp.grid,tp.block,tp.shared_bytes,stream>>>(arg);
     }
 
@@ -14,6 +14,8 @@ namespace quda {
 
   namespace blas {
 
+#include <generic_multi_blas.cuh>
+
     cudaStream_t* getStream();
 
     template <int NXZ, typename FloatN, int M, typename SpinorX, typename SpinorY, typename SpinorZ, typename SpinorW,
@@ -102,7 +104,7 @@ namespace quda {
 
       inline void apply(const cudaStream_t &stream)
       {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
         typedef typename scalar<FloatN>::type Float;
         typedef typename vector<Float, 2>::type Float2;
@@ -396,7 +398,7 @@ namespace quda {
           errorQuda("Precision combination x=%d not supported\n", x[0]->Precision());
         }
       } else { // fields on the cpu
-        errorQuda("Not implemented");
+        genericMultiBlas<NXZ, Functor, write>(a, b, c, x, y, z, w);
       }
     }
 
@@ -559,7 +561,7 @@ namespace quda {
           errorQuda("Precision combination x=%d y=%d not supported\n", x[0]->Precision(), y[0]->Precision());
         }
       } else { // fields on the cpu
-        errorQuda("Not implemented");
+        genericMultiBlas<NXZ, Functor, write>(a, b, c, x, y, z, w);
       }
     }
 
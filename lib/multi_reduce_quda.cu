@@ -12,6 +12,8 @@ namespace quda {
 
   namespace blas {
 
+#include <generic_multi_reduce.cuh>
+
     cudaStream_t* getStream();
     cudaEvent_t* getReduceEvent();
     bool getFastReduce();
@@ -160,7 +162,7 @@ namespace quda {
 
       void apply(const cudaStream_t &stream)
       {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
         multiReduceLaunch<doubleN, ReduceType, FloatN, M, NXZ>(result, arg, tp, stream, *this);
       }
 
@@ -356,6 +358,11 @@ namespace quda {
                         CompositeColorSpinorField &x, CompositeColorSpinorField &y, CompositeColorSpinorField &z,
                         CompositeColorSpinorField &w)
     {
+      if (checkLocation(*x[0], *y[0], *z[0], *w[0]) == QUDA_CPU_FIELD_LOCATION) {
+        genericMultiReduce<NXZ, doubleN, Reducer, write>(result, a, b, c, x, y, z, w);
+        return;
+      }
+
       int reduce_length = siteUnroll ? x[0]->RealLength() : x[0]->Length();
 
       QudaPrecision precision = checkPrecision(*x[0], *y[0], *z[0], *w[0]);
@@ -483,6 +490,11 @@ namespace quda {
       checkPrecision(*x[0], *z[0]);
       checkPrecision(*y[0], *w[0]);
 
+      if (checkLocation(*x[0], *y[0], *z[0], *w[0]) == QUDA_CPU_FIELD_LOCATION) {
+        genericMultiReduce<NXZ, doubleN, Reducer, write>(result, a, b, c, x, y, z, w);
+        return;
+      }
+
       assert(siteUnroll == true);
       int reduce_length = siteUnroll ? x[0]->RealLength() : x[0]->Length();
 
@@ -953,7 +965,7 @@ namespace quda {
       virtual ~TileSizeTune() { setPolicyTuning(false); }
 
       void apply(const cudaStream_t &stream) {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
         // tp.aux.x is where the tile size is stored. "tp" is the tuning struct.
         // it contains blocksize, grid size, etc. Since we're only tuning
@@ -1108,7 +1120,7 @@ namespace quda {
 
       void apply(const cudaStream_t &stream)
       {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
         if (tp.aux.x == 0) {
           TileTuner tile(result, x, y, z, w, hermitian, Anorm, true);
@@ -4,6 +4,7 @@
  *
  */
 
+#include <unistd.h>
 #include <numa_affinity.h>
 #include <quda_internal.h>
 
@@ -51,3 +52,13 @@ int setNumaAffinityNVML(int devid)
   return -1;
 #endif
 }
+
+void numaFirstTouch(void *ptr, size_t bytes)
+{
+  const size_t page_size = getpagesize();
+  const long n_page = (bytes + page_size - 1) / page_size;
+  char *p = static_cast<char *>(ptr);
+
+#pragma omp parallel for schedule(static)
+  for (long i = 0; i < n_page; i++) p[i * page_size] = 0;
+}
@@ -91,7 +91,7 @@ class CalcFunc : TunableLocalParity {
   ~CalcFunc () { }
 
   void apply(const cudaStream_t &stream){
-    tp = tuneLaunch(*this, getTuning(), getVerbosity());
+    tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
     arg.result_h[0] = make_double2(0.0, 0.0);
     LAUNCH_KERNEL_LOCAL_PARITY(compute_Value, (*this), tp, stream, arg, Float, Gauge, NCOLORS, functiontype);
     qudaDeviceSynchronize();
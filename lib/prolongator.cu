@@ -169,7 +169,7 @@ namespace quda {
 	}
       } else {
 	if (out.FieldOrder() == QUDA_FLOAT2_FIELD_ORDER) {
-	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	  TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	  ProlongateArg<Float,vFloat,fineSpin,fineColor,coarseSpin,coarseColor,QUDA_FLOAT2_FIELD_ORDER>
 	    arg(out, in, V, fine_to_coarse, parity);
 	  ProlongateKernel<Float,fineSpin,fineColor,coarseSpin,coarseColor,fine_colors_per_thread>
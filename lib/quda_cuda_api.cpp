@@ -96,7 +96,7 @@ namespace quda {
     }
 
     inline void apply(const cudaStream_t &stream) {
-      tuneLaunch(*this, getTuning(), getVerbosity());
+      tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       if (copy) {
         if (async) {
 #ifdef USE_DRIVER_API
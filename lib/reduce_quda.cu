@@ -245,7 +245,7 @@ namespace quda {
 
       void apply(const cudaStream_t &stream)
       {
-        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+        TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
         result = reduceLaunch<doubleN, ReduceType, FloatN, M>(arg, tp, stream, *this);
       }
 
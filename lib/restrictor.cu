@@ -63,7 +63,7 @@ namespace quda {
 	  errorQuda("Unsupported field order %d", out.FieldOrder());
 	}
       } else {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 
 	if (out.FieldOrder() == QUDA_FLOAT2_FIELD_ORDER) {
 	  typedef RestrictArg<Float,vFloat,fineSpin,fineColor,coarseSpin,coarseColor,QUDA_FLOAT2_FIELD_ORDER> Arg;
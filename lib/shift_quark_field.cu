@@ -158,7 +158,7 @@ namespace quda {
 
         void apply(const cudaStream_t &stream){
           if(location == QUDA_CUDA_FIELD_LOCATION){
-            TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+            TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
             shiftColorSpinorFieldKernel<Output,Input><<<tp.grid,tp.block,tp.shared_bytes>>>(arg);
 #ifdef MULTI_GPU
             // Need to perform some communication and call exterior kernel, I guess
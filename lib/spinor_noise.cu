@@ -13,6 +13,7 @@
 #include <tune_quda.h>
 #include <utility> // for std::swap
 #include <random_quda.h>
+#include <index_helper.cuh>
 
 namespace quda {
 
@@ -102,7 +103,7 @@ namespace quda {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       SpinorNoiseGPU<real, Ns, Nc, type><<<tp.grid, tp.block, tp.shared_bytes, stream>>>(arg);
     }
 
@@ -194,8 +195,75 @@ namespace quda {
     }
   }
 
+  /**
+     Host noise generation for CPU fields in space-spin-color order.
+     Each complex element is drawn from the counter-based generator
+     keyed on the global site index and the spin-color component, so
+     the field is independent of the thread count and process grid.
+  */
+  template <typename real> void spinorNoiseHost(ColorSpinorField &src, const CounterRNG &rng, QudaNoiseType type)
+  {
+    if (type != QUDA_NOISE_GAUSS && type != QUDA_NOISE_UNIFORM) errorQuda("Noise type %d not implemented", type);
+
+    const int nParity = src.SiteSubset();
+    const int nSpinColor = src.Nspin() * src.Ncolor();
+    const int volumeCB = src.VolumeCB();
+    const size_t parity_offset = src.Bytes() / (2 * sizeof(real));
+
+    int X[4], G[4], origin[4];
+    for (int d = 0; d < 4; d++) X[d] = src.X(d);
+    if (nParity == 1) X[0] *= 2; // need full lattice dims
+    for (int d = 0; d < 4; d++) {
+      G[d] = X[d] * comm_dim(d);
+      origin[d] = X[d] * comm_coord(d);
+    }
+    const int volume4CB = X[0] * X[1] * X[2] * X[3] / 2; // any fifth dimension runs slowest
+
+    real *v = static_cast<real *>(src.V());
+
+#pragma omp parallel for collapse(2)
+    for (int parity = 0; parity < nParity; parity++) {
+      for (int x_cb = 0; x_cb < volumeCB; x_cb++) {
+        int x[4];
+        getCoords(x, x_cb % volume4CB, X, parity);
+        unsigned long long site = x_cb / volume4CB;
+        for (int d = 3; d >= 0; d--) site = site * G[d] + origin[d] + x[d];
+
+        real *v_site = v + parity * parity_offset + static_cast<size_t>(x_cb) * 2 * nSpinColor;
+        for (int sc = 0; sc < nSpinColor; sc++) {
+          double re, im;
+          if (type == QUDA_NOISE_GAUSS) rng.gauss(re, im, site, sc);
+          else rng.uniform(re, im, site, sc);
+          v_site[2 * sc + 0] = re;
+          v_site[2 * sc + 1] = im;
+        }
+      }
+    }
+  }
+
+  void spinorNoiseHost(ColorSpinorField &src, const CounterRNG &rng, QudaNoiseType type)
+  {
+    switch (src.Precision()) {
+    case QUDA_DOUBLE_PRECISION: spinorNoiseHost<double>(src, rng, type); break;
+    case QUDA_SINGLE_PRECISION: spinorNoiseHost<float>(src, rng, type); break;
+    default: errorQuda("Precision %d not implemented", src.Precision());
+    }
+  }
+
+  static bool useHostNoise(const ColorSpinorField &src)
+  {
+    return src.Location() == QUDA_CPU_FIELD_LOCATION && src.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER
+      && src.Precision() >= QUDA_SINGLE_PRECISION;
+  }
+
   void spinorNoise(ColorSpinorField &src_, RNG &randstates, QudaNoiseType type)
   {
+    // host fields are generated in place with the counter-based generator
+    if (useHostNoise(src_)) {
+      spinorNoiseHost(src_, CounterRNG(randstates.Seed(), randstates.nextHostStream()), type);
+      return;
+    }
+
     // if src is a CPU field then create GPU field
     ColorSpinorField *src = &src_;
     if (src_.Location() == QUDA_CPU_FIELD_LOCATION || src_.Precision() < QUDA_SINGLE_PRECISION) {
@@ -221,6 +289,11 @@ namespace quda {
 
   void spinorNoise(ColorSpinorField &src, unsigned long long seed, QudaNoiseType type)
   {
+    if (useHostNoise(src)) {
+      spinorNoiseHost(src, CounterRNG(seed), type);
+      return;
+    }
+
     RNG *randstates = new RNG(src, seed);
     randstates->Init();
     spinorNoise(src, *randstates, type);
@@ -292,7 +292,7 @@ namespace quda {
     void apply(const cudaStream_t &stream){
       if (meta.Location() == QUDA_CUDA_FIELD_LOCATION) {
 	// Disable tuning for the time being
-	TuneParam tp = tuneLaunch(*this, QUDA_TUNE_NO, getVerbosity());
+	TuneParam tp = tuneLaunch(*this, QUDA_TUNE_NO, getVerbosity(), stream);
 	if (arg.kernelType == OPROD_INTERIOR_KERNEL) {
 	  interiorOprodKernel<<<tp.grid,tp.block,tp.shared_bytes, stream>>>(arg);
 	} else if (arg.kernelType == OPROD_EXTERIOR_KERNEL) {
@@ -0,0 +1,320 @@
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <tune_cache.h>
+#include <trace.h>
+#include <uint_to_char.h>
+
+namespace quda {
+
+  static const char trace_magic[8] = "QUDATRC";
+  static const std::uint32_t trace_version = 1;
+
+  static int enable_trace = 0;
+
+  int traceEnabled()
+  {
+    static bool init = false;
+
+    if (!init) {
+      char *enable_trace_env = getenv("QUDA_ENABLE_TRACE");
+      if (enable_trace_env) {
+        if (strcmp(enable_trace_env, "1") == 0) {
+          // only explicitly posted trace events are included
+          enable_trace = 1;
+        } else if (strcmp(enable_trace_env, "2") == 0) {
+          // enable full kernel trace and posted trace events
+          enable_trace = 2;
+        }
+      }
+      init = true;
+    }
+    return enable_trace;
+  }
+
+  /**
+     The ring buffer, allocated on the first recorded event.  The
+     number of records ever written is given by head, so the live
+     records are [max(head - capacity, 0), head) modulo capacity.
+   */
+  static std::vector<TraceRecord> trace_buffer;
+  static std::uint64_t trace_head = 0;
+  static std::uint64_t trace_mask = 0;
+  static std::chrono::steady_clock::time_point trace_epoch;
+
+  /** interned keys, with the id of a key being its index */
+  static std::vector<TuneKey> trace_keys;
+  static TuneCacheMap<std::uint32_t> trace_key_ids;
+
+  static void initTrace()
+  {
+    std::size_t capacity = 1 << 18;
+    char *size_env = getenv("QUDA_TRACE_BUFFER_SIZE");
+    if (size_env) {
+      long size = atol(size_env);
+      if (size <= 0) errorQuda("Invalid QUDA_TRACE_BUFFER_SIZE=%s", size_env);
+      capacity = size;
+    }
+
+    std::size_t n = 1;
+    while (n < capacity) n *= 2;
+    trace_buffer.resize(n);
+    trace_mask = n - 1;
+    trace_epoch = std::chrono::steady_clock::now();
+
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Allocated trace buffer with %lu records (%lu bytes)\n", n, n * sizeof(TraceRecord));
+  }
+
+  static std::uint32_t internKey(const TuneKey &key)
+  {
+    auto it = trace_key_ids.find(key);
+    if (it != trace_key_ids.end()) return it->second;
+
+    std::uint32_t id = trace_keys.size();
+    trace_keys.push_back(key);
+    trace_key_ids[key] = id;
+    return id;
+  }
+
+  static void record(TraceEventType type, std::uint32_t id, float duration, int stream)
+  {
+    if (trace_buffer.empty()) initTrace();
+
+    TraceRecord &r = trace_buffer[trace_head++ & trace_mask];
+    r.time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace_epoch).count();
+    r.id = id;
+    r.type = type;
+    r.stream = stream;
+    r.duration = duration;
+    r.unused = 0;
+    r.device_bytes = device_allocated();
+    r.pinned_bytes = pinned_allocated();
+    r.mapped_bytes = mapped_allocated();
+    r.host_bytes = host_allocated();
+  }
+
+  void traceKernel(const TuneKey &key, float time, int stream)
+  {
+    if (traceEnabled() < 2) return;
+    record(QUDA_TRACE_KERNEL, internKey(key), time, stream);
+  }
+
+  void postTrace_(const char *func, const char *file, int line)
+  {
+    if (traceEnabled() < 1) return;
+    char aux[TuneKey::aux_n];
+    strcpy(aux, file);
+    strcat(aux, ":");
+    char tmp[TuneKey::aux_n];
+    i32toa(tmp, line);
+    strcat(aux, tmp);
+    record(QUDA_TRACE_POST, internKey(TuneKey("", func, aux)), 0.0, 0);
+  }
+
+  void traceRegion(int &id, const char *profile, const char *region, bool begin)
+  {
+    if (traceEnabled() < 1) return;
+    if (id < 0) id = internKey(TuneKey("", profile, region));
+    record(begin ? QUDA_TRACE_REGION_BEGIN : QUDA_TRACE_REGION_END, id, 0.0, 0);
+  }
+
+  std::size_t saveTrace(const std::string &path)
+  {
+    std::ofstream out(path.c_str(), std::ios::binary);
+    if (!out) {
+      warningQuda("Unable to open trace file %s", path.c_str());
+      return 0;
+    }
+
+    const std::uint64_t capacity = trace_buffer.size();
+    const std::uint64_t first = trace_head > capacity ? trace_head - capacity : 0;
+
+    TraceFileHeader header;
+    memcpy(header.magic, trace_magic, sizeof(header.magic));
+    header.version = trace_version;
+    header.record_bytes = sizeof(TraceRecord);
+    header.n_records = trace_head - first;
+    header.n_dropped = first;
+    header.n_keys = trace_keys.size();
+    header.rank = comm_rank();
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (auto &key : trace_keys) {
+      out.write(key.volume, strlen(key.volume) + 1);
+      out.write(key.name, strlen(key.name) + 1);
+      out.write(key.aux, strlen(key.aux) + 1);
+    }
+
+    // write out in chronological order, which is at most two contiguous pieces of the ring
+    if (header.n_records > 0) {
+      std::uint64_t begin = first & trace_mask;
+      std::uint64_t end = trace_head & trace_mask;
+      const char *buffer = reinterpret_cast<const char *>(trace_buffer.data());
+      if (begin < end) {
+        out.write(buffer + begin * sizeof(TraceRecord), (end - begin) * sizeof(TraceRecord));
+      } else {
+        out.write(buffer + begin * sizeof(TraceRecord), (capacity - begin) * sizeof(TraceRecord));
+        out.write(buffer, end * sizeof(TraceRecord));
+      }
+    }
+
+    out.close();
+    if (out.fail()) warningQuda("Error writing trace file %s", path.c_str());
+    return header.n_records;
+  }
+
+  /**
+     @brief Write a string as a JSON string literal
+   */
+  static void writeJSONString(std::ostream &out, const char *s)
+  {
+    out << '"';
+    for (; *s; s++) {
+      switch (*s) {
+      case '"': out << "\\\""; break;
+      case '\\': out << "\\\\"; break;
+      case '\t': out << "\\t"; break;
+      case '\n': out << "\\n"; break;
+      default:
+        if (static_cast<unsigned char>(*s) < 0x20)
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*s) << std::dec
+              << std::setfill(' ');
+        else
+          out << *s;
+      }
+    }
+    out << '"';
+  }
+
+  bool convertTrace(std::istream &in, std::ostream &out)
+  {
+    TraceFileHeader header;
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || memcmp(header.magic, trace_magic, sizeof(trace_magic)) || header.version != trace_version
+        || header.record_bytes != sizeof(TraceRecord)) {
+      warningQuda("Not a supported trace file");
+      return false;
+    }
+
+    std::vector<TuneKey> keys(header.n_keys);
+    for (auto &key : keys) {
+      std::string v, n, a;
+      std::getline(in, v, '\0');
+      std::getline(in, n, '\0');
+      std::getline(in, a, '\0');
+      key = TuneKey(v.substr(0, TuneKey::volume_n - 1).c_str(), n.substr(0, TuneKey::name_n - 1).c_str(),
+                    a.substr(0, TuneKey::aux_n - 1).c_str());
+    }
+
+    std::vector<TraceRecord> records(header.n_records);
+    in.read(reinterpret_cast<char *>(records.data()), records.size() * sizeof(TraceRecord));
+    if (!in) {
+      warningQuda("Truncated trace file");
+      return false;
+    }
+
+    const int pid = header.rank;
+    const int host_tid = 0;
+    const double us = 1e-3; // timestamps are in nanoseconds, while JSON uses microseconds
+    bool first = true;
+    auto sep = [&]() -> std::ostream & {
+      out << (first ? "\n" : ",\n");
+      first = false;
+      return out;
+    };
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_records\": " << header.n_dropped << "},";
+    out << "\n\"traceEvents\": [";
+    sep() << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"args\": {\"name\": \"QUDA rank "
+          << pid << "\"}}";
+    sep() << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << host_tid
+          << ", \"args\": {\"name\": \"host\"}}";
+
+    std::map<int, double> stream_end; // end time of the last kernel on each stream
+    std::map<std::uint32_t, std::vector<std::uint64_t>> open_regions;
+    const TraceRecord *last_memory = nullptr;
+    std::uint64_t last_time = 0;
+
+    for (auto &r : records) {
+      if (r.id >= keys.size()) continue;
+      const TuneKey &key = keys[r.id];
+      last_time = r.time;
+
+      switch (r.type) {
+      case QUDA_TRACE_KERNEL: {
+        int tid = 1 + r.stream;
+        if (!stream_end.count(r.stream))
+          sep() << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid
+                << ", \"args\": {\"name\": \"device stream " << r.stream << " (estimated)\"}}";
+        // assume in-order execution on the stream, starting no earlier than the launch
+        double start = std::max(r.time * us, stream_end[r.stream]);
+        double dur = r.duration * 1e6;
+        stream_end[r.stream] = start + dur;
+        sep() << "{\"name\": ";
+        writeJSONString(out, key.name);
+        out << ", \"cat\": \"kernel\", \"ph\": \"X\", \"ts\": " << start << ", \"dur\": " << dur << ", \"pid\": " << pid
+            << ", \"tid\": " << tid << ", \"args\": {\"volume\": ";
+        writeJSONString(out, key.volume);
+        out << ", \"aux\": ";
+        writeJSONString(out, key.aux);
+        out << ", \"launch\": " << r.time * us << "}}";
+        break;
+      }
+      case QUDA_TRACE_POST:
+        sep() << "{\"name\": ";
+        writeJSONString(out, key.name);
+        out << ", \"cat\": \"post\", \"ph\": \"i\", \"s\": \"t\", \"ts\": " << r.time * us << ", \"pid\": " << pid
+            << ", \"tid\": " << host_tid << ", \"args\": {\"location\": ";
+        writeJSONString(out, key.aux);
+        out << "}}";
+        break;
+      case QUDA_TRACE_REGION_BEGIN: open_regions[r.id].push_back(r.time); break;
+      case QUDA_TRACE_REGION_END: {
+        // the begin record may have been overwritten in the ring buffer
+        auto &open = open_regions[r.id];
+        if (open.empty()) break;
+        std::uint64_t begin = open.back();
+        open.pop_back();
+        // regions are emitted as complete events, so they nest correctly even if not strictly stack ordered
+        sep() << "{\"name\": ";
+        writeJSONString(out, (std::string(key.name) + "::" + key.aux).c_str());
+        out << ", \"cat\": \"region\", \"ph\": \"X\", \"ts\": " << begin * us << ", \"dur\": " << (r.time - begin) * us
+            << ", \"pid\": " << pid << ", \"tid\": " << host_tid << "}";
+        break;
+      }
+      default: break;
+      }
+
+      if (!last_memory || r.device_bytes != last_memory->device_bytes || r.pinned_bytes != last_memory->pinned_bytes
+          || r.mapped_bytes != last_memory->mapped_bytes || r.host_bytes != last_memory->host_bytes) {
+        sep() << "{\"name\": \"memory\", \"ph\": \"C\", \"ts\": " << r.time * us << ", \"pid\": " << pid
+              << ", \"args\": {\"device\": " << r.device_bytes << ", \"pinned\": " << r.pinned_bytes
+              << ", \"mapped\": " << r.mapped_bytes << ", \"host\": " << r.host_bytes << "}}";
+        last_memory = &r;
+      }
+    }
+
+    // close any regions still open when the trace was saved
+    for (auto &region : open_regions) {
+      const TuneKey &key = keys[region.first];
+      for (auto begin : region.second) {
+        sep() << "{\"name\": ";
+        writeJSONString(out, (std::string(key.name) + "::" + key.aux).c_str());
+        out << ", \"cat\": \"region\", \"ph\": \"X\", \"ts\": " << begin * us << ", \"dur\": " << (last_time - begin) * us
+            << ", \"pid\": " << pid << ", \"tid\": " << host_tid << "}";
+      }
+    }
+
+    out << "\n]}\n";
+    return out.good();
+  }
+
+} // namespace quda
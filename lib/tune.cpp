@@ -8,13 +8,22 @@
 #include <fstream>
 #include <typeinfo>
 #include <map>
-#include <list>
 #include <unistd.h>
-#include <uint_to_char.h>
+#include <dirent.h>
+#include <signal.h> // for kill()
+#include <cerrno>
 
 #include <deque>
 #include <queue>
 #include <functional>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <async_writer.h>
 
 //#define LAUNCH_TIMER
 extern char* gitversion;
@@ -25,89 +34,22 @@ namespace quda { static TuneKey last_key; }
 quda::TuneKey getLastTuneKey() { return quda::last_key; }
 
 namespace quda {
-  typedef std::map<TuneKey, TuneParam> map;
-
-  struct TraceKey {
-
-    TuneKey key;
-    float time;
-
-    long device_bytes;
-    long pinned_bytes;
-    long mapped_bytes;
-    long host_bytes;
-
-    TraceKey() { }
-
-    TraceKey(const TuneKey &key, float time)
-      : key(key), time(time),
-        device_bytes(device_allocated_peak()),
-        pinned_bytes(pinned_allocated_peak()),
-        mapped_bytes(mapped_allocated_peak()),
-        host_bytes(host_allocated_peak()) { }
-
-    TraceKey(const TraceKey &trace)
-      : key(trace.key), time(trace.time),
-        device_bytes(trace.device_bytes),
-        pinned_bytes(trace.pinned_bytes),
-        mapped_bytes(trace.mapped_bytes),
-        host_bytes(trace.host_bytes) { }
-
-    TraceKey& operator=(const TraceKey &trace) {
-      if (&trace != this) {
-        key = trace.key;
-        time = trace.time;
-        device_bytes = trace.device_bytes;
-        pinned_bytes = trace.pinned_bytes;
-        mapped_bytes = trace.mapped_bytes;
-        host_bytes = trace.host_bytes;
-      }
-      return *this;
-    }
-  };
-
-  // linked list that is augmented each time we call a kernel
-  static std::list<TraceKey> trace_list;
-  static int enable_trace = 0;
-
-  int traceEnabled() {
-    static bool init = false;
-
-    if (!init) {
-      char *enable_trace_env = getenv("QUDA_ENABLE_TRACE");
-      if (enable_trace_env) {
-        if (strcmp(enable_trace_env, "1") == 0) {
-          // only explicitly posted trace events are included
-          enable_trace = 1;
-        } else if (strcmp(enable_trace_env, "2") == 0) {
-          // enable full kernel trace and posted trace events
-          enable_trace = 2;
-        }
-      }
-      init = true;
-    }
-    return enable_trace;
-  }
-
-  void postTrace_(const char *func, const char *file, int line) {
-    if (traceEnabled() >= 1) {
-      char aux[TuneKey::aux_n];
-      strcpy(aux,file);
-      strcat(aux,":");
-      char tmp[TuneKey::aux_n];
-      i32toa(tmp,line);
-      strcat(aux,tmp);
-      TuneKey key("", func, aux);
-      TraceKey trace_entry(key, 0.0);
-      trace_list.push_back(trace_entry);
-    }
-  }
+  typedef TuneCache map;
 
   static const std::string quda_hash = QUDA_HASH; // defined in lib/Makefile
   static std::string resource_path;
   static map tunecache;
-  static map::iterator it;
-  static size_t initial_cache_size = 0;
+  static bool version_check = true;
+
+  /** entries tuned (or recovered from a journal) by this process since the tunecache was last saved */
+  static std::vector<const map::value_type *> pending_entries;
+
+  /** whether to journal newly tuned entries to disk as they are tuned, see journalTuneEntry() */
+  static bool journal_enabled = false;
+  static std::string journal_path;
+  static std::ofstream journal_file;
+  /** journals left behind by jobs that have since exited, which were merged in by loadTuneCache() */
+  static std::vector<std::string> stale_journals;
 
 #define STR_(x) #x
 #define STR(x) STR_(x)
@@ -130,8 +72,14 @@ namespace quda {
 
   /**
    * Deserialize tunecache from an istream, useful for reading a file or receiving from other nodes.
+   * @param[in] in The stream to read from
+   * @param[in,out] cache The cache to deserialize into
+   * @param[in] merge Whether to merge with existing entries, keeping the faster of the two on conflict, rather than
+   * overwriting them
+   * @param[out] updated If non-null, the entries that were inserted or updated are appended here
    */
-  static void deserializeTuneCache(std::istream &in)
+  static void deserializeTuneCache(std::istream &in, map &cache, bool merge = false,
+                                   std::vector<const map::value_type *> *updated = nullptr)
   {
     std::string line;
     std::stringstream ls;
@@ -157,32 +105,57 @@ namespace quda {
       if (check < 0 || check >= key.name_n) errorQuda("Error writing name string (check=%d)", check);
       check = snprintf(key.aux, key.aux_n, "%s", a.c_str());
       if (check < 0 || check >= key.aux_n) errorQuda("Error writing aux string (check=%d)", check);
+      key.rehash();
       ls >> param.grid.x >> param.grid.y >> param.grid.z >> param.shared_bytes >> param.aux.x >> param.aux.y >> param.aux.z >> param.aux.w >> param.time;
+      if (ls.fail()) { // e.g., a journal entry truncated by a crash mid-write
+        warningQuda("Skipping malformed tunecache entry \"%s\"", line.c_str());
+        continue;
+      }
       ls.ignore(1); // throw away tab before comment
       getline(ls, param.comment); // assume anything remaining on the line is a comment
       param.comment += "\n"; // our convention is to include the newline, since ctime() likes to do this
-      tunecache[key] = param;
+
+      if (merge) {
+        auto it = cache.find(key);
+        if (it != cache.end() && it->second.time <= param.time) continue;
+      }
+      TuneParam &entry = cache[key];
+      param.n_calls = entry.n_calls; // retain the profile count
+      entry = param;
+      if (updated) updated->push_back(&*cache.find(key));
     }
   }
 
 
   /**
-   * Serialize tunecache to an ostream, useful for writing to a file or sending to other nodes.
+   * Serialize a single tunecache entry to an ostream.
    */
-  static void serializeTuneCache(std::ostream &out)
+  static void serializeTuneEntry(std::ostream &out, const map::value_type &entry)
   {
-    map::iterator entry;
+    const TuneKey &key = entry.first;
+    const TuneParam &param = entry.second;
+
+    out << std::setw(16) << key.volume << "\t" << key.name << "\t" << key.aux << "\t";
+    out << param.block.x << "\t" << param.block.y << "\t" << param.block.z << "\t";
+    out << param.grid.x << "\t" << param.grid.y << "\t" << param.grid.z << "\t";
+    out << param.shared_bytes << "\t" << param.aux.x << "\t" << param.aux.y << "\t" << param.aux.z << "\t" << param.aux.w << "\t";
+    out << param.time << "\t" << param.comment; // param.comment ends with a newline
+  }
 
-    for (entry = tunecache.begin(); entry != tunecache.end(); entry++) {
-      TuneKey key = entry->first;
-      TuneParam param = entry->second;
 
-      out << std::setw(16) << key.volume << "\t" << key.name << "\t" << key.aux << "\t";
-      out << param.block.x << "\t" << param.block.y << "\t" << param.block.z << "\t";
-      out << param.grid.x << "\t" << param.grid.y << "\t" << param.grid.z << "\t";
-      out << param.shared_bytes << "\t" << param.aux.x << "\t" << param.aux.y << "\t" << param.aux.z << "\t" << param.aux.w << "\t";
-      out << param.time << "\t" << param.comment; // param.comment ends with a newline
-    }
+  /**
+   * Serialize tunecache to an ostream, useful for writing to a file or sending to other nodes.
+   */
+  static void serializeTuneCache(std::ostream &out, const map &cache)
+  {
+    // the cache is unordered, so sort the entries to keep the output deterministic
+    std::vector<const map::value_type *> sorted;
+    sorted.reserve(cache.size());
+    for (auto &entry : cache) sorted.push_back(&entry);
+    std::sort(sorted.begin(), sorted.end(),
+              [](const map::value_type *a, const map::value_type *b) { return a->first < b->first; });
+
+    for (auto entry : sorted) serializeTuneEntry(out, *entry);
   }
 
 
@@ -196,19 +169,19 @@ namespace quda {
   /**
    * Serialize tunecache to an ostream, useful for writing to a file or sending to other nodes.
    */
-  static void serializeProfile(std::ostream &out, std::ostream &async_out)
+  static void serializeProfile(std::ostream &out, std::ostream &async_out, const map &cache)
   {
-    map::iterator entry;
+    map::const_iterator entry;
     double total_time = 0.0;
     double async_total_time = 0.0;
 
     // first let's sort the entries in decreasing order of significance
     typedef std::pair<TuneKey, TuneParam> profile_t;
     typedef std::priority_queue<profile_t, std::deque<profile_t>, less_significant<profile_t> > queue_t;
-    queue_t q(tunecache.begin(), tunecache.end());
+    queue_t q(cache.begin(), cache.end());
 
     // now compute total time spent in kernels so we can give each kernel a significance
-    for (entry = tunecache.begin(); entry != tunecache.end(); entry++) {
+    for (entry = cache.begin(); entry != cache.end(); entry++) {
       TuneKey key = entry->first;
       TuneParam param = entry->second;
 
@@ -256,35 +229,6 @@ namespace quda {
     async_out << std::endl << "# Total time spent in asynchronous execution = " << async_total_time << " seconds" << std::endl;
   }
 
-  /**
-   * Serialize trace to an ostream, useful for writing to a file or sending to other nodes.
-   */
-  static void serializeTrace(std::ostream &out)
-  {
-    for (auto it = trace_list.begin(); it != trace_list.end(); it++) {
-
-      TuneKey &key = it->key;
-
-      // special case kernel members of a policy
-      char tmp[14] = { };
-      strncpy(tmp, key.aux, 13);
-      bool is_policy_kernel = strcmp(tmp, "policy_kernel") == 0 ? true : false;
-
-      out << std::setw(12) << it->time << "\t";
-      out << std::setw(12) << it->device_bytes << "\t";
-      out << std::setw(12) << it->pinned_bytes << "\t";
-      out << std::setw(12) << it->mapped_bytes << "\t";
-      out << std::setw(12) << it->host_bytes << "\t";
-      out << std::setw(16) << key.volume << "\t";
-      if (is_policy_kernel) out << "\t";
-      out << key.name << "\t";
-      if (!is_policy_kernel) out << "\t";
-      out << key.aux << std::endl;
-
-    }
-  }
-
-
   /**
    * Distribute the tunecache from node 0 to all other nodes.
    */
@@ -296,7 +240,7 @@ namespace quda {
     size_t size;
 
     if (comm_rank() == 0) {
-      serializeTuneCache(serialized);
+      serializeTuneCache(serialized, tunecache);
       size = serialized.str().length();
     }
     comm_broadcast(&size, sizeof(size_t));
@@ -309,7 +253,7 @@ namespace quda {
 	comm_broadcast(serstr, size);
 	serstr[size] ='\0'; // null-terminate
 	serialized.str(serstr);
-	deserializeTuneCache(serialized);
+	deserializeTuneCache(serialized, tunecache);
 	delete[] serstr;
       }
     }
@@ -317,6 +261,200 @@ namespace quda {
   }
 
 
+  /**
+   * Gather the entries tuned on all nodes since the last save onto node 0.  Kernels may have been tuned on nodes other
+   * than node 0 only, e.g., with policy tuning, when global reductions are disabled, or when the sub-volumes differ
+   * between nodes.  The gathered entries are only merged into what is written to disk, never into the live tunecache
+   * on node 0, since the nodes must keep launching with identical parameters (e.g., so that they agree on policies).
+   * @return The serialized entries from all nodes on node 0, an empty string elsewhere
+   */
+  static std::string gatherTuneCache()
+  {
+    std::string gathered;
+#ifdef MULTI_GPU
+    std::stringstream serialized;
+    for (auto entry : pending_entries) serializeTuneEntry(serialized, *entry);
+    const std::string send = serialized.str();
+
+    std::vector<size_t> recv_bytes(comm_rank() == 0 ? comm_size() : 0);
+    comm_gatherv(send.c_str(), send.length(), nullptr, recv_bytes.data(), true);
+
+    size_t total = 0;
+    for (auto bytes : recv_bytes) total += bytes;
+    std::vector<char> recv(total + 1);
+    comm_gatherv(send.c_str(), send.length(), recv.data(), recv_bytes.data(), false);
+
+    if (comm_rank() == 0) {
+      recv[total] = '\0';
+      gathered = recv.data();
+    }
+#endif
+    return gathered;
+  }
+
+
+  /**
+   * Write the tunecache header, shared by the tunecache and the journal files.
+   */
+  static void writeTuneCacheHeader(std::ostream &out, const char *comment)
+  {
+    time_t now;
+    time(&now);
+    out << "tunecache\t" << quda_version;
+#ifdef GITVERSION
+    out << "\t" << gitversion;
+#else
+    out << "\t" << quda_version;
+#endif
+    out << "\t" << quda_hash << "\t# " << comment << " " << ctime(&now) << std::endl;
+    out << std::setw(16) << "volume" << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux.z\taux.w\ttime\tcomment" << std::endl;
+  }
+
+
+  /**
+   * Read and check the header of a tunecache (or journal) file.
+   * @param[in] in The stream to read from
+   * @param[in] path The file name, for error reporting
+   * @param[in] strict Whether a version mismatch is an error; else we warn and return false
+   * @return Whether the remainder of the stream can be deserialized
+   */
+  static bool readTuneCacheHeader(std::istream &in, const std::string &path, bool strict)
+  {
+    std::string line, token;
+    std::stringstream ls;
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line);
+    ls.str(line);
+    ls >> token;
+    if (token.compare("tunecache")) errorQuda("Bad format in %s", path.c_str());
+
+    bool match = true;
+    ls >> token;
+    if (version_check && token.compare(quda_version)) match = false;
+    ls >> token;
+#ifdef GITVERSION
+    if (version_check && token.compare(gitversion)) match = false;
+#else
+    if (version_check && token.compare(quda_version)) match = false;
+#endif
+    ls >> token;
+    if (version_check && token.compare(quda_hash)) match = false;
+
+    if (!match) {
+      if (strict)
+        errorQuda("Cache file %s does not match current QUDA version or build. \nPlease delete this file or set the "
+                  "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                  path.c_str());
+      warningQuda("Ignoring %s since it does not match current QUDA version or build", path.c_str());
+      return false;
+    }
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line); // eat the blank line
+
+    if (!in.good()) errorQuda("Bad format in %s", path.c_str());
+    getline(in, line); // eat the description line
+
+    return true;
+  }
+
+
+  /**
+   * Record a newly tuned entry so that it is included in the next save, and append it to this process's journal if
+   * journaling is enabled.  The journal is flushed after each entry, so tuned parameters are not lost if the job
+   * crashes before saveTuneCache() is next called; journals are merged back in by loadTuneCache().
+   */
+  static void newTuneEntry(const map::value_type &entry)
+  {
+    pending_entries.push_back(&entry);
+    if (!journal_enabled || resource_path.empty()) return;
+
+    if (!journal_file.is_open()) {
+      journal_file.open(journal_path.c_str(), std::ios::out | std::ios::trunc);
+      if (!journal_file) {
+        warningQuda("Unable to open tunecache journal %s; journaling will be disabled", journal_path.c_str());
+        journal_enabled = false;
+        return;
+      }
+      writeTuneCacheHeader(journal_file, "Journal started");
+    }
+    serializeTuneEntry(journal_file, entry);
+    journal_file.flush();
+  }
+
+
+  /**
+   * Remove this process's journal, once its contents are safely in the tunecache.
+   */
+  static void clearJournal()
+  {
+    if (!journal_file.is_open()) return;
+    journal_file.close();
+    remove(journal_path.c_str());
+  }
+
+
+  /**
+   * Whether the process that owns a journal has provably exited.  Journals are named by the host and pid of their
+   * owner, and we can only check processes on this host, so a journal from another host is assumed to be live.
+   * @param[in] owner The owner of the journal, "<host>_<pid>"
+   */
+  static bool journalOwnerExited(const std::string &owner)
+  {
+    size_t sep = owner.rfind('_');
+    if (sep == std::string::npos || owner.compare(0, sep, comm_hostname())) return false;
+
+    char *end;
+    long pid = strtol(owner.c_str() + sep + 1, &end, 10);
+    if (*end || pid <= 0 || pid == getpid()) return false;
+    return kill(pid, 0) == -1 && errno == ESRCH;
+  }
+
+
+  /**
+   * Merge any journals found in the resource path into the tunecache.  These are left behind by jobs that did not
+   * reach saveTuneCache() after tuning, e.g., because they crashed or ran out of wall-clock time, or are being
+   * written by jobs that are still running.  Only the journals of jobs that have exited are removed once their
+   * entries are saved; the journals of running jobs are merged read-only, since they are their owner's only record
+   * of its tuning should it crash.
+   */
+  static void loadJournals()
+  {
+    const std::string prefix = "tunecache_journal_";
+    const std::string suffix = ".tsv";
+
+    DIR *dir = opendir(resource_path.c_str());
+    if (!dir) return;
+
+    while (struct dirent *ent = readdir(dir)) {
+      std::string name = ent->d_name;
+      if (name.length() <= prefix.length() + suffix.length() || name.compare(0, prefix.length(), prefix)
+          || name.compare(name.length() - suffix.length(), suffix.length(), suffix))
+        continue;
+
+      std::string path = resource_path + "/" + name;
+      if (path == journal_path) continue;
+      std::ifstream journal(path.c_str());
+      if (!journal || !readTuneCacheHeader(journal, path, false)) continue;
+
+      size_t n = pending_entries.size();
+      deserializeTuneCache(journal, tunecache, true, &pending_entries);
+      journal.close();
+
+      const std::string owner = name.substr(prefix.length(), name.length() - prefix.length() - suffix.length());
+      bool exited = journalOwnerExited(owner);
+      if (exited) stale_journals.push_back(path);
+
+      if (getVerbosity() >= QUDA_SUMMARIZE) {
+        printfQuda("Recovered %d sets of tuned parameters from %s journal %s\n",
+                   static_cast<int>(pending_entries.size() - n), exited ? "stale" : "live", path.c_str());
+      }
+    }
+    closedir(dir);
+  }
+
+
   /*
    * Read tunecache from disk.
    */
@@ -329,9 +467,8 @@ namespace quda {
 
     char *path;
     struct stat pstat;
-    std::string cache_path, line, token;
+    std::string cache_path;
     std::ifstream cache_file;
-    std::stringstream ls;
 
     path = getenv("QUDA_RESOURCE_PATH");
 
@@ -347,13 +484,20 @@ namespace quda {
       resource_path = path;
     }
 
-    bool version_check = true;
     char *override_version_env = getenv("QUDA_TUNE_VERSION_CHECK");
     if (override_version_env && strcmp(override_version_env, "0") == 0) {
       version_check = false;
       warningQuda("Disabling QUDA tunecache version check");
     }
 
+    char *journal_env = getenv("QUDA_TUNECACHE_JOURNAL");
+    if (journal_env && strcmp(journal_env, "1") == 0) {
+      journal_enabled = true;
+      // unique per process, so no locking is required and concurrent jobs do not collide
+      journal_path = resource_path + "/tunecache_journal_" + comm_hostname() + "_" + std::to_string(getpid()) + ".tsv";
+      if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Journaling newly tuned parameters\n");
+    }
+
 #ifdef MULTI_GPU
     if (comm_rank() == 0) {
 #endif
@@ -364,54 +508,21 @@ namespace quda {
 
       if (cache_file) {
 
-	if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-	getline(cache_file, line);
-	ls.str(line);
-	ls >> token;
-	if (token.compare("tunecache")) errorQuda("Bad format in %s", cache_path.c_str());
-	ls >> token;
-        if (version_check && token.compare(quda_version))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-        ls >> token;
-#ifdef GITVERSION
-        if (version_check && token.compare(gitversion))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-#else
-        if (version_check && token.compare(quda_version))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-#endif
-	ls >> token;
-        if (version_check && token.compare(quda_hash))
-          errorQuda("Cache file %s does not match current QUDA build. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the blank line
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-	getline(cache_file, line); // eat the description line
-
-	deserializeTuneCache(cache_file);
+        readTuneCacheHeader(cache_file, cache_path, true);
+        deserializeTuneCache(cache_file, tunecache);
 
 	cache_file.close();
-	initial_cache_size = tunecache.size();
 
 	if (getVerbosity() >= QUDA_SUMMARIZE) {
-	  printfQuda("Loaded %d sets of cached parameters from %s\n", static_cast<int>(initial_cache_size), cache_path.c_str());
+	  printfQuda("Loaded %d sets of cached parameters from %s\n", static_cast<int>(tunecache.size()), cache_path.c_str());
 	}
 
-
       } else {
 	warningQuda("Cache file not found.  All kernels will be re-tuned (if tuning is enabled).");
       }
 
+      loadJournals();
+
 #ifdef MULTI_GPU
     }
 #endif
@@ -422,66 +533,74 @@ namespace quda {
 
 
   /**
-   * Write tunecache to disk.
+   * Write the tunecache on this node to disk.  Rather than relying on a lock file, which requires flock() semantics
+   * that Lustre does not provide by default, we first merge in the present contents of the file (in case a concurrent
+   * job has updated it since we loaded it), write to a temporary file unique to this process, and then atomically
+   * rename() it into place, so readers always see a complete file.  The merging is done on a copy, so the live
+   * tunecache is left unchanged.
+   * @param[in] error Whether we are saving on error
+   * @param[in] gathered Serialized entries gathered from all nodes, to be merged in
+   * @return Whether the write succeeded
    */
-  void saveTuneCache(bool error)
+  static bool writeTuneCache(bool error, const std::string &gathered)
   {
-    time_t now;
-    int lock_handle;
-    std::string lock_path, cache_path;
-    std::ofstream cache_file;
+    std::string cache_path = resource_path + (error ? "/tunecache_error.tsv" : "/tunecache.tsv");
+    std::string tmp_path = cache_path + "." + comm_hostname() + "_" + std::to_string(getpid()) + ".tmp";
 
-    if (resource_path.empty()) return;
+    map merged(tunecache);
+    if (!error) {
+      std::stringstream gathered_entries(gathered);
+      deserializeTuneCache(gathered_entries, merged, true);
 
-    //FIXME: We should really check to see if any nodes have tuned a kernel that was not also tuned on node 0, since as things
-    //       stand, the corresponding launch parameters would never get cached to disk in this situation.  This will come up if we
-    //       ever support different subvolumes per GPU (as might be convenient for lattice volumes that don't divide evenly).
+      std::ifstream cache_file(cache_path.c_str());
+      if (cache_file && readTuneCacheHeader(cache_file, cache_path, false))
+        deserializeTuneCache(cache_file, merged, true);
+    }
 
-#ifdef MULTI_GPU
-    if (comm_rank() == 0) {
-#endif
+    if (getVerbosity() >= QUDA_SUMMARIZE) {
+      printfQuda("Saving %d sets of cached parameters to %s\n", static_cast<int>(merged.size()), cache_path.c_str());
+    }
 
-      if (tunecache.size() == initial_cache_size && !error) return;
-
-      // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
-      // NFS on recent versions of linux but not Lustre by default (unless the filesystem was mounted with "-o flock").
-      lock_path = resource_path + "/tunecache.lock";
-      lock_handle = open(lock_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
-      if (lock_handle == -1) {
-	warningQuda("Unable to lock cache file.  Tuned launch parameters will not be cached to disk.  "
-		    "If you are certain that no other instances of QUDA are accessing this filesystem, "
-		    "please manually remove %s", lock_path.c_str());
-	return;
-      }
-      char msg[] = "If no instances of applications using QUDA are running,\n"
-	"this lock file shouldn't be here and is safe to delete.";
-      int stat = write(lock_handle, msg, sizeof(msg)); // check status to avoid compiler warning
-      if (stat == -1) warningQuda("Unable to write to lock file for some bizarre reason");
+    std::ofstream tmp_file(tmp_path.c_str());
+    writeTuneCacheHeader(tmp_file, "Last updated");
+    serializeTuneCache(tmp_file, merged);
+    tmp_file.close();
 
-      cache_path = resource_path + (error ? "/tunecache_error.tsv" : "/tunecache.tsv");
-      cache_file.open(cache_path.c_str());
+    if (tmp_file.fail() || rename(tmp_path.c_str(), cache_path.c_str())) {
+      warningQuda("Unable to write %s.  Tuned launch parameters will not be cached to disk.", cache_path.c_str());
+      remove(tmp_path.c_str());
+      return false;
+    }
+    return true;
+  }
 
-      if (getVerbosity() >= QUDA_SUMMARIZE) {
-	printfQuda("Saving %d sets of cached parameters to %s\n", static_cast<int>(tunecache.size()), cache_path.c_str());
-      }
 
-      time(&now);
-      cache_file << "tunecache\t" << quda_version;
-#ifdef GITVERSION
-       cache_file << "\t" << gitversion;
+  /**
+   * Write tunecache to disk.
+   */
+  void saveTuneCache(bool error)
+  {
+    if (resource_path.empty()) return;
+
+    bool saved = false;
+    std::string gathered;
+
+#ifdef MULTI_GPU
+    // On error this may not have been called by all nodes, so we cannot communicate and only node 0 writes what it
+    // has (any journals are left in place to be recovered on the next load).
+    if (!error) {
+      int n_pending = pending_entries.size();
+      comm_allreduce_int(&n_pending);
+      if (n_pending == 0) return;
+      gathered = gatherTuneCache();
+    }
+
+    if (comm_rank() == 0) {
 #else
-       cache_file << "\t" << quda_version;
+      if (pending_entries.empty() && !error) return;
 #endif
-      cache_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      cache_file << std::setw(16) << "volume" << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux.z\taux.w\ttime\tcomment" << std::endl;
-      serializeTuneCache(cache_file);
-      cache_file.close();
 
-      // Release lock.
-      close(lock_handle);
-      remove(lock_path.c_str());
-
-      initial_cache_size = tunecache.size();
+      saved = writeTuneCache(error, gathered);
 
 #ifdef MULTI_GPU
     } else {
@@ -489,7 +608,21 @@ namespace quda {
       // doesn't cause a hang if error is not triggered on process 0
       if (error) sleep(10);
     }
+
+    if (!error) {
+      int flag = saved;
+      comm_broadcast(&flag, sizeof(int));
+      saved = flag;
+    }
 #endif
+
+    if (saved && !error) {
+      // the pending entries from every node are now on disk
+      pending_entries.clear();
+      clearJournal();
+      for (auto &path : stale_journals) remove(path.c_str());
+      stale_journals.clear();
+    }
   }
 
   static bool policy_tuning = false;
@@ -511,13 +644,92 @@ namespace quda {
     }
   }
 
+  // errors from the background profile writes, reported by the host thread in reportProfileErrors
+  static std::mutex profile_error_mutex;
+  static std::vector<std::string> profile_errors;
+
+  static void profileError(const std::string &error)
+  {
+    std::lock_guard<std::mutex> lock(profile_error_mutex);
+    profile_errors.push_back(error);
+  }
+
+  void reportProfileErrors()
+  {
+    std::vector<std::string> errors;
+    {
+      std::lock_guard<std::mutex> lock(profile_error_mutex);
+      errors.swap(profile_errors);
+    }
+    for (auto &error : errors) warningQuda("%s", error.c_str());
+  }
+
+  /**
+   * Write a snapshot of the profile to disk, run by the background I/O thread.  The timestamp is formatted by the
+   * caller, and errors are queued for the host thread rather than logged from here.
+   */
+  static void writeProfile(const map &cache, const std::string &label, const std::string &stamp,
+                           const std::string &profile_path, const std::string &async_profile_path,
+                           const std::string &trace_path)
+  {
+    // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
+    // NFS on recent versions of linux but not Lustre by default (unless the filesystem was mounted with "-o flock").
+    std::string lock_path = resource_path + "/profile.lock";
+    int lock_handle = open(lock_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+    if (lock_handle == -1) {
+      profileError("Unable to lock profile file.  Profile will not be saved to disk.  "
+                   "If you are certain that no other instances of QUDA are accessing this filesystem, "
+                   "please manually remove " + lock_path);
+      return;
+    }
+    char msg[] = "If no instances of applications using QUDA are running,\n"
+      "this lock file shouldn't be here and is safe to delete.";
+    int stat = write(lock_handle, msg, sizeof(msg)); // check status to avoid compiler warning
+    if (stat == -1) profileError("Unable to write to lock file for some bizarre reason");
+
+    std::ofstream profile_file(profile_path.c_str());
+    std::ofstream async_profile_file(async_profile_path.c_str());
+
+    profile_file << label << "\t" << quda_version;
+#ifdef GITVERSION
+    profile_file << "\t" << gitversion;
+#else
+    profile_file << "\t" << quda_version;
+#endif
+    profile_file << "\t" << quda_hash << "\t# Last updated " << stamp << std::endl;
+    profile_file << std::setw(12) << "total time" << "\t" << std::setw(12) << "percentage" << "\t" << std::setw(12) << "calls" << "\t" << std::setw(12) << "time / call" << "\t" << std::setw(16) << "volume" << "\tname\taux\tcomment" << std::endl;
+
+    async_profile_file << label << "\t" << quda_version;
+#ifdef GITVERSION
+    async_profile_file << "\t" << gitversion;
+#else
+    async_profile_file << "\t" << quda_version;
+#endif
+    async_profile_file << "\t" << quda_hash << "\t# Last updated " << stamp << std::endl;
+    async_profile_file << std::setw(12) << "total time" << "\t" << std::setw(12) << "percentage" << "\t" << std::setw(12) << "calls" << "\t" << std::setw(12) << "time / call" << "\t" << std::setw(16) << "volume" << "\tname\taux\tcomment" << std::endl;
+
+    serializeProfile(profile_file, async_profile_file, cache);
+
+    profile_file.close();
+    async_profile_file.close();
+
+    if (!trace_path.empty()) {
+      // conversion of the binary trace dump to Chrome trace-event JSON
+      std::ifstream trace_bin((trace_path + ".bin").c_str(), std::ios::binary);
+      std::ofstream trace_json((trace_path + ".json").c_str());
+      if (!convertTrace(trace_bin, trace_json)) profileError("Unable to convert trace " + trace_path + ".bin");
+    }
+
+    // Release lock.
+    close(lock_handle);
+    remove(lock_path.c_str());
+  }
+
   // save profile
   void saveProfile(const std::string label)
   {
     time_t now;
-    int lock_handle;
-    std::string lock_path, profile_path, async_profile_path, trace_path;
-    std::ofstream profile_file, async_profile_file, trace_file;
+    std::string profile_path, async_profile_path, trace_path;
 
     if (resource_path.empty()) return;
 
@@ -525,20 +737,8 @@ namespace quda {
     if (comm_rank() == 0) {
 #endif
 
-      // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
-      // NFS on recent versions of linux but not Lustre by default (unless the filesystem was mounted with "-o flock").
-      lock_path = resource_path + "/profile.lock";
-      lock_handle = open(lock_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
-      if (lock_handle == -1) {
-	warningQuda("Unable to lock profile file.  Profile will not be saved to disk.  "
-		    "If you are certain that no other instances of QUDA are accessing this filesystem, "
-		    "please manually remove %s", lock_path.c_str());
-	return;
-      }
-      char msg[] = "If no instances of applications using QUDA are running,\n"
-	"this lock file shouldn't be here and is safe to delete.";
-      int stat = write(lock_handle, msg, sizeof(msg)); // check status to avoid compiler warning
-      if (stat == -1) warningQuda("Unable to write to lock file for some bizarre reason");
+      // report any failures of the previous background writes
+      reportProfileErrors();
 
       // profile counter for writing out unique profiles
       static int count = 0;
@@ -549,19 +749,15 @@ namespace quda {
         warningQuda("Environment variable QUDA_PROFILE_OUTPUT_BASE not set; writing to profile.tsv and profile_async.tsv");
 	profile_path = resource_path + "/profile_" + std::to_string(count) + ".tsv";
 	async_profile_path = resource_path + "/profile_async_" + std::to_string(count) + ".tsv";
-        if (traceEnabled()) trace_path = resource_path + "/trace_" + std::to_string(count) + ".tsv";
+        if (traceEnabled()) trace_path = resource_path + "/trace_" + std::to_string(count);
       } else {
 	profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + ".tsv";
 	async_profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_async.tsv";
-	if (traceEnabled()) trace_path = resource_path + "/" + profile_fname + "_trace_" + std::to_string(count) + ".tsv";
+	if (traceEnabled()) trace_path = resource_path + "/" + profile_fname + "_trace_" + std::to_string(count);
       }
 
       count++;
 
-      profile_file.open(profile_path.c_str());
-      async_profile_file.open(async_profile_path.c_str());
-      if (traceEnabled()) trace_file.open(trace_path.c_str());
-
       if (getVerbosity() >= QUDA_SUMMARIZE) {
 	// compute number of non-zero entries that will be output in the profile
 	int n_entry = 0;
@@ -578,61 +774,149 @@ namespace quda {
 
 	printfQuda("Saving %d sets of cached parameters to %s\n", n_entry, profile_path.c_str());
 	printfQuda("Saving %d sets of cached profiles to %s\n", n_policy, async_profile_path.c_str());
-	if (traceEnabled()) printfQuda("Saving trace list with %lu entries to %s\n", trace_list.size(), trace_path.c_str());
       }
 
       time(&now);
+      char stamp[32]; // formatted here, since ctime's static buffer is shared with the host thread
+      ctime_r(&now, stamp);
 
       std::string Label = label.empty() ? "profile" : label;
 
-      profile_file << Label << "\t" << quda_version;
-#ifdef GITVERSION
-      profile_file << "\t" << gitversion;
-#else
-      profile_file << "\t" << quda_version;
+      if (traceEnabled()) {
+        // the ring buffer is live, so it is dumped here and only converted in the background
+        size_t n_records = saveTrace(trace_path + ".bin");
+        if (getVerbosity() >= QUDA_SUMMARIZE)
+          printfQuda("Saving trace with %lu records to %s.bin and %s.json\n", n_records, trace_path.c_str(),
+                     trace_path.c_str());
+      }
+
+      // the sorting, formatting and writing are done by the background I/O thread on a snapshot of the cache
+      auto cache = std::make_shared<map>(tunecache);
+      std::string Stamp(stamp);
+      asyncWrite([cache, Label, Stamp, profile_path, async_profile_path, trace_path]() {
+        writeProfile(*cache, Label, Stamp, profile_path, async_profile_path, trace_path);
+      });
+
+#ifdef MULTI_GPU
+    }
 #endif
-      profile_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      profile_file << std::setw(12) << "total time" << "\t" << std::setw(12) << "percentage" << "\t" << std::setw(12) << "calls" << "\t" << std::setw(12) << "time / call" << "\t" << std::setw(16) << "volume" << "\tname\taux\tcomment" << std::endl;
+  }
 
-      async_profile_file << Label << "\t" << quda_version;
-#ifdef GITVERSION
-      async_profile_file << "\t" << gitversion;
+  DeviceTuneTimer::DeviceTuneTimer()
+  {
+    cudaEventCreate(&start_event);
+    cudaEventCreate(&end_event);
+  }
+
+  DeviceTuneTimer::~DeviceTuneTimer()
+  {
+    cudaEventDestroy(start_event);
+    cudaEventDestroy(end_event);
+  }
+
+  void DeviceTuneTimer::start() { cudaEventRecord(start_event, 0); }
+
+  void DeviceTuneTimer::stop()
+  {
+    cudaEventRecord(end_event, 0);
+    cudaEventSynchronize(end_event);
+  }
+
+  double DeviceTuneTimer::elapsed() const
+  {
+    float elapsed_ms;
+    cudaEventElapsedTime(&elapsed_ms, start_event, end_event);
+    return 1e-3 * elapsed_ms;
+  }
+
+  void HostTuneTimer::start() { clock_gettime(CLOCK_MONOTONIC, &start_time); }
+
+  void HostTuneTimer::stop() { clock_gettime(CLOCK_MONOTONIC, &end_time); }
+
+  double HostTuneTimer::elapsed() const
+  {
+    return (end_time.tv_sec - start_time.tv_sec) + 1e-9 * (end_time.tv_nsec - start_time.tv_nsec);
+  }
+
+  HostLaunch::HostLaunch(const TuneParam &param)
+  {
+#ifdef _OPENMP
+    threads = omp_get_max_threads();
+    omp_sched_t kind_;
+    omp_get_schedule(&kind_, &chunk);
+    kind = static_cast<int>(kind_);
+    omp_set_num_threads(param.block.x);
+    omp_set_schedule(static_cast<omp_sched_t>(param.aux.x), param.grid.x);
 #else
-      async_profile_file << "\t" << quda_version;
+    threads = 1;
+    kind = 0;
+    chunk = 0;
 #endif
-      async_profile_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      async_profile_file << std::setw(12) << "total time" << "\t" << std::setw(12) << "percentage" << "\t" << std::setw(12) << "calls" << "\t" << std::setw(12) << "time / call" << "\t" << std::setw(16) << "volume" << "\tname\taux\tcomment" << std::endl;
-
-      serializeProfile(profile_file, async_profile_file);
+  }
 
-      profile_file.close();
-      async_profile_file.close();
+  HostLaunch::~HostLaunch()
+  {
+#ifdef _OPENMP
+    omp_set_num_threads(threads);
+    omp_set_schedule(static_cast<omp_sched_t>(kind), chunk);
+#endif
+  }
 
-      if (traceEnabled()) {
-        trace_file << "trace" << "\t" << quda_version;
-#ifdef GITVERSION
-        trace_file << "\t" << gitversion;
+  /**
+     The maximum number of threads a host Tunable may use, which is
+     the OpenMP default at the time of the first host launch (so
+     subsequent HostLaunch scopes do not change it)
+  */
+  static int maxHostThreads()
+  {
+#ifdef _OPENMP
+    static int max_threads = omp_get_max_threads();
+    return max_threads;
 #else
-        trace_file << "\t" << quda_version;
+    return 1;
 #endif
-        trace_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
+  }
 
-        trace_file << std::setw(12) << "time\t" << std::setw(12) << "device-mem\t" << std::setw(12) << "pinned-mem\t";
-        trace_file << std::setw(12) << "mapped-mem\t" << std::setw(12) << "host-mem\t";
-        trace_file << std::setw(16) << "volume" << "\tname\taux" << std::endl;
+  static constexpr int host_sched_static = 1;  // omp_sched_static
+  static constexpr int host_sched_dynamic = 2; // omp_sched_dynamic
+  static constexpr unsigned int host_min_chunk = 16;
 
-        serializeTrace(trace_file);
+  void Tunable::initHostTuneParam(TuneParam &param) const
+  {
+    param.block = dim3(maxHostThreads(), 1, 1);
+    param.grid = dim3(0, 1, 1);
+    param.shared_bytes = 0;
+    param.aux = make_int4(host_sched_static, 1, 1, 1);
+  }
 
-        trace_file.close();
-      }
+  bool Tunable::advanceHostTuneParam(TuneParam &param) const
+  {
+#ifdef _OPENMP
+    // largest useful chunk gives each thread a single contiguous block of sites
+    const unsigned int max_chunk = std::min(maxHostChunk(), (minThreads() + param.block.x - 1) / param.block.x);
+
+    unsigned int next_chunk = param.grid.x == 0 ? host_min_chunk : 4 * param.grid.x;
+    if (next_chunk <= max_chunk) {
+      param.grid.x = next_chunk;
+      return true;
+    }
 
-      // Release lock.
-      close(lock_handle);
-      remove(lock_path.c_str());
+    if (param.aux.x == host_sched_static) {
+      param.aux.x = host_sched_dynamic;
+      param.grid.x = host_min_chunk;
+      return true;
+    }
 
-#ifdef MULTI_GPU
+    if (param.block.x > 1) {
+      param.block.x /= 2;
+      param.aux.x = host_sched_static;
+      param.grid.x = 0;
+      return true;
     }
+
+    initHostTuneParam(param);
 #endif
+    return false;
   }
 
   static TimeProfile launchTimer("tuneLaunch");
@@ -641,7 +925,21 @@ namespace quda {
    * Return the optimal launch parameters for a given kernel, either
    * by retrieving them from tunecache or autotuning on the spot.
    */
-  TuneParam& tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity)
+  /**
+     @brief Return the id of a stream in the kernel trace: 0 for the
+     default stream, i + 1 for streams[i] and Nstream + 1 for any other
+  */
+  static int traceStream(const cudaStream_t &stream)
+  {
+    if (stream == 0) return 0;
+    if (streams) {
+      for (int i = 0; i < Nstream; i++)
+        if (stream == streams[i]) return i + 1;
+    }
+    return Nstream + 1;
+  }
+
+  TuneParam& tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity, const cudaStream_t &stream)
   {
 
 #ifdef LAUNCH_TIMER
@@ -650,7 +948,10 @@ namespace quda {
 #endif
 
     TuneKey key = tunable.tuneKey();
-    if (use_managed_memory()) strcat(key.aux, ",managed");
+    if (use_managed_memory()) {
+      strcat(key.aux, ",managed");
+      key.rehash();
+    }
     last_key = key;
     static TuneParam param;
 
@@ -660,17 +961,27 @@ namespace quda {
 #endif
 
     static const Tunable *active_tunable; // for error checking
-    it = tunecache.find(key);
+    const bool host = tunable.tuneLocation() == QUDA_CPU_FIELD_LOCATION;
+
+    // a repeat launch of the same key from this instance reuses the
+    // memoized entry, so we only need the full lookup on a miss (a
+    // 64-bit hash collision between two keys launched by the same
+    // instance is vanishingly unlikely)
+    map::value_type *&entry = tunable.cacheEntry();
+    if (!entry || entry->first.hash != key.hash) {
+      auto it = tunecache.find(key);
+      entry = it != tunecache.end() ? &*it : nullptr;
+    }
 
     // first check if we have the tuned value and return if we have it
-    if (enabled == QUDA_TUNE_YES && it != tunecache.end()) {
+    if (enabled == QUDA_TUNE_YES && entry) {
 
 #ifdef LAUNCH_TIMER
       launchTimer.TPSTOP(QUDA_PROFILE_PREAMBLE);
       launchTimer.TPSTART(QUDA_PROFILE_COMPUTE);
 #endif
 
-      TuneParam &param = it->second;
+      TuneParam &param = entry->second;
 
       if (verbosity >= QUDA_DEBUG_VERBOSE) {
         printfQuda("Launching %s with %s at vol=%s with %s\n",
@@ -682,7 +993,7 @@ namespace quda {
       launchTimer.TPSTART(QUDA_PROFILE_EPILOGUE);
 #endif
 
-      tunable.checkLaunchParam(param);
+      if (!host) tunable.checkLaunchParam(param);
 
       // we could be tuning outside of the current scope
       if (!tuning && profile_count) param.n_calls++;
@@ -692,10 +1003,7 @@ namespace quda {
       launchTimer.TPSTOP(QUDA_PROFILE_TOTAL);
 #endif
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) traceKernel(key, param.time, traceStream(stream));
 
       return param;
     }
@@ -706,8 +1014,12 @@ namespace quda {
 #endif
 
     if (enabled == QUDA_TUNE_NO) {
-      tunable.defaultTuneParam(param);
-      tunable.checkLaunchParam(param);
+      if (host) {
+        tunable.defaultHostTuneParam(param);
+      } else {
+        tunable.defaultTuneParam(param);
+        tunable.checkLaunchParam(param);
+      }
       if (verbosity >= QUDA_DEBUG_VERBOSE) {
         printfQuda("Launching %s with %s at vol=%s with %s (untuned)\n",
                    key.name, key.aux, key.volume, tunable.paramString(param).c_str());
@@ -720,7 +1032,6 @@ namespace quda {
       if (comm_rank() == 0 || !commGlobalReduction() || policyTuning()) {
 	TuneParam best_param;
 	cudaError_t error = cudaSuccess;
-	cudaEvent_t start, end;
 	float elapsed_time, best_time;
 	time_t now;
 
@@ -731,8 +1042,11 @@ namespace quda {
 	if (verbosity >= QUDA_DEBUG_VERBOSE) printfQuda("PreTune %s\n", key.name);
 	tunable.preTune();
 
-	cudaEventCreate(&start);
-	cudaEventCreate(&end);
+        // host Tunables are timed with the host clock and make no CUDA calls while tuning
+        static HostTuneTimer host_timer;
+        static DeviceTuneTimer *device_timer = nullptr;
+        if (!host && !device_timer) device_timer = new DeviceTuneTimer;
+        TuneTimer &timer = host ? static_cast<TuneTimer &>(host_timer) : *device_timer;
 
 	if (verbosity >= QUDA_DEBUG_VERBOSE) {
 	  printfQuda("Tuning %s with %s at vol=%s\n", key.name, key.aux, key.volume);
@@ -741,11 +1055,14 @@ namespace quda {
         Timer tune_timer;
         tune_timer.Start(__func__, __FILE__, __LINE__);
 
-        tunable.initTuneParam(param);
+        if (host) tunable.initHostTuneParam(param);
+        else tunable.initTuneParam(param);
 	while (tuning) {
-	  cudaDeviceSynchronize();
-	  cudaGetLastError(); // clear error counter
-	  tunable.checkLaunchParam(param);
+          if (!host) {
+            cudaDeviceSynchronize();
+            cudaGetLastError(); // clear error counter
+            tunable.checkLaunchParam(param);
+          }
 	  tunable.apply(0); // do initial call in case we need to jit compile for these parameters or if policy tuning
 	  if (verbosity >= QUDA_DEBUG_VERBOSE) {
 	    printfQuda("About to call tunable.apply block=(%d,%d,%d) grid=(%d,%d,%d) shared_bytes=%d aux=(%d,%d,%d)\n",
@@ -755,23 +1072,25 @@ namespace quda {
 		       param.aux.x, param.aux.y, param.aux.z);
 	  }
 
-	  cudaEventRecord(start, 0);
+          timer.start();
 	  for (int i=0; i<tunable.tuningIter(); i++) {
 	    tunable.apply(0);  // calls tuneLaunch() again, which simply returns the currently active param
 	  }
-	  cudaEventRecord(end, 0);
-	  cudaEventSynchronize(end);
-	  cudaEventElapsedTime(&elapsed_time, start, end);
-	  cudaDeviceSynchronize();
-	  error = cudaGetLastError();
-
-	  { // check that error state is cleared
-	    cudaDeviceSynchronize();
-	    cudaError_t error = cudaGetLastError();
-	    if (error != cudaSuccess) errorQuda("Failed to clear error state %s\n", cudaGetErrorString(error));
-	  }
+          timer.stop();
+          elapsed_time = timer.elapsed();
+
+          if (!host) {
+            cudaDeviceSynchronize();
+            error = cudaGetLastError();
 
-	  elapsed_time /= (1e3 * tunable.tuningIter());
+            { // check that error state is cleared
+              cudaDeviceSynchronize();
+              cudaError_t error = cudaGetLastError();
+              if (error != cudaSuccess) errorQuda("Failed to clear error state %s\n", cudaGetErrorString(error));
+            }
+          }
+
+	  elapsed_time /= tunable.tuningIter();
 	  if ( (elapsed_time < best_time) && (error == cudaSuccess) && (tunable.jitifyError() == CUDA_SUCCESS) ) {
 	    best_time = elapsed_time;
 	    best_param = param;
@@ -792,7 +1111,7 @@ namespace quda {
 	      }
             }
 	  }
-	  tuning = tunable.advanceTuneParam(param);
+	  tuning = host ? tunable.advanceHostTuneParam(param) : tunable.advanceTuneParam(param);
 	  tunable.jitifyError() = CUDA_SUCCESS;
 	}
 
@@ -811,27 +1130,24 @@ namespace quda {
 	best_param.comment += ctime(&now); // includes a newline
 	best_param.time = best_time;
 
-	cudaEventDestroy(start);
-	cudaEventDestroy(end);
-
 	if (verbosity >= QUDA_DEBUG_VERBOSE) printfQuda("PostTune %s\n", key.name);
 	tunable.postTune();
 	param = best_param;
 	tunecache[key] = best_param;
+        newTuneEntry(*tunecache.find(key));
 
       }
       if (commGlobalReduction() || policyTuning()) broadcastTuneCache();
 
       // check this process is getting the key that is expected
-      if (tunecache.find(key) == tunecache.end()) {
+      auto it = tunecache.find(key);
+      if (it == tunecache.end()) {
 	errorQuda("Failed to find key entry (%s:%s:%s)", key.name, key.volume, key.aux);
       }
-      param = tunecache[key]; // read this now for all processes
+      entry = &*it;
+      param = entry->second; // read this now for all processes
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) traceKernel(key, param.time, traceStream(stream));
 
     } else if (&tunable != active_tunable) {
       errorQuda("Unexpected call to tuneLaunch() in %s::apply()", typeid(tunable).name());
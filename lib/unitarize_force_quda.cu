@@ -401,7 +401,7 @@ namespace quda {
       }
 
       void apply(const cudaStream_t &stream) {
-	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+	TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
 	getUnitarizeForceField<<<tp.grid,tp.block>>>(arg);
       }
 
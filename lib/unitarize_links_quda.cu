@@ -37,12 +37,13 @@ namespace {
   static double svd_rel_error = 1e-6;
   static double svd_abs_error = 1e-6;
 
-  template <typename Float_, int nColor_, QudaReconstructType recon_>
+  template <typename Float_, int nColor_, QudaReconstructType recon_,
+            typename Gauge_ = typename gauge_mapper<Float_, recon_>::type>
   struct UnitarizeLinksArg {
     using Float = Float_;
     static constexpr int nColor = nColor_;
     static constexpr QudaReconstructType recon = recon_;
-    typedef typename gauge_mapper<Float,recon>::type Gauge;
+    typedef Gauge_ Gauge;
     Gauge out;
     const Gauge in;
 
@@ -254,9 +255,10 @@ namespace {
     checkPrecision(outfield, infield);
 
     int num_failures = 0;
-    Matrix<complex<double>,3> inlink, outlink;
 
+#pragma omp parallel for reduction(+:num_failures) schedule(runtime)
     for (unsigned int i = 0; i < infield.Volume(); ++i) {
+      Matrix<complex<double>,3> inlink, outlink;
       for (int dir=0; dir<4; ++dir){
 	if (infield.Precision() == QUDA_SINGLE_PRECISION) {
 	  copyArrayToLink(&inlink, ((float*)(infield.Gauge_p()) + (i*4 + dir)*18)); // order of arguments?
@@ -308,26 +310,49 @@ namespace {
   } // is unitary
 
 
-  template <typename Arg> __global__ void DoUnitarizedLink(Arg arg)
+  /**
+     @brief Unitarize a single link, returning false if the result
+     fails the unitarity check
+  */
+  template <typename Arg> __device__ __host__ bool unitarizeLinkSite(Arg &arg, int idx, int parity, int mu)
   {
-    int idx = threadIdx.x + blockIdx.x*blockDim.x;
-    int parity = threadIdx.y + blockIdx.y*blockDim.y;
-    int mu = threadIdx.z + blockIdx.z*blockDim.z;
-    if (idx >= arg.threads) return;
-    if (mu >= 4) return;
-
     // result is always in double precision
     Matrix<complex<double>,Arg::nColor> v, result;
     Matrix<complex<typename Arg::Float>,Arg::nColor> tmp = arg.in(mu, idx, parity);
 
     v = tmp;
     unitarizeLinkMILC<double>(result, v, arg);
-    if (arg.check_unitarization) {
-      if (isUnitary(result,arg.max_error) == false) atomicAdd(arg.fails, 1);
-    }
+    bool pass = true;
+    if (arg.check_unitarization) pass = isUnitary(result,arg.max_error);
     tmp = result;
 
     arg.out(mu, idx, parity) = tmp;
+    return pass;
+  }
+
+  template <typename Arg> __global__ void DoUnitarizedLink(Arg arg)
+  {
+    int idx = threadIdx.x + blockIdx.x*blockDim.x;
+    int parity = threadIdx.y + blockIdx.y*blockDim.y;
+    int mu = threadIdx.z + blockIdx.z*blockDim.z;
+    if (idx >= arg.threads) return;
+    if (mu >= 4) return;
+
+    if (!unitarizeLinkSite(arg, idx, parity, mu)) atomicAdd(arg.fails, 1);
+  }
+
+  template <typename Arg> void DoUnitarizedLinkCPU(Arg &arg)
+  {
+    int fails = 0;
+#pragma omp parallel for collapse(2) reduction(+:fails) schedule(runtime)
+    for (int parity = 0; parity < 2; parity++) {
+      for (int idx = 0; idx < arg.threads; idx++) {
+        for (int mu = 0; mu < 4; mu++) {
+          if (!unitarizeLinkSite(arg, idx, parity, mu)) fails++;
+        }
+      }
+    }
+    *arg.fails += fails;
   }
 
   template <typename Float, int nColor, QudaReconstructType recon>
@@ -351,7 +376,7 @@ namespace {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       DoUnitarizedLink<<<tp.grid, tp.block, tp.shared_bytes, stream>>>(arg);
     }
 
@@ -370,11 +395,38 @@ namespace {
     TuneKey tuneKey() const { return TuneKey(meta.VolString(), typeid(*this).name(), meta.AuxString()); }
   };
 
+  template <typename Float, int nColor, QudaReconstructType recon, QudaGaugeFieldOrder order>
+  void unitarizeLinksHost(GaugeField &out, const GaugeField &in, int *fails)
+  {
+    typedef typename gauge_order_mapper<Float, order, nColor>::type G;
+    UnitarizeLinksArg<Float, nColor, recon, G> arg(out, in, fails, max_iter, unitarize_eps, max_error,
+                                                   reunit_allow_svd, reunit_svd_only, svd_rel_error, svd_abs_error);
+    DoUnitarizedLinkCPU(arg);
+  }
+
+  template <typename Float, int nColor, QudaReconstructType recon> struct UnitarizeLinksHost {
+    UnitarizeLinksHost(GaugeField &out, const GaugeField &in, int *fails)
+    {
+      if (out.Order() != in.Order()) errorQuda("Mismatched orders %d %d", out.Order(), in.Order());
+      if (in.Order() == QUDA_QDP_GAUGE_ORDER) {
+        unitarizeLinksHost<Float, nColor, recon, QUDA_QDP_GAUGE_ORDER>(out, in, fails);
+      } else if (in.Order() == QUDA_MILC_GAUGE_ORDER) {
+        unitarizeLinksHost<Float, nColor, recon, QUDA_MILC_GAUGE_ORDER>(out, in, fails);
+      } else {
+        errorQuda("Gauge order %d not supported on CPU", in.Order());
+      }
+    }
+  };
+
   void unitarizeLinks(GaugeField& out, const GaugeField &in, int* fails)
   {
 #ifdef GPU_UNITARIZE
     checkPrecision(out, in);
-    instantiate<UnitarizeLinks, ReconstructWilson>(out, in, fails);
+    if (checkLocation(out, in) == QUDA_CUDA_FIELD_LOCATION) {
+      instantiate<UnitarizeLinks, ReconstructWilson>(out, in, fails);
+    } else {
+      instantiate<UnitarizeLinksHost, ReconstructNone>(out, in, fails);
+    }
 #else
     errorQuda("Unitarization has not been built");
 #endif
@@ -441,7 +493,7 @@ namespace {
     }
 
     void apply(const cudaStream_t &stream) {
-      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
+      TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity(), stream);
       ProjectSU3kernel<<<tp.grid, tp.block, tp.shared_bytes, stream>>>(arg);
     }
 
@@ -0,0 +1,473 @@
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <vector_io.h>
+
+namespace quda
+{
+
+  static constexpr char vector_file_magic[8] = {'Q', 'U', 'D', 'A', 'V', 'E', 'C', '\0'};
+  static constexpr int vector_file_version = 1;
+  static constexpr size_t vector_file_page = 4096;
+
+  /**
+     Header of the native vector checkpoint.  This occupies the first
+     page of the file and is written by rank 0.
+   */
+  struct VectorFileHeader {
+    char magic[8];
+    int32_t version;
+    int32_t storage;
+    int32_t nvec;
+    int32_t nColor;
+    int32_t nSpin;
+    int32_t nDim;
+    int32_t x[QUDA_MAX_DIM]; // local (per-rank) field dimensions
+    int32_t siteSubset;
+    int32_t parity;
+    int32_t gammaBasis;
+    int32_t nRank;
+    int32_t grid[4];         // process grid
+    int64_t sites;           // local sites per vector
+    int64_t chunk_bytes;     // padded bytes per vector chunk
+    int64_t table_bytes;     // padded bytes of the per-rank checksum table
+    int64_t rank_bytes;      // padded bytes per rank region
+  };
+
+  static_assert(sizeof(VectorFileHeader) <= vector_file_page, "Vector file header exceeds a page");
+
+  static inline size_t pageRound(size_t bytes) { return ((bytes + vector_file_page - 1) / vector_file_page) * vector_file_page; }
+
+  static size_t storageBytes(VectorFileStorage storage, size_t sites, int site_reals)
+  {
+    switch (storage) {
+    case VECTOR_FILE_STORAGE_DOUBLE: return sites * site_reals * sizeof(double);
+    case VECTOR_FILE_STORAGE_SINGLE: return sites * site_reals * sizeof(float);
+    case VECTOR_FILE_STORAGE_HALF: return sites * site_reals * sizeof(uint16_t);
+    case VECTOR_FILE_STORAGE_FIXED16: return sites * (sizeof(float) + site_reals * sizeof(int16_t));
+    default: errorQuda("Unknown vector file storage %d", storage);
+    }
+    return 0;
+  }
+
+  static const char *storageString(VectorFileStorage storage)
+  {
+    switch (storage) {
+    case VECTOR_FILE_STORAGE_DOUBLE: return "double";
+    case VECTOR_FILE_STORAGE_SINGLE: return "single";
+    case VECTOR_FILE_STORAGE_HALF: return "half";
+    case VECTOR_FILE_STORAGE_FIXED16: return "fixed16";
+    default: return "invalid";
+    }
+  }
+
+  // software IEEE fp16 conversion with round-to-nearest-even
+  static inline uint16_t floatToHalf(float f)
+  {
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    uint32_t sign = (x >> 16) & 0x8000;
+    int32_t exp = static_cast<int32_t>((x >> 23) & 0xff) - 127 + 15;
+    uint32_t mant = x & 0x7fffff;
+
+    if (((x >> 23) & 0xff) == 0xff) return sign | 0x7c00 | (mant ? 0x200 : 0); // inf / nan
+    if (exp >= 0x1f) return sign | 0x7c00;                                      // overflow
+    if (exp <= 0) {                                                              // subnormal or zero
+      if (exp < -10) return sign;
+      mant |= 0x800000;
+      int shift = 14 - exp;
+      uint32_t h = mant >> shift;
+      uint32_t rem = mant & ((1u << shift) - 1);
+      uint32_t halfway = 1u << (shift - 1);
+      if (rem > halfway || (rem == halfway && (h & 1))) h++;
+      return sign | h;
+    }
+
+    uint32_t h = sign | (exp << 10) | (mant >> 13);
+    uint32_t rem = mant & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) h++; // a carry correctly rolls into the exponent
+    return h;
+  }
+
+  static inline float halfToFloat(uint16_t h)
+  {
+    uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t x;
+
+    if (exp == 0) {
+      if (mant == 0) {
+        x = sign;
+      } else { // subnormal so renormalize
+        exp = 127 - 15 + 1;
+        while (!(mant & 0x400)) {
+          mant <<= 1;
+          exp--;
+        }
+        x = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+      }
+    } else if (exp == 0x1f) {
+      x = sign | 0x7f800000 | (mant << 13);
+    } else {
+      x = sign | ((exp - 15 + 127) << 23) | (mant << 13);
+    }
+
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+  }
+
+  /**
+     Position-dependent XOR checksum over 64-bit words: each word is
+     rotated by its index so that permuted words are detected.
+   */
+  static uint64_t chunkChecksum(const char *buffer, size_t bytes)
+  {
+    const uint64_t *w = reinterpret_cast<const uint64_t *>(buffer);
+    const int64_t n = bytes / sizeof(uint64_t);
+    uint64_t sum = 0;
+#pragma omp parallel for reduction(^ : sum)
+    for (int64_t i = 0; i < n; i++) {
+      const int r = i & 63;
+      const uint64_t x = w[i];
+      sum ^= ((x << r) | (x >> ((64 - r) & 63))) ^ static_cast<uint64_t>(i);
+    }
+    return sum;
+  }
+
+  static void encodeChunk(char *chunk, const void *src, QudaPrecision src_prec, VectorFileStorage storage,
+                          int64_t sites, int site_reals)
+  {
+    const int64_t n = sites * site_reals;
+    switch (storage) {
+    case VECTOR_FILE_STORAGE_DOUBLE:
+    case VECTOR_FILE_STORAGE_SINGLE: memcpy(chunk, src, n * src_prec); break;
+    case VECTOR_FILE_STORAGE_HALF: {
+      const float *in = static_cast<const float *>(src);
+      uint16_t *out = reinterpret_cast<uint16_t *>(chunk);
+#pragma omp parallel for
+      for (int64_t i = 0; i < n; i++) out[i] = floatToHalf(in[i]);
+      break;
+    }
+    case VECTOR_FILE_STORAGE_FIXED16: {
+      const float *in = static_cast<const float *>(src);
+      float *norm = reinterpret_cast<float *>(chunk);
+      int16_t *out = reinterpret_cast<int16_t *>(chunk + sites * sizeof(float));
+#pragma omp parallel for
+      for (int64_t s = 0; s < sites; s++) {
+        float max = 0.0f;
+        for (int j = 0; j < site_reals; j++) max = std::max(max, std::fabs(in[s * site_reals + j]));
+        norm[s] = max;
+        const float scale = max > 0.0f ? 32767.0f / max : 0.0f;
+        for (int j = 0; j < site_reals; j++)
+          out[s * site_reals + j] = static_cast<int16_t>(std::lrint(in[s * site_reals + j] * scale));
+      }
+      break;
+    }
+    default: errorQuda("Unknown vector file storage %d", storage);
+    }
+  }
+
+  static void decodeChunk(float *dst, const char *chunk, VectorFileStorage storage, int64_t sites, int site_reals)
+  {
+    const int64_t n = sites * site_reals;
+    switch (storage) {
+    case VECTOR_FILE_STORAGE_HALF: {
+      const uint16_t *in = reinterpret_cast<const uint16_t *>(chunk);
+#pragma omp parallel for
+      for (int64_t i = 0; i < n; i++) dst[i] = halfToFloat(in[i]);
+      break;
+    }
+    case VECTOR_FILE_STORAGE_FIXED16: {
+      const float *norm = reinterpret_cast<const float *>(chunk);
+      const int16_t *in = reinterpret_cast<const int16_t *>(chunk + sites * sizeof(float));
+#pragma omp parallel for
+      for (int64_t s = 0; s < sites; s++) {
+        const float scale = norm[s] / 32767.0f;
+        for (int j = 0; j < site_reals; j++) dst[s * site_reals + j] = scale * in[s * site_reals + j];
+      }
+      break;
+    }
+    default: errorQuda("Vector file storage %d does not need decoding", storage);
+    }
+  }
+
+  /**
+     Create a host space-spin-color field with the geometry of v.  If
+     ptr is non-null the field references ptr rather than allocating.
+   */
+  static ColorSpinorField *createHostField(const ColorSpinorField &v, QudaPrecision prec, QudaGammaBasis basis,
+                                           void *ptr = nullptr)
+  {
+    ColorSpinorParam param(v);
+    param.location = QUDA_CPU_FIELD_LOCATION;
+    param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+    param.pad = 0;
+    param.setPrecision(prec);
+    param.gammaBasis = basis;
+    param.create = ptr ? QUDA_REFERENCE_FIELD_CREATE : QUDA_NULL_FIELD_CREATE;
+    param.v = ptr;
+    return ColorSpinorField::Create(param);
+  }
+
+  VectorFileStorage vectorFileStorage(const ColorSpinorField &v)
+  {
+    char *storage_env = getenv("QUDA_VECTOR_FILE_STORAGE");
+    if (storage_env) {
+      if (strcmp(storage_env, "double") == 0) return VECTOR_FILE_STORAGE_DOUBLE;
+      if (strcmp(storage_env, "single") == 0) return VECTOR_FILE_STORAGE_SINGLE;
+      if (strcmp(storage_env, "half") == 0) return VECTOR_FILE_STORAGE_HALF;
+      if (strcmp(storage_env, "fixed16") == 0) return VECTOR_FILE_STORAGE_FIXED16;
+      warningQuda("Unknown QUDA_VECTOR_FILE_STORAGE=%s, using the field precision", storage_env);
+    }
+    return v.Precision() == QUDA_DOUBLE_PRECISION ? VECTOR_FILE_STORAGE_DOUBLE : VECTOR_FILE_STORAGE_SINGLE;
+  }
+
+  bool useNativeVectorFile()
+  {
+#ifdef HAVE_QIO
+    char *format_env = getenv("QUDA_VECTOR_FILE_FORMAT");
+    return format_env && strcmp(format_env, "native") == 0;
+#else
+    return true;
+#endif
+  }
+
+  bool isNativeVectorFile(const std::string &filename)
+  {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    char magic[sizeof(vector_file_magic)];
+    bool native = read(fd, magic, sizeof(magic)) == sizeof(magic) && memcmp(magic, vector_file_magic, sizeof(magic)) == 0;
+    close(fd);
+    return native;
+  }
+
+  static void pwriteAll(int fd, const char *buffer, size_t bytes, off_t offset, const std::string &filename)
+  {
+    while (bytes > 0) {
+      ssize_t written = pwrite(fd, buffer, bytes, offset);
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        errorQuda("Failed to write %s: %s", filename.c_str(), strerror(errno));
+      }
+      buffer += written;
+      offset += written;
+      bytes -= written;
+    }
+  }
+
+  void saveVectorsNative(const std::vector<ColorSpinorField *> &vecs, const std::string &filename,
+                         VectorFileStorage storage)
+  {
+    if (vecs.size() == 0) errorQuda("No vectors to save");
+    const ColorSpinorField &v0 = *vecs[0];
+    if (storage == VECTOR_FILE_STORAGE_INVALID) storage = vectorFileStorage(v0);
+
+    VectorFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, vector_file_magic, sizeof(header.magic));
+    header.version = vector_file_version;
+    header.storage = storage;
+    header.nvec = vecs.size();
+    header.nColor = v0.Ncolor();
+    header.nSpin = v0.Nspin();
+    header.nDim = v0.Ndim();
+    for (int d = 0; d < v0.Ndim(); d++) header.x[d] = v0.X(d);
+    header.siteSubset = v0.SiteSubset();
+    header.parity = v0.SuggestedParity();
+    header.gammaBasis = v0.GammaBasis();
+    header.nRank = comm_size();
+    for (int d = 0; d < 4; d++) header.grid[d] = comm_dim(d);
+    header.sites = v0.Volume();
+
+    const int site_reals = 2 * v0.Nspin() * v0.Ncolor();
+    header.chunk_bytes = pageRound(storageBytes(storage, header.sites, site_reals));
+    header.table_bytes = pageRound(header.nvec * sizeof(uint64_t));
+    header.rank_bytes = header.table_bytes + header.nvec * header.chunk_bytes;
+    const off_t rank_offset = vector_file_page + static_cast<off_t>(comm_rank()) * header.rank_bytes;
+
+    if (getVerbosity() >= QUDA_SUMMARIZE)
+      printfQuda("Start saving %d vectors to %s (native, %s storage)\n", header.nvec, filename.c_str(),
+                 storageString(storage));
+
+    // rank 0 creates the file and writes the header, after which all ranks fill in their region
+    if (comm_rank() == 0) {
+      int fd = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd < 0) errorQuda("Failed to create %s: %s", filename.c_str(), strerror(errno));
+      if (ftruncate(fd, vector_file_page + header.nRank * header.rank_bytes) != 0)
+        errorQuda("Failed to size %s: %s", filename.c_str(), strerror(errno));
+      pwriteAll(fd, reinterpret_cast<const char *>(&header), sizeof(header), 0, filename);
+      close(fd);
+    }
+    comm_barrier();
+
+    int fd = open(filename.c_str(), O_WRONLY);
+    if (fd < 0) errorQuda("Failed to open %s: %s", filename.c_str(), strerror(errno));
+
+    // host staging field in the file order, only used if the vectors cannot be written directly
+    const QudaPrecision stage_prec = storage == VECTOR_FILE_STORAGE_DOUBLE ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION;
+    ColorSpinorField *stage = nullptr;
+
+    std::vector<char> chunk(header.chunk_bytes, 0);
+    std::vector<uint64_t> table(header.table_bytes / sizeof(uint64_t), 0);
+
+    for (int i = 0; i < header.nvec; i++) {
+      const ColorSpinorField &v = *vecs[i];
+      if (v.Volume() != v0.Volume() || v.Ncolor() != v0.Ncolor() || v.Nspin() != v0.Nspin())
+        errorQuda("Vector %d geometry does not match vector 0", i);
+
+      const void *src = nullptr;
+      if (v.Location() == QUDA_CPU_FIELD_LOCATION && v.FieldOrder() == QUDA_SPACE_SPIN_COLOR_FIELD_ORDER
+          && v.Precision() == stage_prec) {
+        src = v.V();
+      } else {
+        if (!stage) stage = createHostField(v0, stage_prec, v0.GammaBasis());
+        *stage = v;
+        src = stage->V();
+      }
+
+      encodeChunk(chunk.data(), src, stage_prec, storage, header.sites, site_reals);
+      table[i] = chunkChecksum(chunk.data(), header.chunk_bytes);
+      pwriteAll(fd, chunk.data(), header.chunk_bytes, rank_offset + header.table_bytes + i * header.chunk_bytes, filename);
+    }
+
+    pwriteAll(fd, reinterpret_cast<const char *>(table.data()), header.table_bytes, rank_offset, filename);
+    if (fsync(fd) != 0) warningQuda("Failed to sync %s: %s", filename.c_str(), strerror(errno));
+    close(fd);
+    comm_barrier();
+
+    if (stage) delete stage;
+    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done saving vectors\n");
+  }
+
+  /**
+     Memory map a native vector file and read its header, checking
+     that this rank's region is present.  The mapping must be released
+     with munmap(map, size).
+   */
+  static char *mapVectorFile(const std::string &filename, VectorFileHeader &header, size_t &size)
+  {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) errorQuda("Failed to open %s: %s", filename.c_str(), strerror(errno));
+    struct stat st;
+    if (fstat(fd, &st) != 0) errorQuda("Failed to stat %s: %s", filename.c_str(), strerror(errno));
+    size = st.st_size;
+    if (size < vector_file_page) errorQuda("%s is too small to be a vector file", filename.c_str());
+
+    char *map = static_cast<char *>(mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0));
+    if (map == MAP_FAILED) errorQuda("Failed to map %s: %s", filename.c_str(), strerror(errno));
+    close(fd);
+
+    memcpy(&header, map, sizeof(header));
+    if (memcmp(header.magic, vector_file_magic, sizeof(header.magic)) != 0)
+      errorQuda("%s is not a native vector file", filename.c_str());
+    if (header.version != vector_file_version)
+      errorQuda("Unsupported vector file version %d (expected %d)", header.version, vector_file_version);
+    if (header.nRank != comm_size())
+      errorQuda("Vector file was written with %d ranks, running with %d", header.nRank, comm_size());
+    if (size < vector_file_page + header.nRank * header.rank_bytes)
+      errorQuda("Vector file %s is truncated", filename.c_str());
+
+    return map;
+  }
+
+  int verifyVectorsNative(const std::string &filename)
+  {
+    VectorFileHeader header;
+    size_t size;
+    char *map = mapVectorFile(filename, header, size);
+
+    const char *rank_region = map + vector_file_page + static_cast<size_t>(comm_rank()) * header.rank_bytes;
+    const uint64_t *table = reinterpret_cast<const uint64_t *>(rank_region);
+    int corrupt = 0;
+    for (int i = 0; i < header.nvec; i++) {
+      const char *chunk = rank_region + header.table_bytes + i * header.chunk_bytes;
+      if (chunkChecksum(chunk, header.chunk_bytes) != table[i]) {
+        warningQuda("Checksum mismatch for vector %d on rank %d in %s", i, comm_rank(), filename.c_str());
+        corrupt++;
+      }
+    }
+    munmap(map, size);
+
+    comm_allreduce_int(&corrupt);
+    return corrupt;
+  }
+
+  void loadVectorsNative(std::vector<ColorSpinorField *> &vecs, const std::string &filename)
+  {
+    if (vecs.size() == 0) errorQuda("No vectors to load");
+    const ColorSpinorField &v0 = *vecs[0];
+
+    VectorFileHeader header;
+    size_t size;
+    char *map = mapVectorFile(filename, header, size);
+
+    // the file must match the geometry and decomposition of the fields
+    if (header.nColor != v0.Ncolor() || header.nSpin != v0.Nspin() || header.nDim != v0.Ndim()
+        || header.siteSubset != v0.SiteSubset() || header.sites != static_cast<int64_t>(v0.Volume()))
+      errorQuda("Vector file geometry (nColor=%d nSpin=%d nDim=%d subset=%d sites=%ld) does not match the fields "
+                "(nColor=%d nSpin=%d nDim=%d subset=%d sites=%lu)",
+                header.nColor, header.nSpin, header.nDim, header.siteSubset, static_cast<long>(header.sites),
+                v0.Ncolor(), v0.Nspin(), v0.Ndim(), v0.SiteSubset(), static_cast<unsigned long>(v0.Volume()));
+    for (int d = 0; d < v0.Ndim(); d++)
+      if (header.x[d] != v0.X(d)) errorQuda("Vector file dimension %d = %d does not match field %d", d, header.x[d], v0.X(d));
+    for (int d = 0; d < 4; d++)
+      if (header.grid[d] != comm_dim(d))
+        errorQuda("Vector file process grid dimension %d = %d does not match %d", d, header.grid[d], comm_dim(d));
+    if (header.nvec < static_cast<int>(vecs.size()))
+      errorQuda("Vector file contains %d vectors, %lu requested", header.nvec, vecs.size());
+    if (v0.SiteSubset() == QUDA_PARITY_SITE_SUBSET && header.parity != v0.SuggestedParity())
+      warningQuda("Loading vectors saved with parity %d into fields with suggested parity %d", header.parity,
+                  v0.SuggestedParity());
+
+    const VectorFileStorage storage = static_cast<VectorFileStorage>(header.storage);
+    const int site_reals = 2 * v0.Nspin() * v0.Ncolor();
+    const char *rank_region = map + vector_file_page + static_cast<size_t>(comm_rank()) * header.rank_bytes;
+    const uint64_t *table = reinterpret_cast<const uint64_t *>(rank_region);
+    posix_madvise(const_cast<char *>(rank_region), header.rank_bytes, POSIX_MADV_SEQUENTIAL);
+
+    if (getVerbosity() >= QUDA_SUMMARIZE)
+      printfQuda("Start loading %lu vectors from %s (native, %s storage)\n", vecs.size(), filename.c_str(),
+                 storageString(storage));
+
+    const QudaPrecision file_prec = storage == VECTOR_FILE_STORAGE_DOUBLE ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION;
+    std::vector<float> decode_buffer;
+    if (storage == VECTOR_FILE_STORAGE_HALF || storage == VECTOR_FILE_STORAGE_FIXED16)
+      decode_buffer.resize(header.sites * site_reals);
+
+    for (unsigned int i = 0; i < vecs.size(); i++) {
+      const char *chunk = rank_region + header.table_bytes + i * header.chunk_bytes;
+      if (chunkChecksum(chunk, header.chunk_bytes) != table[i])
+        errorQuda("Checksum mismatch for vector %u on rank %d in %s", i, comm_rank(), filename.c_str());
+
+      void *src = const_cast<char *>(chunk);
+      if (decode_buffer.size() > 0) {
+        decodeChunk(decode_buffer.data(), chunk, storage, header.sites, site_reals);
+        src = decode_buffer.data();
+      }
+
+      // wrap the mapped (or decoded) chunk as a host field and copy straight into the destination
+      ColorSpinorField *file_field
+        = createHostField(v0, file_prec, static_cast<QudaGammaBasis>(header.gammaBasis), src);
+      *vecs[i] = *file_field;
+      delete file_field;
+    }
+
+    munmap(map, size);
+    if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done loading vectors\n");
+  }
+
+} // namespace quda
@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <blas_host.h>
+#include <util_quda.h>
+
+#include <test_util.h>
+#include <test_params.h>
+#include <misc.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Test of the host batched matrix inversion.  Random well-conditioned
+   matrices, diagonally dominant with their rows permuted such that
+   the pivoting is exercised, are inverted for batch sizes that do and
+   do not divide the interleaving width of the inversion, and the
+   product A * Ainv of each matrix is compared with the identity.
+
+   Usage: blas_host_test
+*/
+
+using namespace quda;
+
+using ::testing::Combine;
+using ::testing::Values;
+
+/**
+   @brief Fill each matrix of the batch with random complex elements
+   in [-1,1], add n to the diagonal and then permute the rows of every
+   other matrix
+ */
+template <typename Float> void fillBatch(std::vector<std::complex<Float>> &A, int n, int batch)
+{
+  std::mt19937 rng(1234 + n * batch);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<int> perm(n);
+
+  for (int b = 0; b < batch; b++) {
+    std::complex<Float> *a = A.data() + static_cast<size_t>(b) * n * n;
+    std::iota(perm.begin(), perm.end(), 0);
+    if (b % 2) std::shuffle(perm.begin(), perm.end(), rng);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        std::complex<double> z(dist(rng), dist(rng));
+        if (i == j) z += static_cast<double>(n);
+        a[perm[i] * n + j] = std::complex<Float>(z.real(), z.imag());
+      }
+    }
+  }
+}
+
+/**
+   @brief Return the largest deviation of A * Ainv from the identity
+   over the batch, with the product accumulated in double precision
+ */
+template <typename Float>
+double identityError(const std::vector<std::complex<Float>> &A, const std::vector<std::complex<Float>> &Ainv, int n,
+                     int batch)
+{
+  double error = 0.0;
+  for (int b = 0; b < batch; b++) {
+    const std::complex<Float> *a = A.data() + static_cast<size_t>(b) * n * n;
+    const std::complex<Float> *ainv = Ainv.data() + static_cast<size_t>(b) * n * n;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        std::complex<double> sum = i == j ? -1.0 : 0.0;
+        for (int k = 0; k < n; k++)
+          sum += std::complex<double>(a[i * n + k]) * std::complex<double>(ainv[k * n + j]);
+        error = std::max(error, std::abs(sum));
+      }
+    }
+  }
+  return error;
+}
+
+template <typename Float> double batchInvert(QudaPrecision prec, int n, int batch)
+{
+  std::vector<std::complex<Float>> A(static_cast<size_t>(batch) * n * n);
+  std::vector<std::complex<Float>> Ainv(A.size());
+  fillBatch(A, n, batch);
+
+  // the input must be left untouched
+  std::vector<std::complex<Float>> A_copy(A);
+  hostblas::BatchInvertMatrix(Ainv.data(), A.data(), n, batch, prec);
+  EXPECT_TRUE(A == A_copy);
+
+  return identityError(A, Ainv, n, batch);
+}
+
+// test parameters: precision, matrix dimension, batch size
+using invert_test_t = ::testing::tuple<QudaPrecision, int, int>;
+
+class BatchInvertTest : public ::testing::TestWithParam<invert_test_t>
+{
+protected:
+  invert_test_t param;
+
+public:
+  BatchInvertTest() : param(GetParam()) { }
+};
+
+TEST_P(BatchInvertTest, identity)
+{
+  const QudaPrecision prec = ::testing::get<0>(param);
+  const int n = ::testing::get<1>(param);
+  const int batch = ::testing::get<2>(param);
+
+  double error = prec == QUDA_DOUBLE_PRECISION ? batchInvert<double>(prec, n, batch) : batchInvert<float>(prec, n, batch);
+  const double tol = n * (prec == QUDA_DOUBLE_PRECISION ? 1e-14 : 1e-6);
+
+  printfQuda("%s precision, n = %d, batch = %d: max |A * Ainv - I| = %e\n",
+             prec == QUDA_DOUBLE_PRECISION ? "double" : "single", n, batch, error);
+  EXPECT_LE(error, tol);
+}
+
+std::string getBatchInvertName(::testing::TestParamInfo<invert_test_t> param)
+{
+  const QudaPrecision prec = ::testing::get<0>(param.param);
+  std::string name = prec == QUDA_DOUBLE_PRECISION ? "double" : "single";
+  name += "_n" + std::to_string(::testing::get<1>(param.param));
+  name += "_batch" + std::to_string(::testing::get<2>(param.param));
+  return name;
+}
+
+// the interleaving width is 8 matrices in double and 16 in single precision
+INSTANTIATE_TEST_SUITE_P(QUDA, BatchInvertTest,
+                         Combine(Values(QUDA_SINGLE_PRECISION, QUDA_DOUBLE_PRECISION), Values(1, 6, 24),
+                                 Values(1, 7, 16, 37)),
+                         getBatchInvertName);
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  setVerbosity(verbosity);
+
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+  int result = RUN_ALL_TESTS();
+
+  finalizeComms();
+  return result;
+}
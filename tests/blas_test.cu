@@ -14,7 +14,7 @@
 // google test
 #include <gtest/gtest.h>
 
-constexpr int Nkernels = 43;
+constexpr int Nkernels = 46;
 
 using namespace quda;
 
@@ -101,7 +101,10 @@ const char *names[] = {"copyHS",
                        "cDotProduct_block",
                        "reDotProductNorm_block",
                        "reDotProduct_block",
-                       "axpy_block"};
+                       "axpy_block",
+                       "caxpy_block_host",
+                       "axpyBzpcx_block_host",
+                       "cDotProduct_block_host"};
 
 // kernels that utilize multi-blas
 bool is_multi(int kernel) { return std::string(names[kernel]).find("_block") != std::string::npos ? true : false; }
@@ -370,6 +373,11 @@ double benchmark(int kernel, const int niter) {
   quda::Complex * A2 = new quda::Complex[Nsrc*Nsrc]; // for the block cDotProductNorm test
   double *Ar = new double[Nsrc * Msrc];
 
+  // the host fields as used by the host multi-blas kernels
+  std::vector<ColorSpinorField *> xm(xmH.begin(), xmH.end());
+  std::vector<ColorSpinorField *> ym(ymH.begin(), ymH.end());
+  std::vector<ColorSpinorField *> zm(zmH.begin(), zmH.end());
+
   cudaEvent_t start, end;
   cudaEventCreate(&start);
   cudaEventCreate(&end);
@@ -553,6 +561,18 @@ double benchmark(int kernel, const int niter) {
       for (int i = 0; i < niter; ++i) blas::axpy(Ar, xmD->Components(), ymD->Components());
       break;
 
+    case 43:
+      for (int i = 0; i < niter; ++i) blas::caxpy(A, xm, ym);
+      break;
+
+    case 44:
+      for (int i = 0; i < niter; ++i) blas::axpyBzpcx((double *)A, xm, zm, (double *)B, *yH, (double *)C);
+      break;
+
+    case 45:
+      for (int i = 0; i < niter; ++i) blas::cDotProduct(A, xm, ym);
+      break;
+
     default:
       errorQuda("Undefined blas kernel %d\n", kernel);
     }
@@ -587,6 +607,11 @@ double test(int kernel) {
   quda::Complex * B2 = new quda::Complex[Nsrc*Nsrc]; // for the block cDotProductNorm test
   double *Ar = new double[Nsrc * Msrc];
 
+  // the host fields as used by the host multi-blas kernels
+  std::vector<ColorSpinorField *> xm(xmH.begin(), xmH.end());
+  std::vector<ColorSpinorField *> ym(ymH.begin(), ymH.end());
+  std::vector<ColorSpinorField *> zm(zmH.begin(), zmH.end());
+
   for (int i = 0; i < Nsrc * Msrc; i++) {
     A[i] = a2 * (1.0 * ((i / (double)Nsrc) + i)) + b2 * (1.0 * i) + c2 * (1.0 * (0.5 * Nsrc * Msrc - i));
     B[i] = a2 * (1.0 * ((i / (double)Nsrc) + i)) - b2 * (M_PI * i) + c2 * (1.0 * (0.5 * Nsrc * Msrc - i));
@@ -1015,6 +1040,50 @@ double test(int kernel) {
     error /= Msrc;
     break;
 
+  case 43:
+    for (int i = 0; i < Nsrc; i++) xmD->Component(i) = *(xmH[i]);
+    for (int i = 0; i < Msrc; i++) ymD->Component(i) = *(ymH[i]);
+
+    blas::caxpy(A, *xmD, *ymD);
+    blas::caxpy(A, xm, ym);
+
+    error = 0;
+    for (int i = 0; i < Msrc; i++) {
+      error += fabs(blas::norm2((ymD->Component(i))) - blas::norm2(*(ymH[i]))) / blas::norm2(*(ymH[i]));
+    }
+    error /= Msrc;
+    break;
+
+  case 44:
+    for (int i = 0; i < Nsrc; i++) {
+      xmD->Component(i) = *(xmH[i]);
+      zmD->Component(i) = *(zmH[i]);
+    }
+    *yD = *yH;
+
+    blas::axpyBzpcx((double *)A, xmD->Components(), zmD->Components(), (double *)B, *yD, (const double *)C);
+    blas::axpyBzpcx((double *)A, xm, zm, (double *)B, *yH, (const double *)C);
+
+    error = 0;
+    for (int i = 0; i < Nsrc; i++) {
+      error += fabs(blas::norm2((xmD->Component(i))) - blas::norm2(*(xmH[i]))) / blas::norm2(*(xmH[i]));
+      error += fabs(blas::norm2((zmD->Component(i))) - blas::norm2(*(zmH[i]))) / blas::norm2(*(zmH[i]));
+    }
+    error /= 2 * Nsrc;
+    break;
+
+  case 45:
+    for (int i = 0; i < Nsrc; i++) xmD->Component(i) = *(xmH[i]);
+    for (int i = 0; i < Msrc; i++) ymD->Component(i) = *(ymH[i]);
+    blas::cDotProduct(A, xmD->Components(), ymD->Components());
+    blas::cDotProduct(B, xm, ym);
+    error = 0.0;
+    for (int i = 0; i < Nsrc; i++) {
+      for (int j = 0; j < Msrc; j++) { error += std::abs(A[i * Msrc + j] - B[i * Msrc + j]) / std::abs(B[i * Msrc + j]); }
+    }
+    error /= Nsrc * Msrc;
+    break;
+
   default:
     errorQuda("Undefined blas kernel %d\n", kernel);
   }
@@ -232,3 +232,57 @@ int contraction_reference(Float *spinorX, Float *spinorY, Float *d_result, QudaC
   free(h_result);
   return faults;
 };
+
+/**
+   Momentum projection of the site contractions d_site, summed over
+   each time slice, into the global T x n_mom x 16 array result of
+   complex doubles, using the global coordinates of each site.
+ */
+template <typename Float>
+void contraction_momentum_reference(const Float *d_site, double *result, const int *mom, int n_mom, int X[])
+{
+  const int T = X[3] * comm_dim(3);
+  for (int i = 0; i < 2 * T * n_mom * 16; i++) result[i] = 0.0;
+
+  for (int i = 0; i < V; i++) {
+    // coordinates of the even-odd ordered site i
+    int parity = i / Vh;
+    int x_cb = i % Vh;
+    int za = x_cb / (X[0] / 2);
+    int zb = za / X[1];
+    int x1 = za - zb * X[1];
+    int x3 = zb / X[2];
+    int x2 = zb - x3 * X[2];
+    int x0 = 2 * (x_cb - za * (X[0] / 2)) + ((x1 + x2 + x3 + parity) & 1);
+    int x[4] = {x0, x1, x2, x3};
+
+    int t = comm_coord(3) * X[3] + x[3];
+    for (int m = 0; m < n_mom; m++) {
+      double theta = 0.0;
+      for (int d = 0; d < 3; d++)
+        theta += 2.0 * M_PI * mom[3 * m + d] * (comm_coord(d) * X[d] + x[d]) / (X[d] * comm_dim(d));
+      double c = cos(theta), s = sin(theta);
+      for (int g = 0; g < 16; g++) {
+        double re = d_site[32 * i + 2 * g], im = d_site[32 * i + 2 * g + 1];
+        result[2 * ((t * n_mom + m) * 16 + g) + 0] += c * re - s * im;
+        result[2 * ((t * n_mom + m) * 16 + g) + 1] += c * im + s * re;
+      }
+    }
+  }
+
+  comm_allreduce_array(result, 2 * T * n_mom * 16);
+}
+
+/**
+   Compare two momentum-projected contractions, returning the number
+   of elements that differ by more than the given relative tolerance.
+ */
+inline int contraction_momentum_compare(const double *a, const double *b, int n, double tol)
+{
+  double norm = 0.0;
+  for (int i = 0; i < n; i++) norm = std::max(norm, fabs(b[i]));
+  int faults = 0;
+  for (int i = 0; i < n; i++)
+    if (fabs(a[i] - b[i]) > tol * norm) faults++;
+  return faults;
+}
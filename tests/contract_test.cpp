@@ -3,6 +3,7 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
+#include <sys/time.h>
 
 #include <util_quda.h>
 #include <test_util.h>
@@ -23,6 +24,7 @@
 // In a typical application, quda.h is the only QUDA header required.
 #include <quda.h>
 #include <color_spinor_field.h>
+#include <contract_quda.h>
 
 
 // If you add a new contraction type, this must be updated++
@@ -211,6 +213,95 @@ void test(int contractionType, int Prec)
   free(d_result);
 }
 
+#define TDIFF(a, b) (b.tv_sec - a.tv_sec + 0.000001 * (b.tv_usec - a.tv_usec))
+
+// Compares the momentum-projected contraction, on both the device and
+// the host, with the host projection of the site contractions, and
+// reports the output bytes and time of each
+void testMomentum(int Prec)
+{
+  QudaPrecision testPrec = Prec == 0 ? QUDA_SINGLE_PRECISION : QUDA_DOUBLE_PRECISION;
+  int X[4] = {xdim, ydim, zdim, tdim};
+
+  QudaInvertParam inv_param = newQudaInvertParam();
+  setInvertParam(inv_param);
+  inv_param.cpu_prec = testPrec;
+  inv_param.cuda_prec = testPrec;
+  inv_param.cuda_prec_sloppy = testPrec;
+  inv_param.cuda_prec_precondition = testPrec;
+
+  // all momenta with components in {-1, 0, 1} and |n|^2 <= 2
+  std::vector<int> mom;
+  for (int nz = -1; nz <= 1; nz++)
+    for (int ny = -1; ny <= 1; ny++)
+      for (int nx = -1; nx <= 1; nx++)
+        if (nx * nx + ny * ny + nz * nz <= 2) mom.insert(mom.end(), {nx, ny, nz});
+  const int n_mom = mom.size() / 3;
+  const int T = tdim * comm_dim(3);
+  const int n_proj = 2 * T * n_mom * 16;
+
+  size_t sSize = (testPrec == QUDA_DOUBLE_PRECISION) ? sizeof(double) : sizeof(float);
+  void *spinorX = malloc(V * spinorSiteSize * sSize);
+  void *spinorY = malloc(V * spinorSiteSize * sSize);
+  void *d_site = malloc(2 * V * 16 * sSize);
+  std::vector<double> h_proj(n_proj), d_proj(n_proj), c_proj(n_proj);
+
+  for (int i = 0; i < V * spinorSiteSize; i++) {
+    if (testPrec == QUDA_SINGLE_PRECISION) {
+      ((float *)spinorX)[i] = rand() / (float)RAND_MAX;
+      ((float *)spinorY)[i] = rand() / (float)RAND_MAX;
+    } else {
+      ((double *)spinorX)[i] = rand() / (double)RAND_MAX;
+      ((double *)spinorY)[i] = rand() / (double)RAND_MAX;
+    }
+  }
+
+  struct timeval t0, t1, t2;
+
+  // site contractions returned to the host and projected there
+  gettimeofday(&t0, NULL);
+  contractQuda(spinorX, spinorY, d_site, QUDA_CONTRACT_TYPE_DR, &inv_param, X);
+  gettimeofday(&t1, NULL);
+  if (testPrec == QUDA_DOUBLE_PRECISION)
+    contraction_momentum_reference((double *)d_site, h_proj.data(), mom.data(), n_mom, X);
+  else
+    contraction_momentum_reference((float *)d_site, h_proj.data(), mom.data(), n_mom, X);
+  gettimeofday(&t2, NULL);
+  double t_site = TDIFF(t0, t1), t_ft = TDIFF(t1, t2);
+
+  // projected on the device
+  gettimeofday(&t0, NULL);
+  contractMomentumQuda(spinorX, spinorY, d_proj.data(), QUDA_CONTRACT_TYPE_DR, mom.data(), n_mom, &inv_param, X);
+  gettimeofday(&t1, NULL);
+  double t_device = TDIFF(t0, t1);
+
+  // projected on the host
+  ColorSpinorParam cpuParam(spinorX, inv_param, X, false, QUDA_CPU_FIELD_LOCATION);
+  cpuColorSpinorField x(cpuParam);
+  cpuParam.v = spinorY;
+  cpuColorSpinorField y(cpuParam);
+  gettimeofday(&t0, NULL);
+  quda::contractMomentumQuda(x, y, c_proj.data(), QUDA_CONTRACT_TYPE_DR, mom.data(), n_mom);
+  gettimeofday(&t1, NULL);
+  double t_host = TDIFF(t0, t1);
+
+  double tol = (testPrec == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-5);
+  int faults = contraction_momentum_compare(d_proj.data(), h_proj.data(), n_proj, tol);
+  faults += contraction_momentum_compare(c_proj.data(), h_proj.data(), n_proj, tol);
+
+  printfQuda("Momentum projection of %d momenta, output bytes per process: site = %lu, projected = %lu\n", n_mom,
+             2 * V * 16 * sSize, n_proj * sizeof(double));
+  printfQuda("Site contraction %g secs + host projection %g secs, device projection %g secs, host %g secs\n", t_site,
+             t_ft, t_device, t_host);
+  printfQuda("Momentum projection comparison complete with %d/%d faults\n", faults, 2 * n_proj);
+
+  EXPECT_LE(faults, 0) << "Projected and reference contractions do not agree";
+
+  free(spinorX);
+  free(spinorY);
+  free(d_site);
+}
+
 // The following tests gets each contraction type and precision using google testing framework
 using ::testing::Bool;
 using ::testing::Combine;
@@ -248,5 +339,17 @@ std::string getContractName(testing::TestParamInfo<::testing::tuple<int, int>> p
   return str; // names[contractType] + "_" + prec_str[prec];
 }
 
+class ContractionMomentumTest : public ::testing::TestWithParam<int>
+{
+};
+
+TEST_P(ContractionMomentumTest, verify) { testMomentum(GetParam()); }
+
+std::string getContractMomentumName(testing::TestParamInfo<int> param)
+{
+  return std::string("Momentum_") + std::string(prec_str[param.param]);
+}
+
 // Instantiate all test cases
 INSTANTIATE_TEST_SUITE_P(QUDA, ContractionTest, Combine(Range(0, 2), Range(0, NcontractType)), getContractName);
+INSTANTIATE_TEST_SUITE_P(QUDA, ContractionMomentumTest, Range(0, 2), getContractMomentumName);
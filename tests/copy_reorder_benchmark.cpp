@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <quda_internal.h>
+#include <gauge_field.h>
+#include <color_spinor_field.h>
+#include <util_quda.h>
+
+#include <test_util.h>
+#include <test_params.h>
+#include <misc.h>
+
+/**
+   Benchmark of the host reordering of spinor and gauge fields, as
+   performed by copyGenericColorSpinor and copyGenericGauge when the
+   reorder location is the CPU (e.g., in loadGaugeQuda and
+   invertQuda).  For each (input order, output order, precision)
+   combination the copy is run niter times and the sustained host
+   bandwidth (bytes read plus bytes written) is reported.  The
+   "native" output order is the GPU field order at the --prec
+   precision (and --recon reconstruction for gauge fields), written
+   to a host buffer, which is the reorder done before the transfer to
+   the device.
+
+   Usage: copy_reorder_benchmark --dim X Y Z T --prec <prec> --recon <recon> --niter <n>
+*/
+
+using namespace quda;
+
+static const char *spinor_order_str(QudaFieldOrder order)
+{
+  switch (order) {
+  case QUDA_SPACE_SPIN_COLOR_FIELD_ORDER: return "space-spin-color";
+  case QUDA_SPACE_COLOR_SPIN_FIELD_ORDER: return "space-color-spin";
+  case QUDA_FLOAT2_FIELD_ORDER: return "native-float2";
+  case QUDA_FLOAT4_FIELD_ORDER: return "native-float4";
+  default: return "unknown";
+  }
+}
+
+static const char *gauge_order_str(QudaGaugeFieldOrder order)
+{
+  switch (order) {
+  case QUDA_QDP_GAUGE_ORDER: return "qdp";
+  case QUDA_MILC_GAUGE_ORDER: return "milc";
+  case QUDA_FLOAT2_GAUGE_ORDER: return "native-float2";
+  case QUDA_FLOAT4_GAUGE_ORDER: return "native-float4";
+  default: return "unknown";
+  }
+}
+
+template <typename Copy> static double bandwidth(Copy &&copy, size_t bytes)
+{
+  copy(); // warm up, and tune the launch if tuning is enabled
+  stopwatchStart();
+  for (int i = 0; i < niter; i++) copy();
+  double secs = stopwatchReadSeconds();
+  return static_cast<double>(bytes) * niter / (1e9 * secs);
+}
+
+static void spinorBenchmark()
+{
+  ColorSpinorParam param;
+  param.nColor = 3;
+  param.nSpin = 4;
+  param.nDim = 4;
+  for (int d = 0; d < 4; d++) param.x[d] = dim[d];
+  param.pad = 0;
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  param.location = QUDA_CPU_FIELD_LOCATION;
+
+  const QudaPrecision cpu_prec[] = {QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION};
+  const QudaFieldOrder cpu_order[] = {QUDA_SPACE_SPIN_COLOR_FIELD_ORDER, QUDA_SPACE_COLOR_SPIN_FIELD_ORDER};
+
+  printfQuda("\nSpinor reorder (GB/s)\n");
+  printfQuda("%18s %18s %8s %8s %10s\n", "in order", "out order", "in prec", "out prec", "GB/s");
+
+  for (auto in_prec : cpu_prec) {
+    for (auto in_order : cpu_order) {
+      param.setPrecision(in_prec);
+      param.fieldOrder = in_order;
+      cpuColorSpinorField in(param);
+      in.Source(QUDA_RANDOM_SOURCE);
+
+      // host to host reorders
+      for (auto out_order : cpu_order) {
+        param.fieldOrder = out_order;
+        cpuColorSpinorField out(param);
+        double gbytes = bandwidth([&]() { copyGenericColorSpinor(out, in, QUDA_CPU_FIELD_LOCATION); },
+                                  in.Bytes() + out.Bytes());
+        printfQuda("%18s %18s %8s %8s %10.2f\n", spinor_order_str(in_order), spinor_order_str(out_order),
+                   get_prec_str(in_prec), get_prec_str(in_prec), gbytes);
+      }
+
+      // host reorder into the native order, with and without the
+      // change of gamma basis applied for Wilson-type fermions
+      for (auto basis : {QUDA_DEGRAND_ROSSI_GAMMA_BASIS, QUDA_UKQCD_GAMMA_BASIS}) {
+        ColorSpinorParam native_param(param);
+        native_param.location = QUDA_CUDA_FIELD_LOCATION;
+        native_param.create = QUDA_NULL_FIELD_CREATE;
+        native_param.fieldOrder = QUDA_FLOAT2_FIELD_ORDER;
+        native_param.gammaBasis = basis;
+        native_param.setPrecision(prec, prec, true);
+        cudaColorSpinorField out(native_param);
+
+        char *buffer = static_cast<char *>(safe_malloc(out.Bytes() + out.NormBytes()));
+        double gbytes = bandwidth(
+          [&]() {
+            copyGenericColorSpinor(out, in, QUDA_CPU_FIELD_LOCATION, buffer, 0, buffer + out.Bytes(), 0);
+          },
+          in.Bytes() + out.Bytes() + out.NormBytes());
+        printfQuda("%18s %18s %8s %8s %10.2f%s\n", spinor_order_str(in_order), spinor_order_str(out.FieldOrder()),
+                   get_prec_str(in_prec), get_prec_str(prec), gbytes,
+                   basis == QUDA_UKQCD_GAMMA_BASIS ? " (basis change)" : "");
+        host_free(buffer);
+      }
+    }
+  }
+}
+
+static void gaugeBenchmark()
+{
+  QudaGaugeParam gauge_param = newQudaGaugeParam();
+  for (int d = 0; d < 4; d++) gauge_param.X[d] = dim[d];
+  gauge_param.type = QUDA_SU3_LINKS;
+  gauge_param.anisotropy = 1.0;
+  gauge_param.scale = 1.0;
+  gauge_param.t_boundary = QUDA_PERIODIC_T;
+  gauge_param.gauge_fix = QUDA_GAUGE_FIXED_NO;
+
+  const QudaPrecision cpu_prec[] = {QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION};
+  std::vector<QudaGaugeFieldOrder> cpu_order;
+#ifdef BUILD_QDP_INTERFACE
+  cpu_order.push_back(QUDA_QDP_GAUGE_ORDER);
+#endif
+#ifdef BUILD_MILC_INTERFACE
+  cpu_order.push_back(QUDA_MILC_GAUGE_ORDER);
+#endif
+  if (cpu_order.size() == 0) {
+    printfQuda("\nSkipping gauge reorder: neither the QDP nor MILC interface has been built\n");
+    return;
+  }
+
+  printfQuda("\nGauge reorder (GB/s)\n");
+  printfQuda("%18s %18s %8s %8s %8s %10s\n", "in order", "out order", "in prec", "out prec", "recon", "GB/s");
+
+  for (auto in_prec : cpu_prec) {
+    for (auto in_order : cpu_order) {
+      gauge_param.cpu_prec = in_prec;
+      gauge_param.gauge_order = in_order;
+      GaugeFieldParam param(nullptr, gauge_param);
+      param.create = QUDA_ZERO_FIELD_CREATE;
+      param.ghostExchange = QUDA_GHOST_EXCHANGE_NO;
+      cpuGaugeField in(param);
+
+      // host to host reorders
+      for (auto out_order : cpu_order) {
+        GaugeFieldParam out_param(param);
+        out_param.order = out_order;
+        cpuGaugeField out(out_param);
+        double gbytes
+          = bandwidth([&]() { copyGenericGauge(out, in, QUDA_CPU_FIELD_LOCATION); }, in.Bytes() + out.Bytes());
+        printfQuda("%18s %18s %8s %8s %8s %10.2f\n", gauge_order_str(in_order), gauge_order_str(out_order),
+                   get_prec_str(in_prec), get_prec_str(in_prec), get_recon_str(QUDA_RECONSTRUCT_NO), gbytes);
+      }
+
+      // host reorder into the native order, as done by loadGaugeQuda
+      GaugeFieldParam native_param(param);
+      native_param.location = QUDA_CUDA_FIELD_LOCATION;
+      native_param.create = QUDA_NULL_FIELD_CREATE;
+      native_param.reconstruct = link_recon;
+      native_param.setPrecision(prec, true);
+      cudaGaugeField out(native_param);
+
+      void *buffer = safe_malloc(out.Bytes());
+      double gbytes = bandwidth([&]() { copyGenericGauge(out, in, QUDA_CPU_FIELD_LOCATION, buffer, 0); },
+                                in.Bytes() + out.Bytes());
+      printfQuda("%18s %18s %8s %8s %8s %10.2f\n", gauge_order_str(in_order), gauge_order_str(out.Order()),
+                 get_prec_str(in_prec), get_prec_str(prec), get_recon_str(link_recon), gbytes);
+      host_free(buffer);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // command line options
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  initQuda(device);
+  setVerbosity(verbosity);
+
+  printfQuda("Host reorder benchmark on %dx%dx%dx%d local volume, %d iterations\n", xdim, ydim, zdim, tdim, niter);
+
+  spinorBenchmark();
+  gaugeBenchmark();
+
+  endQuda();
+  finalizeComms();
+
+  return 0;
+}
@@ -4,6 +4,8 @@
 #include <string.h>
 #include <math.h>
 #include <complex.h>
+#include <complex>
+#include <vector>
 
 #include <quda.h>
 #include <test_util.h>
@@ -274,6 +276,7 @@ void dslashReference_4d_sgpu(sFloat *res, gFloat **gaugeFull, sFloat *spinorFiel
 
   // Initialize the return half-spinor to zero.  Note that it is a
   // 5d spinor, hence the use of V5h.
+#pragma omp parallel for
   for (int i=0; i<V5h*4*3*2; i++) res[i] = 0.0;
   
   // Some pointers that we use to march through arrays.
@@ -286,17 +289,18 @@ void dslashReference_4d_sgpu(sFloat *res, gFloat **gaugeFull, sFloat *spinorFiel
     // are 4-dim'l.
     gaugeOdd[dir]  = gaugeFull[dir]+Vh*gaugeSiteSize;
   }
-  int sp_idx,gaugeOddBit;
+  // each 5-d site is computed independently
+#pragma omp parallel for collapse(2)
   for (int xs=0;xs<Ls;xs++) {
     for (int gge_idx = 0; gge_idx < Vh; gge_idx++) {
       for (int dir = 0; dir < 8; dir++) {
-        sp_idx=gge_idx+Vh*xs;
+        int sp_idx=gge_idx+Vh*xs;
         // Here is a function call to study.  It is defined near
         // Line 90 of this file.
         // Here we have to switch oddBit depending on the value of xs.  E.g., suppose
         // xs=1.  Then the odd spinor site x1=x2=x3=x4=0 wants the even gauge array
         // element 0, so that we get U_\mu(0).
-	gaugeOddBit = (xs%2 == 0 || type == QUDA_4D_PC) ? oddBit : (oddBit+1) % 2;
+	int gaugeOddBit = (xs%2 == 0 || type == QUDA_4D_PC) ? oddBit : (oddBit+1) % 2;
         gFloat *gauge = gaugeLink_sgpu(gge_idx, dir, gaugeOddBit, gaugeEven, gaugeOdd);
         
         // Even though we're doing the 4d part of the dslash, we need
@@ -331,6 +335,7 @@ void dslashReference_4d_mgpu(sFloat *res, gFloat **gaugeFull, gFloat **ghostGaug
     sFloat **fwdSpinor, sFloat **backSpinor, int oddBit, int daggerBit)
 {
   int mySpinorSiteSize = 24;		    
+#pragma omp parallel for
   for (int i=0; i<V5h*mySpinorSiteSize; i++) res[i] = 0.0;
   
   gFloat *gaugeEven[4], *gaugeOdd[4];
@@ -344,12 +349,13 @@ void dslashReference_4d_mgpu(sFloat *res, gFloat **gaugeFull, gFloat **ghostGaug
     ghostGaugeEven[dir] = ghostGauge[dir];
     ghostGaugeOdd[dir] = ghostGauge[dir] + (faceVolume[dir]/2)*gaugeSiteSize;
   }
+  // each 5-d site is computed independently
+#pragma omp parallel for collapse(2)
   for (int xs=0;xs<Ls;xs++) 
   {  
-    int sp_idx;
     for (int i = 0; i < Vh; i++) 
     {
-      sp_idx = i + Vh*xs;
+      int sp_idx = i + Vh*xs;
       for (int dir = 0; dir < 8; dir++) 
       {
 	int gaugeOddBit = (xs%2 == 0 || type == QUDA_4D_PC) ? oddBit : (oddBit + 1) % 2;
@@ -377,6 +383,7 @@ void dslashReference_4d_mgpu(sFloat *res, gFloat **gaugeFull, gFloat **ghostGaug
 template <QudaPCType type, bool zero_initialize = false, typename sFloat>
 void dslashReference_5th(sFloat *res, sFloat *spinorField, int oddBit, int daggerBit, sFloat mferm)
 {
+#pragma omp parallel for
   for (int i = 0; i < V5h; i++) {
     if (zero_initialize) for(int one_site = 0 ; one_site < 24 ; one_site++)
       res[i*(4*3*2)+one_site] = 0.0;
@@ -400,172 +407,140 @@ void dslashReference_5th(sFloat *res, sFloat *spinorField, int oddBit, int dagge
   }
 }
 
-//Currently we consider only spacetime decomposition (not in 5th dim), so this operator is local
-template <typename sFloat>
-void dslashReference_5th_inv(sFloat *res, sFloat *spinorField, int oddBit, int daggerBit, sFloat mferm, double *kappa)
+/**
+   The inverse of the fifth-dimension operator M5 acts on the s-slices
+   of each 4-d site independently, and does not mix the two
+   chiralities, which are the upper (P_-) and lower (P_+) halves of
+   the spinor.  It is applied as an LDU solve: for one chirality a
+   forward and a backward sweep along s, for the other the corner
+   terms coupling slice Ls-1 to all other slices, with the two roles
+   exchanged by dagger.  The coefficients of the sweeps only depend on
+   kappa and mferm, so they are computed once rather than per slice
+   and site, and are only rebuilt when these change.
+ */
+struct M5InvCoeff {
+  int Ls = 0;
+  double mferm = 0.0;
+  std::vector<std::complex<double>> kappa;
+  std::vector<std::complex<double>> two_kappa; // sub-diagonal coefficient of slice s
+  std::vector<std::complex<double>> corner;    // coupling of slice s to slice Ls-1
+  std::vector<std::complex<double>> inv_Ftr;   // diagonal normalization
+};
+
+/**
+   @return The M5^{-1} coefficients for the given parameters,
+   rebuilding them only if these have changed since the last call
+ */
+static const M5InvCoeff &m5InvCoeff(double mferm, const std::complex<double> *kappa)
 {
-  double *inv_Ftr = (double*)malloc(Ls*sizeof(sFloat));
-  double *Ftr = (double*)malloc(Ls*sizeof(sFloat));
-  for(int xs = 0 ; xs < Ls ; xs++)
-  {
-    inv_Ftr[xs] = 1.0/(1.0+pow(2.0*kappa[xs], Ls)*mferm);
-    Ftr[xs] = -2.0*kappa[xs]*mferm*inv_Ftr[xs]; 
-    for (int i = 0; i < Vh; i++) {
-      memcpy(&res[24*(i+Vh*xs)], &spinorField[24*(i+Vh*xs)], 24*sizeof(sFloat));
+  static M5InvCoeff m5;
+
+  bool rebuild = (m5.Ls != Ls || m5.mferm != mferm);
+  for (int xs = 0; xs < Ls && !rebuild; xs++)
+    if (m5.kappa[xs] != kappa[xs]) rebuild = true;
+
+  if (rebuild) {
+    m5.Ls = Ls;
+    m5.mferm = mferm;
+    m5.kappa.assign(kappa, kappa + Ls);
+    m5.two_kappa.resize(Ls);
+    m5.corner.resize(Ls);
+    m5.inv_Ftr.resize(Ls);
+    for (int xs = 0; xs < Ls; xs++) {
+      m5.two_kappa[xs] = 2.0 * kappa[xs];
+      m5.inv_Ftr[xs] = 1.0 / (1.0 + std::pow(m5.two_kappa[xs], Ls) * mferm);
+      m5.corner[xs] = -std::pow(m5.two_kappa[xs], xs + 1) * mferm * m5.inv_Ftr[xs];
     }
   }
-  if(daggerBit == 0)
-  {
-    // s = 0
-    for (int i = 0; i < Vh; i++) {
-      ax(&res[12+24*(i+Vh*(Ls-1))],(sFloat)(inv_Ftr[0]), &spinorField[12+24*(i+Vh*(Ls-1))], 12);
-    }
+  return m5;
+}
 
-    // s = 1 ... ls-2
-    for(int xs = 0 ; xs <= Ls-2 ; ++xs)
-    {
-      for (int i = 0; i < Vh; i++) {
-        axpy((sFloat)(2.0*kappa[xs]), &res[24*(i+Vh*xs)], &res[24*(i+Vh*(xs+1))], 12);
-        axpy((sFloat)Ftr[xs], &res[12+24*(i+Vh*xs)], &res[12+24*(i+Vh*(Ls-1))], 12);
-      }
-      for (int tmp_s = 0 ; tmp_s < Ls ; tmp_s++)
-        Ftr[tmp_s] *= 2.0*kappa[tmp_s];
-    }
-    for(int xs = 0 ; xs < Ls ; xs++)
-    {
-      Ftr[xs] = -pow(2.0*kappa[xs],Ls-1)*mferm*inv_Ftr[xs]; 
-    }
-    // s = ls-2 ... 0
-    for(int xs = Ls-2 ; xs >=0 ; --xs)
-    {
-      for (int i = 0; i < Vh; i++) {
-        axpy((sFloat)Ftr[xs], &res[24*(i+Vh*(Ls-1))], &res[24*(i+Vh*xs)], 12);
-        axpy((sFloat)(2.0*kappa[xs]), &res[12+24*(i+Vh*(xs+1))], &res[12+24*(i+Vh*xs)], 12);
-      }
-      for (int tmp_s = 0 ; tmp_s < Ls ; tmp_s++)
-        Ftr[tmp_s] /= 2.0*kappa[tmp_s];
-    }
-    // s = ls -1
-    for (int i = 0; i < Vh; i++) {
-      ax(&res[24*(i+Vh*(Ls-1))], (sFloat)(inv_Ftr[Ls-1]), &res[24*(i+Vh*(Ls-1))], 12);
-    }
+// y += a * x for the 6 complex numbers of one chirality
+template <typename sFloat> static inline void caxpyHalf(const sFloat a[2], const sFloat *__restrict__ x, sFloat *__restrict__ y)
+{
+  for (int c = 0; c < 6; c++) {
+    y[2 * c + 0] += a[0] * x[2 * c + 0] - a[1] * x[2 * c + 1];
+    y[2 * c + 1] += a[0] * x[2 * c + 1] + a[1] * x[2 * c + 0];
   }
-  else
-  {
-    // s = 0
-    for (int i = 0; i < Vh; i++) {
-      ax(&res[24*(i+Vh*(Ls-1))],(sFloat)(inv_Ftr[0]), &spinorField[24*(i+Vh*(Ls-1))], 12);
-    }
+}
 
-    // s = 1 ... ls-2
-    for(int xs = 0 ; xs <= Ls-2 ; ++xs)
-    {
-      for (int i = 0; i < Vh; i++) {
-        axpy((sFloat)Ftr[xs], &res[24*(i+Vh*xs)], &res[24*(i+Vh*(Ls-1))], 12);
-        axpy((sFloat)(2.0*kappa[xs]), &res[12+24*(i+Vh*xs)], &res[12+24*(i+Vh*(xs+1))], 12);
-      }
-      for (int tmp_s = 0 ; tmp_s < Ls ; tmp_s++)
-        Ftr[tmp_s] *= 2.0*kappa[tmp_s];
-    }
-    for(int xs = 0 ; xs < Ls ; xs++)
-    {
-      Ftr[xs] = -pow(2.0*kappa[xs],Ls-1)*mferm*inv_Ftr[xs]; 
-    }
-    // s = ls-2 ... 0
-    for(int xs = Ls-2 ; xs >=0 ; --xs)
-    {
-      for (int i = 0; i < Vh; i++) {
-        axpy((sFloat)(2.0*kappa[xs]), &res[24*(i+Vh*(xs+1))], &res[24*(i+Vh*xs)], 12);
-        axpy((sFloat)Ftr[xs], &res[12+24*(i+Vh*(Ls-1))], &res[12+24*(i+Vh*xs)], 12);
-      }
-      for (int tmp_s = 0 ; tmp_s < Ls ; tmp_s++)
-        Ftr[tmp_s] /= 2.0*kappa[tmp_s];
-    }
-    // s = ls -1
-    for (int i = 0; i < Vh; i++) {
-      ax(&res[12+24*(i+Vh*(Ls-1))], (sFloat)(inv_Ftr[Ls-1]), &res[12+24*(i+Vh*(Ls-1))], 12);
-    }
+// x = a * x for the 6 complex numbers of one chirality
+template <typename sFloat> static inline void caxHalf(const sFloat a[2], sFloat *x)
+{
+  for (int c = 0; c < 6; c++) {
+    sFloat re = a[0] * x[2 * c + 0] - a[1] * x[2 * c + 1];
+    sFloat im = a[0] * x[2 * c + 1] + a[1] * x[2 * c + 0];
+    x[2 * c + 0] = re;
+    x[2 * c + 1] = im;
   }
-  free(inv_Ftr);
-  free(Ftr);
 }
 
-// Currently we consider only spacetime decomposition (not in 5th dim), so this operator is local
-template <typename sFloat, typename sComplex>
-void mdslashReference_5th_inv(sFloat *res, sFloat *spinorField, int oddBit, int daggerBit, sFloat mferm, sComplex *kappa)
+// res = M5^{-1} spinorField, with the 4-d sites distributed over the threads
+template <typename sFloat>
+void applyM5Inv(sFloat *res, const sFloat *spinorField, int daggerBit, const M5InvCoeff &m)
 {
-  sComplex *inv_Ftr = (sComplex *)malloc(Ls * sizeof(sComplex));
-  sComplex *Ftr = (sComplex *)malloc(Ls * sizeof(sComplex));
-  for (int xs = 0; xs < Ls; xs++) {
-    inv_Ftr[xs] = 1.0 / (1.0 + cpow(2.0 * kappa[xs], Ls) * mferm);
-    Ftr[xs] = -2.0 * kappa[xs] * mferm * inv_Ftr[xs];
-    for (int i = 0; i < Vh; i++) {
-      memcpy(&res[24 * (i + Vh * xs)], &spinorField[24 * (i + Vh * xs)], 24 * sizeof(sFloat));
-    }
+  const int L = m.Ls;
+  std::vector<sFloat> two_kappa(2 * L), corner(2 * L), inv_Ftr(2 * L);
+  for (int xs = 0; xs < L; xs++) {
+    two_kappa[2 * xs + 0] = m.two_kappa[xs].real();
+    two_kappa[2 * xs + 1] = m.two_kappa[xs].imag();
+    corner[2 * xs + 0] = m.corner[xs].real();
+    corner[2 * xs + 1] = m.corner[xs].imag();
+    inv_Ftr[2 * xs + 0] = m.inv_Ftr[xs].real();
+    inv_Ftr[2 * xs + 1] = m.inv_Ftr[xs].imag();
   }
-  if (daggerBit == 0) {
-    // s = 0
-    for (int i = 0; i < Vh; i++) {
-      ax((sComplex *)&res[12 + 24 * (i + Vh * (Ls - 1))], inv_Ftr[0],
-          (sComplex *)&spinorField[12 + 24 * (i + Vh * (Ls - 1))], 6);
-    }
+  // offsets of the chirality that is swept along s, and of the one coupled through the corner
+  const int a = daggerBit ? 12 : 0;
+  const int b = daggerBit ? 0 : 12;
 
-    // s = 1 ... ls-2
-    for (int xs = 0; xs <= Ls - 2; ++xs) {
-      for (int i = 0; i < Vh; i++) {
-        axpy((2.0 * kappa[xs]), (sComplex *)&res[24 * (i + Vh * xs)], (sComplex *)&res[24 * (i + Vh * (xs + 1))], 6);
-        axpy(Ftr[xs], (sComplex *)&res[12 + 24 * (i + Vh * xs)], (sComplex *)&res[12 + 24 * (i + Vh * (Ls - 1))], 6);
-      }
-      for (int tmp_s = 0; tmp_s < Ls; tmp_s++) Ftr[tmp_s] *= 2.0 * kappa[tmp_s];
-    }
-    for (int xs = 0; xs < Ls; xs++) Ftr[xs] = -cpow(2.0 * kappa[xs], Ls - 1) * mferm * inv_Ftr[xs];
-
-    // s = ls-2 ... 0
-    for (int xs = Ls - 2; xs >= 0; --xs) {
-      for (int i = 0; i < Vh; i++) {
-        axpy(Ftr[xs], (sComplex *)&res[24 * (i + Vh * (Ls - 1))], (sComplex *)&res[24 * (i + Vh * xs)], 6);
-        axpy((2.0 * kappa[xs]), (sComplex *)&res[12 + 24 * (i + Vh * (xs + 1))],
-            (sComplex *)&res[12 + 24 * (i + Vh * xs)], 6);
-      }
-      for (int tmp_s = 0; tmp_s < Ls; tmp_s++) Ftr[tmp_s] /= 2.0 * kappa[tmp_s];
-    }
-    // s = ls -1
-    for (int i = 0; i < Vh; i++) {
-      ax((sComplex *)&res[24 * (i + Vh * (Ls - 1))], inv_Ftr[Ls - 1], (sComplex *)&res[24 * (i + Vh * (Ls - 1))], 6);
-    }
-  } else {
-    // s = 0
+#pragma omp parallel
+  {
+    std::vector<sFloat> psi(L * 24);
+
+#pragma omp for
     for (int i = 0; i < Vh; i++) {
-      ax((sComplex *)&res[24 * (i + Vh * (Ls - 1))], inv_Ftr[0], (sComplex *)&spinorField[24 * (i + Vh * (Ls - 1))], 6);
-    }
+      // gather the fifth-dimension column of this 4-d site
+      for (int xs = 0; xs < L; xs++)
+        for (int j = 0; j < 24; j++) psi[xs * 24 + j] = spinorField[24 * (i + Vh * xs) + j];
+
+      sFloat *last = &psi[(L - 1) * 24];
+      caxHalf(&inv_Ftr[0], last + b);
 
-    // s = 1 ... ls-2
-    for (int xs = 0; xs <= Ls - 2; ++xs) {
-      for (int i = 0; i < Vh; i++) {
-        axpy(Ftr[xs], (sComplex *)&res[24 * (i + Vh * xs)], (sComplex *)&res[24 * (i + Vh * (Ls - 1))], 6);
-        axpy((2.0 * kappa[xs]), (sComplex *)&res[12 + 24 * (i + Vh * xs)],
-            (sComplex *)&res[12 + 24 * (i + Vh * (xs + 1))], 6);
+      // s = 0 ... ls-2
+      for (int xs = 0; xs <= L - 2; ++xs) {
+        caxpyHalf(&two_kappa[2 * xs], &psi[xs * 24 + a], &psi[(xs + 1) * 24 + a]);
+        caxpyHalf(&corner[2 * xs], &psi[xs * 24 + b], last + b);
       }
-      for (int tmp_s = 0; tmp_s < Ls; tmp_s++) Ftr[tmp_s] *= 2.0 * kappa[tmp_s];
-    }
-    for (int xs = 0; xs < Ls; xs++) Ftr[xs] = -cpow(2.0 * kappa[xs], Ls - 1) * mferm * inv_Ftr[xs];
 
-    // s = ls-2 ... 0
-    for (int xs = Ls - 2; xs >= 0; --xs) {
-      for (int i = 0; i < Vh; i++) {
-        axpy((2.0 * kappa[xs]), (sComplex *)&res[24 * (i + Vh * (xs + 1))], (sComplex *)&res[24 * (i + Vh * xs)], 6);
-        axpy(Ftr[xs], (sComplex *)&res[12 + 24 * (i + Vh * (Ls - 1))], (sComplex *)&res[12 + 24 * (i + Vh * xs)], 6);
+      // s = ls-2 ... 0
+      for (int xs = L - 2; xs >= 0; --xs) {
+        caxpyHalf(&corner[2 * xs], last + a, &psi[xs * 24 + a]);
+        caxpyHalf(&two_kappa[2 * xs], &psi[(xs + 1) * 24 + b], &psi[xs * 24 + b]);
       }
-      for (int tmp_s = 0; tmp_s < Ls; tmp_s++) Ftr[tmp_s] /= 2.0 * kappa[tmp_s];
-    }
-    // s = ls -1
-    for (int i = 0; i < Vh; i++) {
-      ax((sComplex *)&res[12 + 24 * (i + Vh * (Ls - 1))], inv_Ftr[Ls - 1],
-          (sComplex *)&res[12 + 24 * (i + Vh * (Ls - 1))], 6);
+
+      // s = ls-1
+      caxHalf(&inv_Ftr[2 * (L - 1)], last + a);
+
+      for (int xs = 0; xs < L; xs++)
+        for (int j = 0; j < 24; j++) res[24 * (i + Vh * xs) + j] = psi[xs * 24 + j];
     }
   }
-  free(inv_Ftr);
-  free(Ftr);
+}
+
+//Currently we consider only spacetime decomposition (not in 5th dim), so this operator is local
+template <typename sFloat>
+void dslashReference_5th_inv(sFloat *res, sFloat *spinorField, int oddBit, int daggerBit, sFloat mferm, double *kappa)
+{
+  std::vector<std::complex<double>> kappa_(kappa, kappa + Ls);
+  applyM5Inv(res, spinorField, daggerBit, m5InvCoeff(mferm, kappa_.data()));
+}
+
+// Currently we consider only spacetime decomposition (not in 5th dim), so this operator is local
+template <typename sFloat>
+void mdslashReference_5th_inv(sFloat *res, sFloat *spinorField, int oddBit, int daggerBit, sFloat mferm,
+                              double _Complex *kappa)
+{
+  applyM5Inv(res, spinorField, daggerBit, m5InvCoeff(mferm, reinterpret_cast<std::complex<double> *>(kappa)));
 }
 
 // this actually applies the preconditioned dslash, e.g., D_ee^{-1} D_eo or D_oo^{-1} D_oe
@@ -1,6 +1,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <algorithm>
 
 #include <quda.h>
 #include "test_util.h"
@@ -273,6 +274,52 @@ static void hisq_force_init()
 
 }
 
+/**
+   @brief Store the completed force of the interior sites into a
+   MILC-ordered momentum field, projecting each link onto the
+   traceless anti-hermitian part as updateMomentum does on the device
+   with a zero initial momentum
+*/
+template <typename Float> static void forceToMom(cpuGaugeField &mom, const cpuGaugeField &force)
+{
+  const int *X = mom.X();
+  const int *E = force.X();
+  const int *r = force.R();
+  Float *m = static_cast<Float *>(mom.Gauge_p());
+  const Float *const *f = static_cast<const Float *const *>(force.Gauge_p());
+  const int volumeCB = mom.VolumeCB();
+
+  for (int parity = 0; parity < 2; parity++) {
+    for (int x_cb = 0; x_cb < volumeCB; x_cb++) {
+      int za = x_cb / (X[0] / 2);
+      int x0h = x_cb - za * (X[0] / 2);
+      int zb = za / X[1];
+      int x1 = za - zb * X[1];
+      int x3 = zb / X[2];
+      int x2 = zb - x3 * X[2];
+      int x0 = 2 * x0h + ((x1 + x2 + x3 + parity) & 1);
+      int e_cb = ((((x3 + r[3]) * E[2] + x2 + r[2]) * E[1] + x1 + r[1]) * E[0] + x0 + r[0]) >> 1;
+
+      for (int dir = 0; dir < 4; dir++) {
+        const Float *a = f[dir] + (parity * force.VolumeCB() + e_cb) * gaugeSiteSize;
+        Float *p = m + ((parity * volumeCB + x_cb) * 4 + dir) * momSiteSize;
+        // element (i,j) of the link is at a[(3*i + j)*2 + {0,1}]
+        p[0] = (a[2] - a[6]) * 0.5;
+        p[1] = (a[3] + a[7]) * 0.5;
+        p[2] = (a[4] - a[12]) * 0.5;
+        p[3] = (a[5] + a[13]) * 0.5;
+        p[4] = (a[10] - a[14]) * 0.5;
+        p[5] = (a[11] + a[15]) * 0.5;
+        Float trace = (a[1] + a[9] + a[17]) / 3.0;
+        p[6] = a[1] - trace;
+        p[7] = a[9] - trace;
+        p[8] = a[17] - trace;
+        p[9] = 0.0;
+      }
+    }
+  }
+}
+
 static void hisq_force_end()
 {
   delete cudaMom;
@@ -385,6 +432,28 @@ static int hisq_force_test(void)
 
     accuracy_level = strong_check_mom(cpuMom->Gauge_p(), refMom->Gauge_p(), 4*cpuMom->Volume(), qudaGaugeParam.cpu_prec);
     printfQuda("Test %s\n",(1 == res) ? "PASSED" : "FAILED");
+
+    // repeat with the threaded host implementation on the host-ordered fields
+    GaugeFieldParam hostForceParam(*cpuForce_ex);
+    hostForceParam.create = QUDA_ZERO_FIELD_CREATE;
+    cpuGaugeField hostForce_ex(hostForceParam);
+    GaugeFieldParam hostMomParam(*refMom);
+    hostMomParam.create = QUDA_ZERO_FIELD_CREATE;
+    cpuGaugeField hostMom(hostMomParam);
+
+    gettimeofday(&ht0, NULL);
+    fermion_force::hisqStaplesForce(hostForce_ex, *cpuOprod_ex, *cpuGauge_ex, d_act_path_coeff);
+    fermion_force::hisqLongLinkForce(hostForce_ex, *cpuLongLinkOprod_ex, *cpuGauge_ex, d_act_path_coeff[1]);
+    fermion_force::hisqCompleteForce(hostForce_ex, *cpuGauge_ex);
+    gettimeofday(&ht1, NULL);
+    printfQuda("Host time (QUDA host fermion force) : %g ms\n", TDIFF(ht0, ht1)*1000);
+
+    if (qudaGaugeParam.cpu_prec == QUDA_DOUBLE_PRECISION) forceToMom<double>(hostMom, hostForce_ex);
+    else forceToMom<float>(hostMom, hostForce_ex);
+
+    res = compare_floats(hostMom.Gauge_p(), refMom->Gauge_p(), 4*hostMom.Volume()*momSiteSize, 1e-5, qudaGaugeParam.cpu_prec);
+    accuracy_level = std::min(accuracy_level, strong_check_mom(hostMom.Gauge_p(), refMom->Gauge_p(), 4*hostMom.Volume(), qudaGaugeParam.cpu_prec));
+    printfQuda("Host test %s\n",(1 == res) ? "PASSED" : "FAILED");
   }
   double total_io;
   double total_flops;
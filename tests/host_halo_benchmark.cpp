@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <color_spinor_field.h>
+#include <util_quda.h>
+
+#include <test_util.h>
+#include <test_params.h>
+#include <misc.h>
+
+/**
+   Benchmark of the halo exchange of host (cpuColorSpinorField)
+   fields, as used by the host reference operators and host MG
+   levels.  For a set of field types and halo depths we time
+
+     - "exchange": a blocking exchangeGhost
+     - "work":     a stand-in for the interior of a host stencil, a
+                   few streaming passes over the field
+     - "overlap":  exchangeGhostStart, the same work, then
+                   exchangeGhostWait
+
+   and report the halo bandwidth and the fraction of the exchange
+   hidden behind the work.  Each rank's field is filled with a known
+   pattern that depends on the rank, so the halos received by both
+   exchanges are checked against the faces packed locally from copies
+   of the neighbouring ranks' fields.
+
+   Usage: mpirun -np <n> host_halo_benchmark --dim X Y Z T --gridsize X Y Z T --niter <n>
+*/
+
+using namespace quda;
+
+struct HaloConfig {
+  const char *name;
+  int nColor;
+  int nSpin;
+  int nFace;
+};
+
+// number of streaming passes over the field standing in for the interior stencil
+static constexpr int work_passes = 8;
+
+template <typename Float> static void interiorWork(cpuColorSpinorField &field)
+{
+  Float *v = static_cast<Float *>(field.V());
+  const size_t length = field.Length();
+  for (int pass = 0; pass < work_passes; pass++) {
+#pragma omp parallel for
+    for (size_t i = 0; i < length; i++) v[i] = static_cast<Float>(0.5) * v[i] + static_cast<Float>(0.25);
+  }
+}
+
+static void work(cpuColorSpinorField &field)
+{
+  if (field.Precision() == QUDA_DOUBLE_PRECISION) interiorWork<double>(field);
+  else interiorWork<float>(field);
+}
+
+template <typename Op> static double time_op(Op &&op)
+{
+  op(); // warm up, and declare the persistent message handles
+  comm_barrier();
+  stopwatchStart();
+  for (int i = 0; i < niter; i++) op();
+  double time = stopwatchReadSeconds() / niter;
+  comm_allreduce_max(&time);
+  return time;
+}
+
+template <typename Float> static void fillRankPattern(cpuColorSpinorField &field, int rank)
+{
+  Float *v = static_cast<Float *>(field.V());
+  const size_t length = field.Length();
+#pragma omp parallel for
+  for (size_t i = 0; i < length; i++) v[i] = static_cast<Float>(((7919 * static_cast<size_t>(rank) + i) % 65521) / 65521.0);
+}
+
+// fill a field with a pattern that identifies the rank it is taken to belong to
+static void fillRankPattern(cpuColorSpinorField &field, int rank)
+{
+  if (field.Precision() == QUDA_DOUBLE_PRECISION) fillRankPattern<double>(field, rank);
+  else fillRankPattern<float>(field, rank);
+}
+
+// bytes of the halo of a partitioned dimension in each direction
+static size_t haloBytes(const cpuColorSpinorField &field, int nFace, int d)
+{
+  return field.SiteSubset() * nFace * field.SurfaceCB(d) * 2 * field.Ncolor() * field.Nspin() * field.Precision();
+}
+
+// copy of the received halos of every partitioned dimension
+static std::vector<char> haloCopy(const cpuColorSpinorField &field, int nFace)
+{
+  std::vector<char> halo;
+  for (int d = 0; d < 4; d++) {
+    if (!comm_dim_partitioned(d)) continue;
+    size_t bytes = haloBytes(field, nFace, d);
+    const char *back = static_cast<const char *>(cpuColorSpinorField::backGhostFaceBuffer[d]);
+    const char *fwd = static_cast<const char *>(cpuColorSpinorField::fwdGhostFaceBuffer[d]);
+    halo.insert(halo.end(), back, back + bytes);
+    halo.insert(halo.end(), fwd, fwd + bytes);
+  }
+  return halo;
+}
+
+/**
+   The halos that should be received, in the order of haloCopy: the
+   backward halo is the forward face of the backward neighbour, and
+   the forward halo is the backward face of the forward neighbour.
+   These are packed locally from a copy of each neighbour's field, so
+   do not depend on the exchange.
+*/
+static std::vector<char> haloReference(const cpuColorSpinorField &field, QudaParity parity, int nFace)
+{
+  ColorSpinorParam param(field);
+  param.create = QUDA_NULL_FIELD_CREATE;
+  cpuColorSpinorField neighbour(param);
+
+  std::vector<std::vector<char>> face(2 * QUDA_MAX_DIM);
+  void *face_ptr[2 * QUDA_MAX_DIM];
+  for (int d = 0; d < 4; d++) {
+    for (int dir = 0; dir < 2; dir++) {
+      face[2 * d + dir].resize(std::max(haloBytes(field, nFace, d), static_cast<size_t>(1)));
+      face_ptr[2 * d + dir] = face[2 * d + dir].data();
+    }
+  }
+
+  std::vector<char> halo;
+  for (int d = 0; d < 4; d++) {
+    if (!comm_dim_partitioned(d)) continue;
+    const size_t bytes = haloBytes(field, nFace, d);
+
+    fillRankPattern(neighbour, comm_neighbor_rank(0, d));
+    neighbour.packGhost(face_ptr, parity, nFace, 0);
+    halo.insert(halo.end(), face[2 * d + 1].begin(), face[2 * d + 1].begin() + bytes);
+
+    fillRankPattern(neighbour, comm_neighbor_rank(1, d));
+    neighbour.packGhost(face_ptr, parity, nFace, 0);
+    halo.insert(halo.end(), face[2 * d + 0].begin(), face[2 * d + 0].begin() + bytes);
+  }
+  return halo;
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  setVerbosity(verbosity);
+
+  printfQuda("Host halo exchange benchmark on %dx%dx%dx%d local volume, %d processes, %d iterations\n", xdim, ydim,
+             zdim, tdim, comm_size(), niter);
+  printfQuda("(time per exchange in microseconds, bandwidth is bytes sent plus received per process)\n");
+  printfQuda("%20s %6s %6s %12s %12s %12s %10s %8s %8s\n", "field", "nFace", "prec", "exchange", "work", "overlap",
+             "GB/s", "hidden", "check");
+
+  const HaloConfig configs[] = {{"naive staggered", 3, 1, 1},
+                                {"improved staggered", 3, 1, 3},
+                                {"wilson", 3, 4, 1},
+                                {"coarse (24 colors)", 24, 2, 1}};
+
+  int failures = 0;
+  for (auto &config : configs) {
+    for (auto precision : {QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION}) {
+      ColorSpinorParam param;
+      param.nColor = config.nColor;
+      param.nSpin = config.nSpin;
+      param.nDim = 4;
+      for (int d = 0; d < 4; d++) param.x[d] = dim[d];
+      param.x[0] /= 2;
+      param.pad = 0;
+      param.siteSubset = QUDA_PARITY_SITE_SUBSET;
+      param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+      param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+      param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+      param.create = QUDA_ZERO_FIELD_CREATE;
+      param.location = QUDA_CPU_FIELD_LOCATION;
+      param.setPrecision(precision);
+
+      cpuColorSpinorField in(param);
+      cpuColorSpinorField out(param);
+      fillRankPattern(in, comm_rank());
+
+      const int nFace = config.nFace;
+      auto exchange = [&]() { in.exchangeGhost(QUDA_EVEN_PARITY, nFace, 0); };
+      auto overlap = [&]() {
+        in.exchangeGhostStart(QUDA_EVEN_PARITY, nFace, 0);
+        work(out);
+        in.exchangeGhostWait();
+      };
+
+      const std::vector<char> ref = haloReference(in, QUDA_EVEN_PARITY, nFace);
+
+      double t_exchange = time_op(exchange);
+      int mismatch = haloCopy(in, nFace) == ref ? 0 : 1;
+      double t_work = time_op([&]() { work(out); });
+      double t_overlap = time_op(overlap);
+      std::vector<char> halo = haloCopy(in, nFace);
+
+      if (halo != ref) mismatch = 1;
+      comm_allreduce_int(&mismatch);
+      failures += mismatch;
+
+      double bytes = 2.0 * halo.size(); // sent and received
+      double hidden = std::min(t_exchange, t_work) > 0.0 ?
+        std::max(0.0, std::min(1.0, (t_exchange + t_work - t_overlap) / std::min(t_exchange, t_work))) :
+        0.0;
+
+      printfQuda("%20s %6d %6s %12.2f %12.2f %12.2f %10.2f %7.0f%% %8s\n", config.name, nFace,
+                 get_prec_str(precision), 1e6 * t_exchange, 1e6 * t_work, 1e6 * t_overlap,
+                 t_exchange > 0.0 ? bytes / (1e9 * t_exchange) : 0.0, 100.0 * hidden, mismatch ? "fail" : "pass");
+    }
+  }
+
+  cpuColorSpinorField::freeGhostBuffer();
+  finalizeComms();
+
+  return failures ? 1 : 0;
+}
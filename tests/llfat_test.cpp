@@ -12,6 +12,8 @@
 #include "misc.h"
 #include "util_quda.h"
 #include "malloc_quda.h"
+#include <gauge_field.h>
+#include <llfat_quda.h>
 
 #ifdef MULTI_GPU
 #include "comm_quda.h"
@@ -25,7 +27,7 @@ static QudaGaugeFieldOrder gauge_order = QUDA_MILC_GAUGE_ORDER;
 
 static size_t gSize;
 
-static void llfat_test()
+static int llfat_test()
 {
 
   QudaGaugeParam qudaGaugeParam;
@@ -255,6 +257,7 @@ static void llfat_test()
     }
   }
 
+  int test_rc = 1;
   if (verify_results) {
     printfQuda("Checking fat links...\n");
     int res=1;
@@ -267,6 +270,7 @@ static void llfat_test()
 		      V, qudaGaugeParam.cpu_prec);
     
     printfQuda("Fat-link test %s\n\n",(1 == res) ? "PASSED" : "FAILED");
+    test_rc &= res;
 
     printfQuda("Checking long links...\n");
     res = 1;
@@ -279,6 +283,61 @@ static void llfat_test()
 		      V, qudaGaugeParam.cpu_prec);
       
     printfQuda("Long-link test %s\n\n",(1 == res) ? "PASSED" : "FAILED");
+    test_rc &= res;
+
+    // repeat with the threaded host implementation, writing into
+    // separate zeroed QDP-ordered result arrays
+    QudaGaugeParam host_param = qudaGaugeParam;
+    host_param.gauge_order = QUDA_QDP_GAUGE_ORDER;
+    quda::GaugeFieldParam gParam(sitelink, host_param);
+    quda::cpuGaugeField cpuLink(gParam);
+
+    int R[4];
+    for (int d = 0; d < 4; d++) R[d] = 2 * dimPartitioned(d);
+    gParam.create = QUDA_NULL_FIELD_CREATE;
+    gParam.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+    for (int d = 0; d < 4; d++) {
+      gParam.x[d] += 2 * R[d];
+      gParam.r[d] = R[d];
+    }
+    quda::cpuGaugeField cpuLinkEx(gParam);
+    quda::copyExtendedGauge(cpuLinkEx, cpuLink, QUDA_CPU_FIELD_LOCATION);
+    cpuLinkEx.exchangeExtendedGhost(R);
+
+    void *hostfatlink[4];
+    void *hostlonglink[4];
+    for (int i = 0; i < 4; i++) {
+      hostfatlink[i] = safe_malloc(V * gaugeSiteSize * gSize);
+      hostlonglink[i] = safe_malloc(V * gaugeSiteSize * gSize);
+      memset(hostfatlink[i], 0, V * gaugeSiteSize * gSize);
+      memset(hostlonglink[i], 0, V * gaugeSiteSize * gSize);
+    }
+
+    quda::GaugeFieldParam fatParam(hostfatlink, host_param, QUDA_GENERAL_LINKS);
+    quda::cpuGaugeField cpuFatLink(fatParam);
+    fatParam.gauge = hostlonglink;
+    quda::cpuGaugeField cpuLongLink(fatParam);
+
+    gettimeofday(&t0, NULL);
+    quda::fatLongKSLink(&cpuFatLink, &cpuLongLink, cpuLinkEx, act_path_coeff);
+    gettimeofday(&t1, NULL);
+    printfQuda("Host link computation time = %.2f ms\n", TDIFF(t0, t1) * 1000);
+
+    res = 1;
+    for (int dir = 0; dir < 4; dir++) {
+      res &= compare_floats(fat_reflink[dir], hostfatlink[dir], V * gaugeSiteSize, 1e-3, qudaGaugeParam.cpu_prec);
+      res &= compare_floats(long_reflink[dir], hostlonglink[dir], V * gaugeSiteSize, 1e-3, qudaGaugeParam.cpu_prec);
+    }
+    printfQuda("Host fat/long-link test %s\n\n", (1 == res) ? "PASSED" : "FAILED");
+    test_rc &= res;
+
+    for (int i = 0; i < 4; i++) {
+      host_free(hostfatlink[i]);
+      host_free(hostlonglink[i]);
+    }
+
+    comm_allreduce_int(&test_rc);
+    test_rc /= comm_size();
   }
 
   int volume = qudaGaugeParam.X[0]*qudaGaugeParam.X[1]*qudaGaugeParam.X[2]*qudaGaugeParam.X[3];
@@ -319,6 +378,8 @@ static void llfat_test()
   exchange_llfat_cleanup();
 #endif
   endQuda();
+
+  return test_rc;
 }
 
 static void display_test_info()
@@ -368,8 +429,10 @@ int main(int argc, char **argv)
 
   initComms(argc, argv, gridsize_from_cmdline);
   display_test_info();
-  llfat_test();
+  int test_rc = llfat_test();
   finalizeComms();
+
+  return (test_rc == 1) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 
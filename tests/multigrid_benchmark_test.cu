@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+
+#include <algorithm>
 
 #include <quda_internal.h>
 #include <color_spinor_field.h>
@@ -12,6 +15,8 @@
 // include because of nasty globals used in the tests
 #include <dslash_util.h>
 #include <dirac_quda.h>
+#include <transfer.h>
+#include <multigrid.h>
 
 #define MAX(a,b) ((a)>(b)?(a):(b))
 
@@ -48,6 +53,9 @@ display_test_info()
 
 void initFields(QudaPrecision prec)
 {
+  // host fields only support double and single precision
+  QudaPrecision host_prec = prec == QUDA_DOUBLE_PRECISION ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION;
+
   ColorSpinorParam param;
   param.nColor = Ncolor;
   param.nSpin = Nspin;
@@ -64,7 +72,7 @@ void initFields(QudaPrecision prec)
 
   param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
   param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
-  param.setPrecision(QUDA_DOUBLE_PRECISION);
+  param.setPrecision(host_prec);
   param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
 
   param.create = QUDA_ZERO_FIELD_CREATE;
@@ -103,7 +111,7 @@ void initFields(QudaPrecision prec)
   gParam.link_type = QUDA_COARSE_LINKS;
   gParam.t_boundary = QUDA_PERIODIC_T;
   gParam.create = QUDA_ZERO_FIELD_CREATE;
-  gParam.setPrecision(param.Precision());
+  gParam.setPrecision(host_prec);
   gParam.nDim = 4;
   gParam.siteSubset = QUDA_FULL_SITE_SUBSET;
   gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
@@ -169,22 +177,26 @@ void freeFields()
 
 DiracCoarse *dirac;
 
-double benchmark(int test, const int niter) {
+double benchmark(int test, const int niter, bool host) {
+
+  ColorSpinorField &x = host ? *xH : *xD;
+  ColorSpinorField &y = host ? *yH : *yD;
 
   cudaEvent_t start, end;
   cudaEventCreate(&start);
   cudaEventCreate(&end);
   cudaEventRecord(start, 0);
+  stopwatchStart();
 
   switch(test) {
   case 0:
-    for (int i=0; i < niter; ++i) dirac->Dslash(xD->Even(), yD->Odd(), QUDA_EVEN_PARITY);
+    for (int i=0; i < niter; ++i) dirac->Dslash(x.Even(), y.Odd(), QUDA_EVEN_PARITY);
     break;
   case 1:
-    for (int i=0; i < niter; ++i) dirac->M(*xD, *yD);
+    for (int i=0; i < niter; ++i) dirac->M(x, y);
     break;
   case 2:
-    for (int i=0; i < niter; ++i) dirac->Clover(xD->Even(), yD->Even(), QUDA_EVEN_PARITY);
+    for (int i=0; i < niter; ++i) dirac->Clover(x.Even(), y.Even(), QUDA_EVEN_PARITY);
     break;
   default:
     errorQuda("Undefined test %d", test);
@@ -192,16 +204,121 @@ double benchmark(int test, const int niter) {
 
   cudaEventRecord(end, 0);
   cudaEventSynchronize(end);
+  double host_secs = stopwatchReadSeconds();
   float runTime;
   cudaEventElapsedTime(&runTime, start, end);
   cudaEventDestroy(start);
   cudaEventDestroy(end);
 
-  double secs = runTime / 1000;
+  // the host operator runs synchronously, so time it on the host
+  double secs = host ? host_secs : runTime / 1000;
   return secs;
 }
 
 
+// relative L2 deviation between two host coarse link fields in QDP order
+template <typename Float> double coarseDeviation(const cpuGaugeField &a, const cpuGaugeField &b)
+{
+  const Float *const *a_p = static_cast<const Float *const *>(a.Gauge_p());
+  const Float *const *b_p = static_cast<const Float *const *>(b.Gauge_p());
+  const size_t length = static_cast<size_t>(a.Volume()) * a.Ncolor() * a.Ncolor() * 2;
+
+  double diff = 0.0, norm = 0.0;
+  for (int d = 0; d < a.Geometry(); d++) {
+    for (size_t i = 0; i < length; i++) {
+      diff += (static_cast<double>(a_p[d][i]) - b_p[d][i]) * (static_cast<double>(a_p[d][i]) - b_p[d][i]);
+      norm += static_cast<double>(a_p[d][i]) * a_p[d][i];
+    }
+  }
+  comm_allreduce(&diff);
+  comm_allreduce(&norm);
+  return norm > 0.0 ? sqrt(diff / norm) : sqrt(diff);
+}
+
+// time the host construction of the next coarser operator from this
+// coarse operator, e.g., the setup_location=CPU path of the multigrid
+// setup.  If deviation is set, the operator is also constructed with
+// the unfused UV and VUV computations and the relative deviation of
+// the fused from the unfused operator is returned through it.
+double benchmarkCoarseOp(const int niter, double *deviation = nullptr)
+{
+  QudaPrecision host_prec = prec == QUDA_DOUBLE_PRECISION ? QUDA_DOUBLE_PRECISION : QUDA_SINGLE_PRECISION;
+  const int n_vec = nvec[1] == 0 ? 24 : nvec[1];
+  int geo_bs[QUDA_MAX_DIM] = { };
+  for (int d = 0; d < 4; d++) geo_bs[d] = geo_block_size[1][d] ? geo_block_size[1][d] : 2;
+
+  ColorSpinorParam param;
+  param.nColor = Ncolor;
+  param.nSpin = Nspin;
+  param.nDim = 4;
+  param.pad = 0;
+  param.siteSubset = QUDA_FULL_SITE_SUBSET;
+  param.x[0] = xdim;
+  param.x[1] = ydim;
+  param.x[2] = zdim;
+  param.x[3] = tdim;
+  param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+  param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+  param.setPrecision(host_prec);
+  param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+
+  std::vector<ColorSpinorField *> B(n_vec);
+  for (auto &b : B) {
+    b = new cpuColorSpinorField(param);
+    static_cast<cpuColorSpinorField *>(b)->Source(QUDA_RANDOM_SOURCE);
+  }
+
+  TimeProfile profile("benchmarkCoarseOp");
+  Transfer T(B, n_vec, n_block_ortho[1] ? n_block_ortho[1] : 1, geo_bs, 1, host_prec, profile);
+
+  GaugeFieldParam gParam;
+  for (int d = 0; d < 4; d++) gParam.x[d] = param.x[d] / geo_bs[d];
+  gParam.nColor = n_vec * Nspin;
+  gParam.reconstruct = QUDA_RECONSTRUCT_NO;
+  gParam.order = QUDA_QDP_GAUGE_ORDER;
+  gParam.link_type = QUDA_COARSE_LINKS;
+  gParam.t_boundary = QUDA_PERIODIC_T;
+  gParam.create = QUDA_ZERO_FIELD_CREATE;
+  gParam.setPrecision(host_prec);
+  gParam.nDim = 4;
+  gParam.siteSubset = QUDA_FULL_SITE_SUBSET;
+  gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
+  gParam.nFace = 1;
+  gParam.geometry = QUDA_COARSE_GEOMETRY;
+  cpuGaugeField Yc(gParam);
+
+  gParam.geometry = QUDA_SCALAR_GEOMETRY;
+  gParam.nFace = 0;
+  cpuGaugeField Xc(gParam);
+
+  stopwatchStart();
+  for (int i = 0; i < niter; ++i) dirac->createCoarseOp(Yc, Xc, T, 0.1, 0.0, 0.0, 1.0);
+  double secs = stopwatchReadSeconds();
+
+  if (deviation) {
+    gParam.geometry = QUDA_COARSE_GEOMETRY;
+    gParam.nFace = 1;
+    cpuGaugeField Yu(gParam);
+
+    gParam.geometry = QUDA_SCALAR_GEOMETRY;
+    gParam.nFace = 0;
+    cpuGaugeField Xu(gParam);
+
+    setCoarseOpFused(false);
+    dirac->createCoarseOp(Yu, Xu, T, 0.1, 0.0, 0.0, 1.0);
+    setCoarseOpFused(true);
+
+    if (host_prec == QUDA_DOUBLE_PRECISION)
+      *deviation = std::max(coarseDeviation<double>(Yc, Yu), coarseDeviation<double>(Xc, Xu));
+    else
+      *deviation = std::max(coarseDeviation<float>(Yc, Yu), coarseDeviation<float>(Xc, Xu));
+  }
+
+  for (auto &b : B) delete b;
+  return secs / niter;
+}
+
 const char *names[] = {
   "Dslash",
   "Mat",
@@ -238,6 +355,8 @@ int main(int argc, char** argv)
 
   Nspin = 2;
 
+  int test_rc = EXIT_SUCCESS;
+
   printfQuda("\nBenchmarking %s precision with %d iterations...\n\n", get_prec_str(prec), niter);
   for (int c=24; c<=32; c+=8) {
     Ncolor = c;
@@ -248,16 +367,32 @@ int main(int argc, char** argv)
     param.halo_precision = smoother_halo_prec;
     dirac = new DiracCoarse(param, Y_h, X_h, Xinv_h, Yhat_h, Y_d, X_d, Xinv_d, Yhat_d);
 
-    // do the initial tune
-    benchmark(test_type, 1);
+    for (bool host : {false, true}) {
+      // do the initial tune
+      benchmark(test_type, 1, host);
+
+      // now rerun with more iterations to get accurate speed measurements
+      dirac->Flops(); // reset flops counter
+
+      double secs = benchmark(test_type, niter, host);
+      double gflops = (dirac->Flops()*1e-9)/(secs);
 
-    // now rerun with more iterations to get accurate speed measurements
-    dirac->Flops(); // reset flops counter
+      printfQuda("Ncolor = %2d, Nsrc = %2d, %-6s %-24s: Gflop/s = %6.1f\n", Ncolor, Nsrc, host ? "(CPU)" : "(GPU)",
+                 names[test_type], gflops);
+    }
 
-    double secs = benchmark(test_type, niter);
-    double gflops = (dirac->Flops()*1e-9)/(secs);
+    {
+      // warm up and check the fused host operator against the unfused one
+      double deviation = 0.0;
+      benchmarkCoarseOp(1, &deviation);
+      const double tol = prec == QUDA_DOUBLE_PRECISION ? 1e-10 : 1e-5;
+      printfQuda("Ncolor = %2d, %-6s %-24s: fused vs unfused deviation = %e, %s\n", Ncolor, "(CPU)", "CoarseOp",
+                 deviation, deviation <= tol ? "PASSED" : "FAILED");
+      if (!(deviation <= tol)) test_rc = EXIT_FAILURE;
 
-    printfQuda("Ncolor = %2d, %-31s: Gflop/s = %6.1f\n", Ncolor, names[test_type], gflops);
+      double secs = benchmarkCoarseOp(niter > 10 ? 10 : niter);
+      printfQuda("Ncolor = %2d, %-6s %-24s: time = %8.4f s\n", Ncolor, "(CPU)", "CoarseOp", secs);
+    }
 
     delete dirac;
     freeFields();
@@ -269,4 +404,5 @@ int main(int argc, char** argv)
   endQuda();
 
   finalizeComms();
+  return test_rc;
 }
@@ -21,6 +21,11 @@
 // In a typical application, quda.h is the only QUDA header required.
 #include <quda.h>
 
+// for verifying the host plaquette
+#include <comm_quda.h>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
 
 QudaPrecision cpu_prec = QUDA_DOUBLE_PRECISION;
@@ -61,6 +66,28 @@ void setGaugeParam(QudaGaugeParam &gauge_param)
 #endif
 }
 
+/**
+   Create a copy of the QDP-ordered host gauge field, extended by R
+   in each dimension with the halos filled, upon which the host
+   plaquette is computed.
+*/
+quda::cpuGaugeField *createExtendedHostGauge(void **gauge, QudaGaugeParam &gauge_param, const int *R)
+{
+  quda::GaugeFieldParam param(gauge, gauge_param);
+  quda::cpuGaugeField in(param);
+
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+  for (int d = 0; d < 4; d++) {
+    param.x[d] += 2 * R[d];
+    param.r[d] = R[d];
+  }
+  auto *out = new quda::cpuGaugeField(param);
+  quda::copyExtendedGauge(*out, in, QUDA_CPU_FIELD_LOCATION);
+  out->exchangeExtendedGhost(R);
+  return out;
+}
+
 int main(int argc, char **argv)
 {
 
@@ -112,6 +139,25 @@ int main(int argc, char **argv)
   printfQuda("Computed plaquette gauge precise is %16.15e (spatial = %16.15e, temporal = %16.15e)\n", plaq[0], plaq[1],
              plaq[2]);
 
+  // compute the plaquette on the host from the resident field
+  saveGaugeQuda(gauge, &gauge_param);
+  int R[4];
+  for (int d = 0; d < 4; d++) R[d] = 2 * comm_dim_partitioned(d);
+  quda::cpuGaugeField *host_gauge = createExtendedHostGauge(gauge, gauge_param, R);
+  double3 host_plaq = quda::plaquette(*host_gauge);
+  delete host_gauge;
+
+  printfQuda("Computed host plaquette is %16.15e (spatial = %16.15e, temporal = %16.15e)\n", host_plaq.x, host_plaq.y,
+             host_plaq.z);
+
+  const double tol = prec == QUDA_DOUBLE_PRECISION ? 1e-10 : prec == QUDA_SINGLE_PRECISION ? 1e-5 : 1e-3;
+  double deviation = fabs(host_plaq.x - plaq[0]);
+  deviation = MAX(deviation, fabs(host_plaq.y - plaq[1]));
+  deviation = MAX(deviation, fabs(host_plaq.z - plaq[2]));
+  int test_rc = deviation <= tol ? EXIT_SUCCESS : EXIT_FAILURE;
+  printfQuda("Plaquette deviation: %e, tolerance %e, test %s\n", deviation, tol,
+             test_rc == EXIT_SUCCESS ? "PASSED" : "FAILED");
+
   freeGaugeQuda();
   endQuda();
 
@@ -119,7 +165,7 @@ int main(int argc, char **argv)
   for (int dir = 0; dir < 4; dir++) { free(gauge[dir]); }
 
   finalizeComms();
-  return 0;
+  return test_rc;
 }
 
 
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+#include <mpi.h>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <reproducible_sum.h>
+#include <util_quda.h>
+
+#include <test_util.h>
+#include <test_params.h>
+
+/**
+   Benchmark of the multi-process sum reductions used for global
+   sums.  For each array length we time
+
+     - "mpi":    a plain MPI_Allreduce with MPI_SUM (the
+                 non-deterministic default)
+     - "sort":   the previous deterministic reduction, an
+                 MPI_Allgather of every process's partials followed by a
+                 sorted sum of each element
+     - "binned": comm_allreduce_array with deterministic reductions
+                 enabled, a single MPI_Allreduce of binned accumulators
+
+   and we check that the binned result is bitwise identical to the
+   binned sum of all partials computed serially, i.e., it is
+   independent of the process count and reduction tree.
+
+   Usage: mpirun -np <n> reduce_benchmark --niter <n>
+*/
+
+using namespace quda;
+
+static void sorted_reduce(double *data, size_t size)
+{
+  size_t n = comm_size();
+  std::vector<double> recv_buf(size * n), recv_trans(size * n);
+  MPI_Allgather(data, size, MPI_DOUBLE, recv_buf.data(), size, MPI_DOUBLE, MPI_COMM_WORLD);
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < size; j++) recv_trans[j * n + i] = recv_buf[i * size + j];
+  for (size_t i = 0; i < size; i++) {
+    std::sort(recv_trans.begin() + i * n, recv_trans.begin() + (i + 1) * n);
+    data[i] = std::accumulate(recv_trans.begin() + i * n, recv_trans.begin() + (i + 1) * n, 0.0);
+  }
+}
+
+static void mpi_reduce(double *data, size_t size)
+{
+  std::vector<double> recv_buf(size);
+  MPI_Allreduce(data, recv_buf.data(), size, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  memcpy(data, recv_buf.data(), size * sizeof(double));
+}
+
+// partials of a given rank, spanning a wide range of magnitudes and signs
+static std::vector<double> partials(int rank, size_t size)
+{
+  std::mt19937_64 rng(1234 + rank);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  std::uniform_int_distribution<int> exponent(-20, 20);
+  std::vector<double> v(size);
+  for (auto &x : v) x = std::ldexp(normal(rng), exponent(rng));
+  return v;
+}
+
+template <typename Reduce> static double time_reduce(Reduce &&reduce, const std::vector<double> &in)
+{
+  std::vector<double> data(in);
+  reduce(data.data(), data.size()); // warm up
+  comm_barrier();
+  double start = MPI_Wtime();
+  for (int i = 0; i < niter; i++) {
+    data = in;
+    reduce(data.data(), data.size());
+  }
+  double time = (MPI_Wtime() - start) / niter;
+  comm_allreduce_max(&time);
+  return time;
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  // the deterministic reduction mode is set at initialization
+  setenv("QUDA_DETERMINISTIC_REDUCE", "1", 1);
+  initComms(argc, argv, gridsize_from_cmdline);
+  setVerbosity(verbosity);
+
+  const int n_rank = comm_size();
+  printfQuda("Sum reduction benchmark on %d processes, %d iterations (time per reduction in microseconds)\n", n_rank,
+             niter);
+  printfQuda("%10s %12s %12s %12s %14s\n", "length", "mpi", "sort", "binned", "reproducible");
+
+  int failures = 0;
+  for (size_t size : {1, 16, 256, 4096}) {
+    std::vector<double> in = partials(comm_rank(), size);
+
+    double t_mpi = time_reduce(mpi_reduce, in);
+    double t_sort = time_reduce(sorted_reduce, in);
+    double t_binned = time_reduce(comm_allreduce_array, in);
+
+    // serial reference from the partials of every rank, summed in reverse rank order
+    std::vector<BinnedSum> ref(size);
+    for (int r = n_rank - 1; r >= 0; r--) {
+      std::vector<double> p = partials(r, size);
+      for (size_t i = 0; i < size; i++) ref[i].deposit(p[i]);
+    }
+
+    std::vector<double> data(in);
+    comm_allreduce_array(data.data(), size);
+    int mismatch = 0;
+    for (size_t i = 0; i < size; i++) {
+      double r = ref[i].value();
+      if (memcmp(&r, &data[i], sizeof(double)) != 0) mismatch++;
+    }
+    comm_allreduce_int(&mismatch);
+    failures += mismatch;
+
+    printfQuda("%10lu %12.2f %12.2f %12.2f %14s\n", size, 1e6 * t_mpi, 1e6 * t_sort, 1e6 * t_binned,
+               mismatch ? "no" : "yes");
+  }
+
+  finalizeComms();
+
+  return failures ? 1 : 0;
+}
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <vector>
 
 #include <test_util.h>
 #include <quda_internal.h>
@@ -41,92 +42,252 @@ void display_link_internal(Float* link)
   return;
 }
 
-template <typename sFloat, typename gFloat>
-void dslashReference(sFloat *res, gFloat **fatlink, gFloat **longlink, gFloat **ghostFatlink, gFloat **ghostLonglink,
-    sFloat *spinorField, sFloat **fwd_nbr_spinor, sFloat **back_nbr_spinor, int oddBit, int daggerBit, int nSrc,
-    QudaDslashType dslash_type)
-{
-  for (int i=0; i<Vh*mySpinorSiteSize*nSrc; i++) res[i] = 0.0;
+/**
+   Precomputed 1-hop and 3-hop neighbors of every site of one parity.
+   Entry k = (i * 8 + dir) * 2 + hop holds the buffer and index of the
+   neighboring spinor and of the link connecting to it for the first
+   source, where hop 0 is the fat (1-hop) term and hop 1 the long
+   (3-hop) term.  Spinor buffers are 0 = field, 1 + d = forward ghost,
+   5 + d = backward ghost; link buffers are 0 = this parity, 1 = other
+   parity, 2 + d = ghost.  Successive sources are a stride of Vh apart
+   in the field and faceVolume[d]/2 apart in the ghosts.  Sites are
+   split into interior sites, which read no ghosts, and exterior sites,
+   so that the interior can be computed while the halo is exchanged.
+ */
+struct StaggeredNeighborTable {
+  int X[4];
+  bool partitioned[4];
+  int parity;
+  int nFace;
+  int nSrc;
+  std::vector<int> spinor_idx;
+  std::vector<unsigned char> spinor_buf;
+  std::vector<int> gauge_idx;
+  std::vector<unsigned char> gauge_buf;
+  std::vector<int> interior;
+  std::vector<int> exterior;
+};
 
-  gFloat *fatlinkEven[4], *fatlinkOdd[4];
-  gFloat *longlinkEven[4], *longlinkOdd[4];
+/**
+   Which sites of a parity a dslash should be applied to
+ */
+enum StaggeredSites { STAGGERED_ALL_SITES, STAGGERED_INTERIOR_SITES, STAGGERED_EXTERIOR_SITES };
 
+static bool partitionedDim(int d)
+{
 #ifdef MULTI_GPU
-  gFloat *ghostFatlinkEven[4], *ghostFatlinkOdd[4];
-  gFloat *ghostLonglinkEven[4], *ghostLonglinkOdd[4];
+  return comm_dim_partitioned(d);
+#else
+  return false;
 #endif
+}
 
-  for (int dir = 0; dir < 4; dir++) {
-    fatlinkEven[dir] = fatlink[dir];
-    fatlinkOdd[dir] = fatlink[dir] + Vh*gaugeSiteSize;
-    longlinkEven[dir] =longlink[dir];
-    longlinkOdd[dir] = longlink[dir] + Vh*gaugeSiteSize;
-
-#ifdef MULTI_GPU
-    ghostFatlinkEven[dir] = ghostFatlink[dir];
-    ghostFatlinkOdd[dir] = ghostFatlink[dir] + (faceVolume[dir]/2)*gaugeSiteSize;
-    ghostLonglinkEven[dir] = ghostLonglink[dir];
-    ghostLonglinkOdd[dir] = ghostLonglink[dir] + 3*(faceVolume[dir]/2)*gaugeSiteSize;
-#endif
+static void buildNeighborTable(StaggeredNeighborTable &table, int parity, int nFace, int nSrc)
+{
+  for (int d = 0; d < 4; d++) {
+    table.X[d] = Z[d];
+    table.partitioned[d] = partitionedDim(d);
   }
+  table.parity = parity;
+  table.nFace = nFace;
+  table.nSrc = nSrc;
+  table.spinor_idx.resize(Vh * 16);
+  table.spinor_buf.resize(Vh * 16);
+  table.gauge_idx.resize(Vh * 16);
+  table.gauge_buf.resize(Vh * 16);
 
-  for (int xs=0; xs<nSrc; xs++) {
+  const int *X = table.X;
 
-    for (int i = 0; i < Vh; i++) {
-      int sid = i + xs*Vh;
-      int offset = mySpinorSiteSize*sid;
+#pragma omp parallel for
+  for (int i = 0; i < Vh; i++) {
+    int Y = fullLatticeIndex(i, parity);
+    int x[4] = {Y % X[0], (Y / X[0]) % X[1], (Y / (X[1] * X[0])) % X[2], Y / (X[2] * X[1] * X[0])};
 
-      for (int dir = 0; dir < 8; dir++) {
-#ifdef MULTI_GPU
-        const int nFace = dslash_type == QUDA_ASQTAD_DSLASH ? 3 : 1;
-        gFloat* fatlnk = gaugeLink_mg4dir(i, dir, oddBit, fatlinkEven, fatlinkOdd, ghostFatlinkEven, ghostFatlinkOdd, 1, 1);
-        gFloat *longlnk = dslash_type == QUDA_ASQTAD_DSLASH ?
-            gaugeLink_mg4dir(i, dir, oddBit, longlinkEven, longlinkOdd, ghostLonglinkEven, ghostLonglinkOdd, 3, 3) :
-            nullptr;
-        sFloat *first_neighbor_spinor = spinorNeighbor_5d_mgpu<QUDA_4D_PC>(
-            sid, dir, oddBit, spinorField, fwd_nbr_spinor, back_nbr_spinor, 1, nFace, mySpinorSiteSize);
-        sFloat *third_neighbor_spinor = dslash_type == QUDA_ASQTAD_DSLASH ?
-            spinorNeighbor_5d_mgpu<QUDA_4D_PC>(
-                sid, dir, oddBit, spinorField, fwd_nbr_spinor, back_nbr_spinor, 3, nFace, mySpinorSiteSize) :
-            nullptr;
-#else
-        gFloat *fatlnk = gaugeLink(i, dir, oddBit, fatlinkEven, fatlinkOdd, 1);
-        gFloat *longlnk
-            = dslash_type == QUDA_ASQTAD_DSLASH ? gaugeLink(i, dir, oddBit, longlinkEven, longlinkOdd, 3) : nullptr;
-        sFloat *first_neighbor_spinor = spinorNeighbor_5d<QUDA_4D_PC>(sid, dir, oddBit, spinorField, 1, mySpinorSiteSize);
-        sFloat *third_neighbor_spinor = dslash_type == QUDA_ASQTAD_DSLASH ?
-            spinorNeighbor_5d<QUDA_4D_PC>(sid, dir, oddBit, spinorField, 3, mySpinorSiteSize) :
-            nullptr;
-#endif
-        sFloat gaugedSpinor[mySpinorSiteSize];
+    for (int d = 0; d < 4; d++) {
+      // checkerboard index on the face orthogonal to dimension d
+      int face = 0;
+      for (int e = 3; e >= 0; e--)
+        if (e != d) face = face * X[e] + x[e];
+      face /= 2;
+      const int face_cb = faceVolume[d] / 2;
 
-        if (dir % 2 == 0){
-          su3Mul(gaugedSpinor, fatlnk, first_neighbor_spinor);
-          sum(&res[offset], &res[offset], gaugedSpinor, mySpinorSiteSize);
+      for (int dir = 0; dir < 2; dir++) { // forwards, backwards
+        for (int hop = 0; hop < 2; hop++) {
+          const int nb = hop == 0 ? 1 : 3;
+          int y[4] = {x[0], x[1], x[2], x[3]};
+          y[d] = dir == 0 ? x[d] + nb : x[d] - nb;
+          const bool halo = (y[d] < 0 || y[d] >= X[d]) && table.partitioned[d];
+          // depth of the neighbor within the ghost zone
+          const int depth = dir == 0 ? y[d] - X[d] : y[d] + nFace;
+          const int gauge_depth = y[d] + nb;
+          y[d] = ((y[d] % X[d]) + X[d]) % X[d];
+          const int nbr = (((y[3] * X[2] + y[2]) * X[1] + y[1]) * X[0] + y[0]) / 2;
 
-          if (dslash_type == QUDA_ASQTAD_DSLASH) {
-            su3Mul(gaugedSpinor, longlnk, third_neighbor_spinor);
-            sum(&res[offset], &res[offset], gaugedSpinor, mySpinorSiteSize);
-          }
-        } else {
-          su3Tmul(gaugedSpinor, fatlnk, first_neighbor_spinor);
-          if (dslash_type == QUDA_LAPLACE_DSLASH) {
-            sum(&res[offset], &res[offset], gaugedSpinor, mySpinorSiteSize);
-          } else {
-            sub(&res[offset], &res[offset], gaugedSpinor, mySpinorSiteSize);
-          }
+          const int k = ((i * 4 + d) * 2 + dir) * 2 + hop;
+          table.spinor_buf[k] = halo ? (dir == 0 ? 1 + d : 5 + d) : 0;
+          table.spinor_idx[k] = halo ? depth * nSrc * face_cb + face : nbr;
 
-          if (dslash_type == QUDA_ASQTAD_DSLASH) {
-            su3Tmul(gaugedSpinor, longlnk, third_neighbor_spinor);
-            sub(&res[offset], &res[offset], gaugedSpinor, mySpinorSiteSize);
+          if (dir == 0) { // forwards link lives on this site
+            table.gauge_buf[k] = 0;
+            table.gauge_idx[k] = i;
+          } else { // backwards link lives on the neighbor
+            table.gauge_buf[k] = halo ? 2 + d : 1;
+            table.gauge_idx[k] = halo ? gauge_depth * face_cb + face : nbr;
           }
         }
       }
+    }
+  }
+
+  // only the 3-hop term reaches past the first face
+  const int nHop = nFace == 3 ? 2 : 1;
+  table.interior.clear();
+  table.exterior.clear();
+  for (int i = 0; i < Vh; i++) {
+    bool halo = false;
+    for (int dir = 0; dir < 8; dir++)
+      for (int hop = 0; hop < nHop; hop++) halo = halo || table.spinor_buf[(i * 8 + dir) * 2 + hop] != 0;
+    (halo ? table.exterior : table.interior).push_back(i);
+  }
+}
+
+/**
+   @return The neighbor table for the current local lattice, parity,
+   ghost depth and number of sources, rebuilding it only if one of
+   these or the partitioning has changed since the last call
+ */
+static const StaggeredNeighborTable &neighborTable(int parity, int nFace, int nSrc)
+{
+  static StaggeredNeighborTable table[2];
+  static bool init[2] = {false, false};
 
-      if (daggerBit) negx(&res[offset], mySpinorSiteSize);
-    } // 4-d volume
-  } // right-hand-side
+  bool rebuild = !init[parity] || table[parity].nFace != nFace || table[parity].nSrc != nSrc;
+  for (int d = 0; d < 4; d++)
+    if (table[parity].X[d] != Z[d] || table[parity].partitioned[d] != partitionedDim(d)) rebuild = true;
 
+  if (rebuild) {
+    buildNeighborTable(table[parity], parity, nFace, nSrc);
+    init[parity] = true;
+  }
+  return table[parity];
+}
+
+// res += sign * U * v for a single color vector
+template <typename sFloat, typename gFloat>
+static inline void linkMulAcc(sFloat *__restrict__ res, const gFloat *__restrict__ U, const sFloat *__restrict__ v,
+                              sFloat sign)
+{
+  for (int n = 0; n < 3; n++) {
+    sFloat re = 0.0, im = 0.0;
+    for (int m = 0; m < 3; m++) {
+      re += U[(n * 3 + m) * 2 + 0] * v[2 * m + 0] - U[(n * 3 + m) * 2 + 1] * v[2 * m + 1];
+      im += U[(n * 3 + m) * 2 + 0] * v[2 * m + 1] + U[(n * 3 + m) * 2 + 1] * v[2 * m + 0];
+    }
+    res[2 * n + 0] += sign * re;
+    res[2 * n + 1] += sign * im;
+  }
+}
+
+// res += sign * U^\dagger * v for a single color vector
+template <typename sFloat, typename gFloat>
+static inline void linkDagMulAcc(sFloat *__restrict__ res, const gFloat *__restrict__ U, const sFloat *__restrict__ v,
+                                 sFloat sign)
+{
+  for (int n = 0; n < 3; n++) {
+    sFloat re = 0.0, im = 0.0;
+    for (int m = 0; m < 3; m++) {
+      re += U[(m * 3 + n) * 2 + 0] * v[2 * m + 0] + U[(m * 3 + n) * 2 + 1] * v[2 * m + 1];
+      im += U[(m * 3 + n) * 2 + 0] * v[2 * m + 1] - U[(m * 3 + n) * 2 + 1] * v[2 * m + 0];
+    }
+    res[2 * n + 0] += sign * re;
+    res[2 * n + 1] += sign * im;
+  }
+}
+
+//
+// dslashReference()
+//
+// if oddBit is zero: calculate even parity spinor elements (using odd parity spinor)
+// if oddBit is one:  calculate odd parity spinor elements
+//
+// if daggerBit is zero: perform ordinary dslash operator
+// if daggerBit is one:  perform hermitian conjugate of dslash
+//
+// The nSrc right-hand sides are stored consecutively (the fifth
+// dimension of the field).  Sites are distributed over threads, and
+// each link is loaded once and applied to every source before moving
+// on to the next direction.  The ghost arguments are only read for
+// partitioned dimensions, and may be null in a single-process run or
+// when only the interior sites are computed.
+//
+template <typename sFloat, typename gFloat>
+void dslashReference(sFloat *res, gFloat **fatlink, gFloat **longlink, gFloat **ghostFatlink, gFloat **ghostLonglink,
+    sFloat *spinorField, sFloat **fwd_nbr_spinor, sFloat **back_nbr_spinor, int oddBit, int daggerBit, int nSrc,
+    QudaDslashType dslash_type, StaggeredSites sites = STAGGERED_ALL_SITES)
+{
+  const bool improved = dslash_type == QUDA_ASQTAD_DSLASH;
+  const int nFace = improved ? 3 : 1;
+  const int nHop = improved ? 2 : 1;
+  const StaggeredNeighborTable &table = neighborTable(oddBit, nFace, nSrc);
+
+  const sFloat *spinor_buf[9] = {spinorField};
+  int spinor_stride[9] = {Vh};
+  const gFloat *gauge_buf[2][6][4] = {};
+  for (int d = 0; d < 4; d++) {
+    if (table.partitioned[d] && sites != STAGGERED_INTERIOR_SITES) {
+      spinor_buf[1 + d] = fwd_nbr_spinor[d];
+      spinor_buf[5 + d] = back_nbr_spinor[d];
+      spinor_stride[1 + d] = spinor_stride[5 + d] = faceVolume[d] / 2;
+    }
+  }
+  for (int dim = 0; dim < 4; dim++) {
+    gauge_buf[0][0][dim] = fatlink[dim] + oddBit * Vh * gaugeSiteSize;
+    gauge_buf[0][1][dim] = fatlink[dim] + (1 - oddBit) * Vh * gaugeSiteSize;
+    if (improved) {
+      gauge_buf[1][0][dim] = longlink[dim] + oddBit * Vh * gaugeSiteSize;
+      gauge_buf[1][1][dim] = longlink[dim] + (1 - oddBit) * Vh * gaugeSiteSize;
+    }
+    if (table.partitioned[dim] && sites != STAGGERED_INTERIOR_SITES) {
+      gauge_buf[0][2 + dim][dim] = ghostFatlink[dim] + (1 - oddBit) * (faceVolume[dim] / 2) * gaugeSiteSize;
+      if (improved)
+        gauge_buf[1][2 + dim][dim] = ghostLonglink[dim] + (1 - oddBit) * 3 * (faceVolume[dim] / 2) * gaugeSiteSize;
+    }
+  }
+
+  // sign of the backwards hops: the Laplace operator adds these
+  const sFloat back_sign = dslash_type == QUDA_LAPLACE_DSLASH ? 1.0 : -1.0;
+
+  const int *site_list = sites == STAGGERED_INTERIOR_SITES ? table.interior.data() : table.exterior.data();
+  const int n_site = sites == STAGGERED_ALL_SITES ?
+    Vh :
+    (sites == STAGGERED_INTERIOR_SITES ? table.interior.size() : table.exterior.size());
+
+#pragma omp parallel for
+  for (int s = 0; s < n_site; s++) {
+    const int i = sites == STAGGERED_ALL_SITES ? s : site_list[s];
+    for (int xs = 0; xs < nSrc; xs++)
+      for (int j = 0; j < mySpinorSiteSize; j++) res[(xs * Vh + i) * mySpinorSiteSize + j] = 0.0;
+
+    for (int dir = 0; dir < 8; dir++) {
+      for (int hop = 0; hop < nHop; hop++) {
+        const int k = (i * 8 + dir) * 2 + hop;
+        const int s_buf = table.spinor_buf[k];
+        const sFloat *spinor = spinor_buf[s_buf] + table.spinor_idx[k] * mySpinorSiteSize;
+        const gFloat *gauge = gauge_buf[hop][table.gauge_buf[k]][dir / 2] + table.gauge_idx[k] * gaugeSiteSize;
+        const int stride = spinor_stride[s_buf] * mySpinorSiteSize;
+        const sFloat sign = dir % 2 == 0 ? 1.0 : (hop == 0 ? back_sign : -1.0);
+
+        for (int xs = 0; xs < nSrc; xs++) {
+          sFloat *out = res + (xs * Vh + i) * mySpinorSiteSize;
+          if (dir % 2 == 0) linkMulAcc(out, gauge, spinor + xs * stride, sign);
+          else linkDagMulAcc(out, gauge, spinor + xs * stride, sign);
+        }
+      }
+    }
+
+    if (daggerBit)
+      for (int xs = 0; xs < nSrc; xs++) negx(&res[(xs * Vh + i) * mySpinorSiteSize], mySpinorSiteSize);
+  }
 }
 
 void staggered_dslash(cpuColorSpinorField *out, void **fatlink, void **longlink, void **ghost_fatlink,
@@ -145,32 +306,46 @@ void staggered_dslash(cpuColorSpinorField *out, void **fatlink, void **longlink,
   }
   const int nFace = dslash_type == QUDA_ASQTAD_DSLASH ? 3 : 1;
 
-  in->exchangeGhost(otherparity, nFace, daggerBit);
+  in->exchangeGhostStart(otherparity, nFace, daggerBit);
 
   void** fwd_nbr_spinor = in->fwdGhostFaceBuffer;
   void** back_nbr_spinor = in->backGhostFaceBuffer;
 
-  if (sPrecision == QUDA_DOUBLE_PRECISION) {
-    if (gPrecision == QUDA_DOUBLE_PRECISION) {
-      dslashReference((double *)out->V(), (double **)fatlink, (double **)longlink, (double **)ghost_fatlink,
-          (double **)ghost_longlink, (double *)in->V(), (double **)fwd_nbr_spinor, (double **)back_nbr_spinor, oddBit,
-          daggerBit, nSrc, dslash_type);
-    } else {
-      dslashReference((double *)out->V(), (float **)fatlink, (float **)longlink, (float **)ghost_fatlink,
-          (float **)ghost_longlink, (double *)in->V(), (double **)fwd_nbr_spinor, (double **)back_nbr_spinor, oddBit,
-          daggerBit, nSrc, dslash_type);
+  auto dslash = [&](StaggeredSites sites) {
+    if (sPrecision == QUDA_DOUBLE_PRECISION) {
+      if (gPrecision == QUDA_DOUBLE_PRECISION) {
+        dslashReference((double *)out->V(), (double **)fatlink, (double **)longlink, (double **)ghost_fatlink,
+            (double **)ghost_longlink, (double *)in->V(), (double **)fwd_nbr_spinor, (double **)back_nbr_spinor, oddBit,
+            daggerBit, nSrc, dslash_type, sites);
+      } else {
+        dslashReference((double *)out->V(), (float **)fatlink, (float **)longlink, (float **)ghost_fatlink,
+            (float **)ghost_longlink, (double *)in->V(), (double **)fwd_nbr_spinor, (double **)back_nbr_spinor, oddBit,
+            daggerBit, nSrc, dslash_type, sites);
       }
-  } else {
-    if (gPrecision == QUDA_DOUBLE_PRECISION) {
-      dslashReference((float *)out->V(), (double **)fatlink, (double **)longlink, (double **)ghost_fatlink,
-          (double **)ghost_longlink, (float *)in->V(), (float **)fwd_nbr_spinor, (float **)back_nbr_spinor, oddBit,
-          daggerBit, nSrc, dslash_type);
     } else {
-      dslashReference((float *)out->V(), (float **)fatlink, (float **)longlink, (float **)ghost_fatlink,
-          (float **)ghost_longlink, (float *)in->V(), (float **)fwd_nbr_spinor, (float **)back_nbr_spinor, oddBit,
-          daggerBit, nSrc, dslash_type);
+      if (gPrecision == QUDA_DOUBLE_PRECISION) {
+        dslashReference((float *)out->V(), (double **)fatlink, (double **)longlink, (double **)ghost_fatlink,
+            (double **)ghost_longlink, (float *)in->V(), (float **)fwd_nbr_spinor, (float **)back_nbr_spinor, oddBit,
+            daggerBit, nSrc, dslash_type, sites);
+      } else {
+        dslashReference((float *)out->V(), (float **)fatlink, (float **)longlink, (float **)ghost_fatlink,
+            (float **)ghost_longlink, (float *)in->V(), (float **)fwd_nbr_spinor, (float **)back_nbr_spinor, oddBit,
+            daggerBit, nSrc, dslash_type, sites);
+      }
     }
-  }
+  };
+
+  // compute the interior while the halo is in flight
+  dslash(STAGGERED_INTERIOR_SITES);
+  in->exchangeGhostWait();
+  dslash(STAGGERED_EXTERIOR_SITES);
+}
+
+// out = 4 m^2 in - out, applied in place
+template <typename Float> static void massShift(Float *out, const Float *in, Float msq_x4, size_t length)
+{
+#pragma omp parallel for
+  for (size_t i = 0; i < length; i++) out[i] = msq_x4 * in[i] - out[i];
 }
 
 void matdagmat(cpuColorSpinorField *out, void **fatlink, void **longlink, void **ghost_fatlink, void **ghost_longlink,
@@ -198,10 +373,97 @@ void matdagmat(cpuColorSpinorField *out, void **fatlink, void **longlink, void *
       gPrecision, dslash_type);
 
   double msq_x4 = mass*mass*4;
+  const size_t length = (size_t)out->X(4) * Vh * mySpinorSiteSize;
   if (sPrecision == QUDA_DOUBLE_PRECISION){
-    axmy((double*)in->V(), (double)msq_x4, (double*)out->V(), out->X(4)*Vh*mySpinorSiteSize);
+    massShift((double *)out->V(), (double *)in->V(), (double)msq_x4, length);
   }else{
-    axmy((float*)in->V(), (float)msq_x4, (float*)out->V(), out->X(4)*Vh*mySpinorSiteSize);
+    massShift((float *)out->V(), (float *)in->V(), (float)msq_x4, length);
+  }
+
+}
+
+/**
+   Host storage for the multi-source matdagmat: all sources are
+   gathered into one field whose fifth dimension runs over the
+   sources, so that a single sweep (and a single halo exchange) covers
+   all of them.  The fields reference buffers that are only reallocated
+   when the number of sources or the precision changes.
+ */
+struct MatDagMatWorkspace {
+  int nSrc = 0;
+  QudaPrecision precision = QUDA_INVALID_PRECISION;
+  int X[4] = {};
+  std::vector<double> in_buf, tmp_buf, out_buf;
+  cpuColorSpinorField *in = nullptr;
+  cpuColorSpinorField *tmp = nullptr;
+  cpuColorSpinorField *out = nullptr;
+};
+
+static cpuColorSpinorField *workspaceField(std::vector<double> &buf, const cpuColorSpinorField &src, int nSrc)
+{
+  buf.resize((size_t)nSrc * Vh * mySpinorSiteSize);
+  ColorSpinorParam param(src);
+  param.nDim = 5;
+  param.x[4] = nSrc;
+  param.pad = 0;
+  param.create = QUDA_REFERENCE_FIELD_CREATE;
+  param.v = buf.data();
+  return new cpuColorSpinorField(param);
+}
+
+static MatDagMatWorkspace &matDagMatWorkspace(const cpuColorSpinorField &src, int nSrc)
+{
+  static MatDagMatWorkspace ws;
+
+  bool rebuild = ws.nSrc != nSrc || ws.precision != src.Precision();
+  for (int d = 0; d < 4; d++)
+    if (ws.X[d] != src.X(d)) rebuild = true;
+
+  if (rebuild) {
+    delete ws.in;
+    delete ws.tmp;
+    delete ws.out;
+    ws.in = workspaceField(ws.in_buf, src, nSrc);
+    ws.tmp = workspaceField(ws.tmp_buf, src, nSrc);
+    ws.out = workspaceField(ws.out_buf, src, nSrc);
+    ws.nSrc = nSrc;
+    ws.precision = src.Precision();
+    for (int d = 0; d < 4; d++) ws.X[d] = src.X(d);
+  }
+  return ws;
+}
+
+void matdagmat(std::vector<cpuColorSpinorField *> &out, void **fatlink, void **longlink, void **ghost_fatlink,
+    void **ghost_longlink, const std::vector<cpuColorSpinorField *> &in, double mass, int dagger_bit,
+    QudaPrecision sPrecision, QudaPrecision gPrecision, QudaParity parity, QudaDslashType dslash_type)
+{
+  if (in.size() != out.size()) errorQuda("Number of inputs %lu and outputs %lu do not match", in.size(), out.size());
+  if (in.size() == 0) return;
+
+  int nSrc = 0;
+  for (size_t i = 0; i < in.size(); i++) {
+    if (in[i]->SiteSubset() != QUDA_PARITY_SITE_SUBSET) errorQuda("Only single parity fields are supported");
+    if (in[i]->Precision() != sPrecision || out[i]->Precision() != sPrecision)
+      errorQuda("Field precision does not match %d", sPrecision);
+    if (in[i]->X(4) != out[i]->X(4)) errorQuda("Input %lu and output extents do not match", i);
+    nSrc += in[i]->X(4);
+  }
+
+  MatDagMatWorkspace &ws = matDagMatWorkspace(*in[0], nSrc);
+  const size_t site_bytes = Vh * mySpinorSiteSize * sPrecision;
+
+  char *in_ptr = static_cast<char *>(ws.in->V());
+  for (auto v : in) {
+    memcpy(in_ptr, v->V(), v->X(4) * site_bytes);
+    in_ptr += v->X(4) * site_bytes;
   }
 
+  matdagmat(ws.out, fatlink, longlink, ghost_fatlink, ghost_longlink, ws.in, mass, dagger_bit, sPrecision, gPrecision,
+      ws.tmp, parity, dslash_type);
+
+  const char *out_ptr = static_cast<const char *>(ws.out->V());
+  for (auto v : out) {
+    memcpy(v->V(), out_ptr, v->X(4) * site_bytes);
+    out_ptr += v->X(4) * site_bytes;
+  }
 }
@@ -4,6 +4,7 @@
 #include <blas_reference.h>
 #include <quda_internal.h>
 #include "color_spinor_field.h"
+#include <vector>
 
 extern int Z[4];
 extern int Vh;
@@ -21,4 +22,15 @@ void matdagmat(cpuColorSpinorField *out, void **fatlink, void **longlink, void *
     cpuColorSpinorField *in, double mass, int dagger_bit, QudaPrecision sPrecision, QudaPrecision gPrecision,
     cpuColorSpinorField *tmp, QudaParity parity, QudaDslashType dslash_type);
 
+/**
+   Apply matdagmat to a set of single-parity sources in one sweep.
+   The sources are gathered into a host workspace that is reused
+   between calls, so that every link is loaded once for all of them.
+   @param out The results, one per source, matching in
+   @param in The sources
+ */
+void matdagmat(std::vector<cpuColorSpinorField *> &out, void **fatlink, void **longlink, void **ghost_fatlink,
+    void **ghost_longlink, const std::vector<cpuColorSpinorField *> &in, double mass, int dagger_bit,
+    QudaPrecision sPrecision, QudaPrecision gPrecision, QudaParity parity, QudaDslashType dslash_type);
+
 #endif // _QUDA_DLASH_REF_H
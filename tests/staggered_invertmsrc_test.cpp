@@ -10,6 +10,7 @@
 #include <staggered_dslash_reference.h>
 #include <quda.h>
 #include <string.h>
+#include <vector>
 #include "misc.h"
 #include <gauge_field.h>
 #include <blas_quda.h>
@@ -29,9 +30,7 @@ void *qdp_longlink[4];
 void *fatlink;
 void *longlink;
 
-#ifdef MULTI_GPU
-void** ghost_fatlink, **ghost_longlink;
-#endif
+void **ghost_fatlink = nullptr, **ghost_longlink = nullptr;
 
 
 QudaPrecision cpu_prec = QUDA_DOUBLE_PRECISION;
@@ -333,16 +332,32 @@ invert_test(void)
 
 
 
-#ifdef MULTI_GPU
-      // matdagmat_mg4dir(ref, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink,
-      // out, mass, 0, inv_param.cpu_prec, gaugeParam.cpu_prec, tmp, QUDA_EVEN_PARITY);
-#else
-      matdagmat(ref->V(), qdp_fatlink, qdp_longlink, out->V(), mass, 0, inv_param.cpu_prec, gaugeParam.cpu_prec, tmp->V(), QUDA_EVEN_PARITY);
-#endif
+      {
+        // verify every source in a single sweep of the host operator
+        std::vector<cpuColorSpinorField *> solutions(spinorOutArray, spinorOutArray + inv_param.num_src);
+        std::vector<cpuColorSpinorField *> sources(spinorInArray, spinorInArray + inv_param.num_src);
+        std::vector<cpuColorSpinorField *> refs(inv_param.num_src);
+        refs[0] = ref;
+        for (int i = 1; i < inv_param.num_src; i++) refs[i] = new cpuColorSpinorField(csParam);
+
+        matdagmat(refs, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink, solutions, mass, 0,
+                  inv_param.cpu_prec, gaugeParam.cpu_prec, QUDA_EVEN_PARITY, dslash_type);
+
+        for (int i = 0; i < inv_param.num_src; i++) {
+          mxpy(sources[i]->V(), refs[i]->V(), Vh * mySpinorSiteSize, inv_param.cpu_prec);
+          double src_nrm2 = norm_2(refs[i]->V(), Vh * mySpinorSiteSize, inv_param.cpu_prec);
+          double src_src2 = norm_2(sources[i]->V(), Vh * mySpinorSiteSize, inv_param.cpu_prec);
+          printfQuda("Source %d residual: (L2 relative) tol %g, host = %g\n", i, inv_param.tol,
+                     sqrt(src_nrm2 / src_src2));
+          if (sqrt(src_nrm2 / src_src2) > 10 * inv_param.tol) ret |= 1;
+          if (i == 0) {
+            nrm2 = src_nrm2;
+            src2 = src_src2;
+          }
+        }
 
-      mxpy(in->V(), ref->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
-      nrm2 = norm_2(ref->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
-      src2 = norm_2(in->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
+        for (int i = 1; i < inv_param.num_src; i++) delete refs[i];
+      }
 
       for(int i=1; i < inv_param.num_src;i++) delete spinorOutArray[i];
       for(int i=1; i < inv_param.num_src;i++) delete spinorInArray[i];
@@ -363,12 +378,8 @@ invert_test(void)
       time0 += clock(); // stop the timer
       time0 /= CLOCKS_PER_SEC;
 
-#ifdef MULTI_GPU
-      // matdagmat_mg4dir(ref, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink,
-      // out, mass, 0, inv_param.cpu_prec, gaugeParam.cpu_prec, tmp, QUDA_ODD_PARITY);
-#else
-      matdagmat(ref->V(), qdp_fatlink, qdp_longlink, out->V(), mass, 0, inv_param.cpu_prec, gaugeParam.cpu_prec, tmp->V(), QUDA_ODD_PARITY);
-#endif
+      matdagmat(ref, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink, out, mass, 0, inv_param.cpu_prec,
+                gaugeParam.cpu_prec, tmp, QUDA_ODD_PARITY, dslash_type);
       mxpy(in->V(), ref->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
       nrm2 = norm_2(ref->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
       src2 = norm_2(in->V(), Vh*mySpinorSiteSize, inv_param.cpu_prec);
@@ -441,13 +452,8 @@ invert_test(void)
         }
         for(int i=0;i < inv_param.num_offset;i++){
           printfQuda("%dth solution: mass=%f, ", i, masses[i]);
-#ifdef MULTI_GPU
-          // matdagmat_mg4dir(ref, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink,
-          //     spinorOutArray[i], masses[i], 0, inv_param.cpu_prec,
-          //     gaugeParam.cpu_prec, tmp, parity);
-#else
-          matdagmat(ref->V(), qdp_fatlink, qdp_longlink, outArray[i], masses[i], 0, inv_param.cpu_prec, gaugeParam.cpu_prec, tmp->V(), parity);
-#endif
+          matdagmat(ref, qdp_fatlink, qdp_longlink, ghost_fatlink, ghost_longlink, spinorOutArray[i], masses[i], 0,
+                    inv_param.cpu_prec, gaugeParam.cpu_prec, tmp, parity, dslash_type);
 
 	  mxpy(in->V(), ref->V(), len*mySpinorSiteSize, inv_param.cpu_prec);
 	  double nrm2 = norm_2(ref->V(), len*mySpinorSiteSize, inv_param.cpu_prec);
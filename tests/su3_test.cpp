@@ -21,6 +21,11 @@
 // In a typical application, quda.h is the only QUDA header required.
 #include <quda.h>
 
+// for verifying the host gauge observables
+#include <comm_quda.h>
+#include <gauge_field.h>
+#include <gauge_tools.h>
+
 #define MAX(a,b) ((a)>(b)?(a):(b))
 
 QudaPrecision cpu_prec = QUDA_DOUBLE_PRECISION;
@@ -63,6 +68,43 @@ void setGaugeParam(QudaGaugeParam &gauge_param) {
 #endif
 }
 
+/**
+   Create a copy of the QDP-ordered host gauge field, extended by R
+   in each dimension with the halos filled, upon which the host gauge
+   observables are computed.
+*/
+quda::cpuGaugeField *createExtendedHostGauge(void **gauge, QudaGaugeParam &gauge_param, const int *R)
+{
+  quda::GaugeFieldParam param(gauge, gauge_param);
+  quda::cpuGaugeField in(param);
+
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+  for (int d = 0; d < 4; d++) {
+    param.x[d] += 2 * R[d];
+    param.r[d] = R[d];
+  }
+  auto *out = new quda::cpuGaugeField(param);
+  quda::copyExtendedGauge(*out, in, QUDA_CPU_FIELD_LOCATION);
+  out->exchangeExtendedGhost(R);
+  return out;
+}
+
+#ifdef GPU_GAUGE_TOOLS
+// topological charge of an extended host gauge field
+double hostQCharge(const quda::cpuGaugeField &u, QudaGaugeParam &gauge_param)
+{
+  quda::GaugeFieldParam tensorParam(gauge_param.X, u.Precision(), QUDA_RECONSTRUCT_NO, 0, QUDA_TENSOR_GEOMETRY,
+                                    QUDA_GHOST_EXCHANGE_NO);
+  tensorParam.siteSubset = QUDA_FULL_SITE_SUBSET;
+  tensorParam.order = u.Order();
+  tensorParam.location = QUDA_CPU_FIELD_LOCATION;
+  quda::cpuGaugeField Fmunu(tensorParam);
+  quda::computeFmunu(Fmunu, u);
+  return quda::computeQCharge(Fmunu);
+}
+#endif
+
 int main(int argc, char **argv)
 {
 
@@ -124,6 +166,15 @@ int main(int argc, char **argv)
   plaqQuda(plaq);
   printfQuda("Computed plaquette gauge precise is %e (spatial = %e, temporal = %e)\n", plaq[0], plaq[1], plaq[2]);
 
+  // the same observables are computed on the host from the host field
+  int R[4];
+  for (int d = 0; d < 4; d++) R[d] = 2 * comm_dim_partitioned(d);
+  quda::cpuGaugeField *host_gauge = createExtendedHostGauge(gauge, gauge_param, R);
+
+  double3 host_plaq = quda::plaquette(*host_gauge);
+  printfQuda("Computed host plaquette is %e (spatial = %e, temporal = %e). Plaquette deviation: %e\n", host_plaq.x,
+             host_plaq.y, host_plaq.z, host_plaq.x - plaq[0]);
+
 #ifdef GPU_GAUGE_TOOLS
 
   // Topological charge
@@ -153,6 +204,9 @@ int main(int argc, char **argv)
   printfQuda("GPU value %e and host density sum %e. Q charge deviation: %e\n", qCharge, qChargeCheck,
              qCharge - qChargeCheck);
 
+  double qChargeHost = hostQCharge(*host_gauge, gauge_param);
+  printfQuda("Computed host topological charge is %.16e. Q charge deviation: %e\n", qChargeHost, qChargeHost - qCharge);
+
   // Stout smearing should be equivalent to APE smearing
   // on D dimensional lattices for rho = alpha/2*(D-1). 
   // Typical APE values are aplha=0.6, rho=0.1 for Stout.
@@ -171,6 +225,26 @@ int main(int argc, char **argv)
   qCharge = qChargeQuda();
   printf("Computed topological charge after is %.16e \n", qCharge);
 
+  // STOUT on the host
+  time0 = -((double)clock());
+  {
+    quda::GaugeFieldParam param(*host_gauge);
+    param.create = QUDA_NULL_FIELD_CREATE;
+    quda::cpuGaugeField host_tmp(param);
+    for (unsigned int i = 0; i < nSteps; i++) {
+      host_tmp.copy(*host_gauge);
+      host_tmp.exchangeExtendedGhost(R);
+      quda::STOUTStep(*host_gauge, host_tmp, coeff_STOUT);
+    }
+    host_gauge->exchangeExtendedGhost(R);
+  }
+  time0 += clock();
+  time0 /= CLOCKS_PER_SEC;
+  printfQuda("Total time for host STOUT = %g secs\n", time0);
+  qChargeHost = hostQCharge(*host_gauge, gauge_param);
+  printfQuda("Computed host topological charge after is %.16e. Q charge deviation: %e\n", qChargeHost,
+             qChargeHost - qCharge);
+
   //APE
   // start the timer
   time0 = -((double)clock());
@@ -200,6 +274,8 @@ int main(int argc, char **argv)
   printfQuda("Skipping other gauge tests since gauge tools have not been compiled\n");
 #endif
 
+  delete host_gauge;
+
   if (verify_results) check_gauge(gauge, new_gauge, 1e-3, gauge_param.cpu_prec);
 
   freeGaugeQuda();
@@ -145,6 +145,7 @@ int eig_nEv = 16;
 int eig_nKr = 32;
 int eig_nConv = -1; // If unchanged, will be set to nEv
 int eig_batched_rotate = 0; // If unchanged, will be set to maximum
+QudaFieldLocation eig_location = QUDA_CUDA_FIELD_LOCATION;
 bool eig_require_convergence = true;
 int eig_check_interval = 10;
 int eig_max_restarts = 1000;
@@ -536,6 +537,11 @@ void add_eigen_option_group(std::shared_ptr<QUDAApp> quda_app)
   opgroup->add_option("--eig-nKr", eig_nKr, "The size of the Krylov subspace to use in the eigensolver");
   opgroup->add_option("--eig-batched-rotate", eig_batched_rotate,
                       "The maximum number of extra eigenvectors the solver may allocate to perform a Ritz rotation.");
+  opgroup
+    ->add_option("--eig-location", eig_location,
+                 "The location of the Krylov space in the eigensolver: cpu runs the Lanczos iteration and Ritz "
+                 "rotations on the host (default gpu)")
+    ->transform(CLI::QUDACheckedTransformer(field_location_map));
   opgroup->add_option("--eig-poly-deg", eig_poly_deg, "TODO");
   opgroup->add_option(
     "--eig-require-convergence",
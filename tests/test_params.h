@@ -276,6 +276,7 @@ extern int eig_nEv;
 extern int eig_nKr;
 extern int eig_nConv; // If unchanged, will be set to nEv
 extern int eig_batched_rotate; // If unchanged, will be set to maximum
+extern QudaFieldLocation eig_location;
 extern bool eig_require_convergence;
 extern int eig_check_interval;
 extern int eig_max_restarts;
@@ -135,6 +135,13 @@ void finalizeComms()
 }
 
 
+// seed and next stream of the counter-based generator used for host fields
+static unsigned long long host_rng_seed = 137;
+static unsigned int host_rng_stream = 0;
+
+// each generated field draws from a new stream so that successive fields differ
+static quda::CounterRNG nextHostRNG() { return quda::CounterRNG(host_rng_seed, host_rng_stream++); }
+
 void initRand()
 {
   int rank = 0;
@@ -146,6 +153,10 @@ void initRand()
 #endif
 
   srand(17*rank + 137);
+
+  // the counter-based generator is keyed on the global site, so it is seeded identically on all ranks
+  host_rng_seed = 137;
+  host_rng_stream = 0;
 }
 
 void setDims(int *X) {
@@ -900,77 +911,96 @@ static void orthogonalize(complex<Float> *a, complex<Float> *b, int len) {
   for (int i=0; i<len; i++) b[i] -= (complex<Float>)dot*a[i];
 }
 
+// global lexicographic index of the site with checkerboard index i and
+// parity oddBit, used to key the counter-based generator so that host
+// fields are independent of the process grid
+static unsigned long long globalSiteIndex(int i, int oddBit)
+{
+  int X = fullLatticeIndex(i, oddBit);
+  int x[4] = {X % Z[0], (X / Z[0]) % Z[1], (X / (Z[0] * Z[1])) % Z[2], X / (Z[0] * Z[1] * Z[2])};
+  unsigned long long index = 0;
+  for (int d = 3; d >= 0; d--) index = index * (Z[d] * comm_dim(d)) + comm_coord(d) * Z[d] + x[d];
+  return index;
+}
+
+// as above for an index i running over the full even-odd ordered lattice
+static unsigned long long globalSiteIndex(int i) { return i < Vh ? globalSiteIndex(i, 0) : globalSiteIndex(i - Vh, 1); }
+
+// set a random SU(3) matrix: the last two rows are drawn uniformly and
+// orthonormalized, and the first row is their conjugate cross product
 template <typename Float>
-static void constructGaugeField(Float **res, QudaGaugeParam *param, QudaDslashType dslash_type = QUDA_WILSON_DSLASH)
+static void constructRandomLink(Float *link, const quda::CounterRNG &rng, unsigned long long site, int dir)
 {
-  Float *resOdd[4], *resEven[4];
-  for (int dir = 0; dir < 4; dir++) {
-    resEven[dir] = res[dir];
-    resOdd[dir]  = res[dir]+Vh*gaugeSiteSize;
+  for (int m = 1; m < 3; m++) { // last 2 rows
+    for (int n = 0; n < 3; n++) { // 3 columns
+      double re, im;
+      rng.uniform(re, im, site, dir * 9 + m * 3 + n);
+      link[m * (3 * 2) + n * (2) + 0] = re;
+      link[m * (3 * 2) + n * (2) + 1] = im;
+    }
   }
+  normalize((complex<Float> *)(link + 1 * 3 * 2), 3);
+  orthogonalize((complex<Float> *)(link + 1 * 3 * 2), (complex<Float> *)(link + 2 * 3 * 2), 3);
+  normalize((complex<Float> *)(link + 2 * 3 * 2), 3);
 
-  for (int dir = 0; dir < 4; dir++) {
-    for (int i = 0; i < Vh; i++) {
-      for (int m = 1; m < 3; m++) { // last 2 rows
-	for (int n = 0; n < 3; n++) { // 3 columns
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = rand() / (Float)RAND_MAX;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-          resOdd[dir][i * (3 * 3 * 2) + m * (3 * 2) + n * (2) + 1] = rand() / (Float)RAND_MAX;
-        }
-      }
-      normalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), (complex<Float>*)(resEven[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resEven[dir] + (i*3 + 2)*3*2), 3);
+  Float *w = link + 0 * 3 * 2;
+  Float *u = link + 1 * 3 * 2;
+  Float *v = link + 2 * 3 * 2;
 
-      normalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), (complex<Float>*)(resOdd[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resOdd[dir] + (i*3 + 2)*3*2), 3);
+  for (int n = 0; n < 6; n++) w[n] = 0.0;
+  accumulateConjugateProduct(w + 0 * (2), u + 1 * (2), v + 2 * (2), +1);
+  accumulateConjugateProduct(w + 0 * (2), u + 2 * (2), v + 1 * (2), -1);
+  accumulateConjugateProduct(w + 1 * (2), u + 2 * (2), v + 0 * (2), +1);
+  accumulateConjugateProduct(w + 1 * (2), u + 0 * (2), v + 2 * (2), -1);
+  accumulateConjugateProduct(w + 2 * (2), u + 0 * (2), v + 1 * (2), +1);
+  accumulateConjugateProduct(w + 2 * (2), u + 1 * (2), v + 0 * (2), -1);
+}
 
-      {
-	Float *w = resEven[dir]+(i*3+0)*3*2;
-	Float *u = resEven[dir]+(i*3+1)*3*2;
-	Float *v = resEven[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
+// fill both parities of a gauge field with random SU(3) matrices
+template <typename Float> static void constructRandomLinks(Float **res)
+{
+  const quda::CounterRNG rng = nextHostRNG();
 
-      {
-	Float *w = resOdd[dir]+(i*3+0)*3*2;
-	Float *u = resOdd[dir]+(i*3+1)*3*2;
-	Float *v = resOdd[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
+#pragma omp parallel for collapse(3)
+  for (int dir = 0; dir < 4; dir++) {
+    for (int parity = 0; parity < 2; parity++) {
+      for (int i = 0; i < Vh; i++) {
+        constructRandomLink(res[dir] + (parity * Vh + i) * gaugeSiteSize, rng, globalSiteIndex(i, parity), dir);
       }
-
     }
   }
+}
+
+template <typename Float>
+static void constructGaugeField(Float **res, QudaGaugeParam *param, QudaDslashType dslash_type = QUDA_WILSON_DSLASH)
+{
+  Float *resOdd[4], *resEven[4];
+  for (int dir = 0; dir < 4; dir++) {
+    resEven[dir] = res[dir];
+    resOdd[dir]  = res[dir]+Vh*gaugeSiteSize;
+  }
+
+  constructRandomLinks(res);
 
   if (param->type == QUDA_WILSON_LINKS) {
     applyGaugeFieldScaling(res, Vh, param);
   } else if (param->type == QUDA_ASQTAD_LONG_LINKS) {
     applyGaugeFieldScaling_long(res, Vh, param, dslash_type);
   } else if (param->type == QUDA_ASQTAD_FAT_LINKS) {
+    const quda::CounterRNG rng = nextHostRNG();
+#pragma omp parallel for collapse(2)
     for (int dir = 0; dir < 4; dir++) {
       for (int i = 0; i < Vh; i++) {
+        const unsigned long long even = globalSiteIndex(i, 0), odd = globalSiteIndex(i, 1);
 	for (int m = 0; m < 3; m++) { // last 2 rows
 	  for (int n = 0; n < 3; n++) { // 3 columns
-	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] =1.0* rand() / (Float)RAND_MAX;
-	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 2.0* rand() / (Float)RAND_MAX;
-	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = 3.0*rand() / (Float)RAND_MAX;
-	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 4.0*rand() / (Float)RAND_MAX;
+	    double re, im;
+	    rng.uniform(re, im, even, dir * 9 + m * 3 + n);
+	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = 1.0 * re;
+	    resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 2.0 * im;
+	    rng.uniform(re, im, odd, dir * 9 + m * 3 + n);
+	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = 3.0 * re;
+	    resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = 4.0 * im;
 	  }
 	}
       }
@@ -978,62 +1008,7 @@ static void constructGaugeField(Float **res, QudaGaugeParam *param, QudaDslashTy
   }
 }
 
-template <typename Float> void constructUnitaryGaugeField(Float **res)
-{
-  Float *resOdd[4], *resEven[4];
-  for (int dir = 0; dir < 4; dir++) {
-    resEven[dir] = res[dir];
-    resOdd[dir]  = res[dir]+Vh*gaugeSiteSize;
-  }
-
-  for (int dir = 0; dir < 4; dir++) {
-    for (int i = 0; i < Vh; i++) {
-      for (int m = 1; m < 3; m++) { // last 2 rows
-	for (int n = 0; n < 3; n++) { // 3 columns
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-	  resEven[dir][i*(3*3*2) + m*(3*2) + n*(2) + 1] = rand() / (Float)RAND_MAX;
-	  resOdd[dir][i*(3*3*2) + m*(3*2) + n*(2) + 0] = rand() / (Float)RAND_MAX;
-          resOdd[dir][i * (3 * 3 * 2) + m * (3 * 2) + n * (2) + 1] = rand() / (Float)RAND_MAX;
-        }
-      }
-      normalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resEven[dir] + (i*3+1)*3*2), (complex<Float>*)(resEven[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resEven[dir] + (i*3 + 2)*3*2), 3);
-
-      normalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), 3);
-      orthogonalize((complex<Float>*)(resOdd[dir] + (i*3+1)*3*2), (complex<Float>*)(resOdd[dir] + (i*3+2)*3*2), 3);
-      normalize((complex<Float>*)(resOdd[dir] + (i*3 + 2)*3*2), 3);
-
-      {
-	Float *w = resEven[dir]+(i*3+0)*3*2;
-	Float *u = resEven[dir]+(i*3+1)*3*2;
-	Float *v = resEven[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
-
-      {
-	Float *w = resOdd[dir]+(i*3+0)*3*2;
-	Float *u = resOdd[dir]+(i*3+1)*3*2;
-	Float *v = resOdd[dir]+(i*3+2)*3*2;
-
-        for (int n = 0; n < 6; n++) w[n] = 0.0;
-	accumulateConjugateProduct(w+0*(2), u+1*(2), v+2*(2), +1);
-	accumulateConjugateProduct(w+0*(2), u+2*(2), v+1*(2), -1);
-	accumulateConjugateProduct(w+1*(2), u+2*(2), v+0*(2), +1);
-	accumulateConjugateProduct(w+1*(2), u+0*(2), v+2*(2), -1);
-	accumulateConjugateProduct(w+2*(2), u+0*(2), v+1*(2), +1);
-	accumulateConjugateProduct(w+2*(2), u+1*(2), v+0*(2), -1);
-      }
-    }
-  }
-}
+template <typename Float> void constructUnitaryGaugeField(Float **res) { constructRandomLinks(res); }
 
 template <typename Float> static void applyStaggeredScaling(Float **res, QudaGaugeParam *param, int type)
 {
@@ -1095,7 +1070,9 @@ void construct_fat_long_gauge_field(void **fatlink, void **longlink, int type, Q
 
     if (dslash_type == QUDA_ASQTAD_DSLASH) {
       // incorporate non-trivial phase into long links
-      const double phase = (M_PI * rand()) / RAND_MAX;
+      double u0, u1;
+      nextHostRNG().uniform(u0, u1, 0, 0);
+      const double phase = M_PI * u0;
       const complex<double> z = polar(1.0, phase);
       for (int dir = 0; dir < 4; ++dir) {
         for (int i = 0; i < V; ++i) {
@@ -1136,11 +1113,16 @@ void construct_fat_long_gauge_field(void **fatlink, void **longlink, int type, Q
 template <typename Float>
 static void constructCloverField(Float *res, double norm, double diag) {
 
-  Float c = 2.0 * norm / RAND_MAX;
+  const quda::CounterRNG rng = nextHostRNG();
 
+#pragma omp parallel for
   for(int i = 0; i < V; i++) {
-    for (int j = 0; j < 72; j++) {
-      res[i*72 + j] = c*rand() - norm;
+    const unsigned long long site = globalSiteIndex(i);
+    for (int j = 0; j < 72; j += 2) {
+      double u0, u1;
+      rng.uniform(u0, u1, site, j / 2);
+      res[i*72 + j + 0] = 2.0 * norm * u0 - norm;
+      res[i*72 + j + 1] = 2.0 * norm * u1 - norm;
     }
 
     //impose clover symmetry on each chiral block
@@ -1456,21 +1438,24 @@ void createMomCPU(void *mom, QudaPrecision precision)
     exit(1);
   }
 
+  const quda::CounterRNG rng = nextHostRNG();
+
+#pragma omp parallel for
   for(int i=0;i < V;i++){
-    if (precision == QUDA_DOUBLE_PRECISION){
-      for(int dir=0;dir < 4;dir++){
-        double *thismom = (double *)mom;
-        for(int k=0; k < momSiteSize; k++){
-          thismom[(4 * i + dir) * momSiteSize + k] = 1.0 * rand() / RAND_MAX;
-          if (k==momSiteSize-1) thismom[ (4*i+dir)*momSiteSize + k ]= 0.0;
-        }
-      }
-    }else{
-      for(int dir=0;dir < 4;dir++){
-	float* thismom=(float*)mom;
-	for(int k=0; k < momSiteSize; k++){
-          thismom[(4 * i + dir) * momSiteSize + k] = 1.0 * rand() / RAND_MAX;
-          if (k==momSiteSize-1) thismom[ (4*i+dir)*momSiteSize + k ]= 0.0;
+    const unsigned long long site = globalSiteIndex(i);
+    for(int dir=0;dir < 4;dir++){
+      for(int k=0; k < momSiteSize; k += 2){
+        double u0, u1;
+        rng.uniform(u0, u1, site, dir * momSiteSize / 2 + k / 2);
+        if (k+1 == momSiteSize-1) u1 = 0.0;
+        if (precision == QUDA_DOUBLE_PRECISION) {
+          double *thismom = (double *)mom;
+          thismom[(4 * i + dir) * momSiteSize + k + 0] = u0;
+          thismom[(4 * i + dir) * momSiteSize + k + 1] = u1;
+        } else {
+          float *thismom = (float *)mom;
+          thismom[(4 * i + dir) * momSiteSize + k + 0] = u0;
+          thismom[(4 * i + dir) * momSiteSize + k + 1] = u1;
         }
       }
     }
@@ -1483,20 +1468,24 @@ void createMomCPU(void *mom, QudaPrecision precision)
 void
 createHwCPU(void* hw,  QudaPrecision precision)
 {
+  const quda::CounterRNG rng = nextHostRNG();
+
+#pragma omp parallel for
   for(int i=0;i < V;i++){
-    if (precision == QUDA_DOUBLE_PRECISION){
-      for(int dir=0;dir < 4;dir++){
-	double* thishw = (double*)hw;
-	for(int k=0; k < hwSiteSize; k++){
-	  thishw[ (4*i+dir)*hwSiteSize + k ]= 1.0* rand() /RAND_MAX;
-	}
-      }
-    }else{
-      for(int dir=0;dir < 4;dir++){
-	float* thishw=(float*)hw;
-	for(int k=0; k < hwSiteSize; k++){
-	  thishw[ (4*i+dir)*hwSiteSize + k ]= 1.0* rand() /RAND_MAX;
-	}
+    const unsigned long long site = globalSiteIndex(i);
+    for(int dir=0;dir < 4;dir++){
+      for(int k=0; k < hwSiteSize; k += 2){
+        double u0, u1;
+        rng.uniform(u0, u1, site, dir * hwSiteSize / 2 + k / 2);
+        if (precision == QUDA_DOUBLE_PRECISION) {
+          double *thishw = (double *)hw;
+          thishw[(4 * i + dir) * hwSiteSize + k + 0] = u0;
+          thishw[(4 * i + dir) * hwSiteSize + k + 1] = u1;
+        } else {
+          float *thishw = (float *)hw;
+          thishw[(4 * i + dir) * hwSiteSize + k + 0] = u0;
+          thishw[(4 * i + dir) * hwSiteSize + k + 1] = u1;
+        }
       }
     }
   }
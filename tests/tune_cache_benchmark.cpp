@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <map>
+#include <vector>
+#include <chrono>
+
+#include <tune_cache.h>
+
+/**
+   Host-only microbenchmark of the tunecache lookup cost as a function
+   of the number of cached kernels.  Compares the ordered map (three
+   strcmp per node visited) that previously backed the tunecache with
+   the hashed TuneCacheMap, and with the memoized path taken by
+   tuneLaunch on a repeat launch from the same Tunable instance.
+
+   Usage: tune_cache_benchmark [max_entries] [lookups]
+*/
+
+using namespace quda;
+
+// stand-in for TuneParam, which depends on CUDA vector types
+struct Param {
+  int block[3];
+  int grid[3];
+  long long n_calls;
+  Param() : block {32, 1, 1}, grid {1, 1, 1}, n_calls(0) { }
+};
+
+// generate keys with the same shape and shared prefixes as the real ones
+static TuneKey make_key(int i)
+{
+  static const char *volumes[] = {"16x16x16x16", "8x8x8x8", "4x4x4x8", "2x2x2x4"};
+  static const char *names[] = {"N4quda4blas5axpbyI6float2S2_EE", "N4quda6reduce4NormI6float4S2_EE",
+                                "N4quda13WilsonLaunchIL9KernelType0EEE", "N4quda12CalculateYArgIfLi24ELi32EEE"};
+  char aux[TuneKey::aux_n];
+  snprintf(aux, TuneKey::aux_n, "vol=%d,stride=%d,precision=%d,order=%d,Ns=4,Nc=3,TwistFlavour=1,id=%d", 4096 >> (i % 4),
+           2048 >> (i % 4), 2 << (i % 3), 4, i);
+  return TuneKey(volumes[i % 4], names[(i / 4) % 4], aux);
+}
+
+template <typename F> static double time_per_op(F &&f, int n)
+{
+  auto start = std::chrono::high_resolution_clock::now();
+  f();
+  auto stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / n;
+}
+
+int main(int argc, char **argv)
+{
+  int max_entries = argc > 1 ? atoi(argv[1]) : 65536;
+  int lookups = argc > 2 ? atoi(argv[2]) : 1000000;
+
+  printf("%10s %16s %16s %16s\n", "entries", "std::map (ns)", "hash (ns)", "memo (ns)");
+
+  for (int n = 16; n <= max_entries; n *= 4) {
+    std::vector<TuneKey> keys;
+    keys.reserve(n);
+    for (int i = 0; i < n; i++) keys.push_back(make_key(i));
+
+    std::map<TuneKey, Param> tree;
+    TuneCacheMap<Param> hash;
+    for (auto &key : keys) {
+      tree[key] = Param();
+      hash[key] = Param();
+    }
+
+    // pseudo-random access pattern, fixed across the three variants
+    std::vector<int> order(lookups);
+    unsigned int state = 12345;
+    for (auto &o : order) {
+      state = state * 1664525u + 1013904223u;
+      o = (state >> 8) % n;
+    }
+
+    long long checksum = 0;
+
+    double t_tree = time_per_op(
+      [&]() {
+        for (int i = 0; i < lookups; i++) checksum += ++tree.find(keys[order[i]])->second.n_calls;
+      },
+      lookups);
+
+    double t_hash = time_per_op(
+      [&]() {
+        for (int i = 0; i < lookups; i++) checksum += ++hash.find(keys[order[i]])->second.n_calls;
+      },
+      lookups);
+
+    // repeat launches of a single key with the memoized entry, as done by tuneLaunch
+    TuneCacheMap<Param>::value_type *entry = nullptr;
+    double t_memo = time_per_op(
+      [&]() {
+        for (int i = 0; i < lookups; i++) {
+          const TuneKey &key = keys[order[0]];
+          if (!entry || entry->first.hash != key.hash) entry = &*hash.find(key);
+          checksum += ++entry->second.n_calls;
+        }
+      },
+      lookups);
+
+    printf("%10d %16.2f %16.2f %16.2f\n", n, t_tree, t_hash, t_memo);
+    if (checksum == 0) printf("checksum = %lld\n", checksum); // prevent elision of the loops
+  }
+
+  return 0;
+}
@@ -39,7 +39,7 @@ static double max_allowed_error = 1e-11;
 static QudaPrecision cpu_prec = QUDA_DOUBLE_PRECISION;
 static QudaGaugeFieldOrder gauge_order = QUDA_MILC_GAUGE_ORDER;
 
-cpuGaugeField *cpuFatLink, *cpuULink, *cudaResult;
+cpuGaugeField *cpuFatLink, *cpuULink, *cudaResult, *hostULink;
 cudaGaugeField *cudaFatLink, *cudaULink;
 
 const double unittol = (prec == QUDA_DOUBLE_PRECISION) ? 1e-10 : 1e-6;
@@ -59,6 +59,24 @@ TEST(unitarization, verify) {
   ASSERT_EQ(res,1) << "CPU and CUDA implementations do not agree";
 }
 
+TEST(unitarization, host) {
+  unitarizeLinksCPU(*cpuULink, *cpuFatLink);
+
+  int num_failures = 0;
+  unitarizeLinks(*hostULink, *cpuFatLink, &num_failures);
+
+  const double hosttol = (cpu_prec == QUDA_DOUBLE_PRECISION) ? 1e-10 : 1e-6;
+  int res = compare_floats(hostULink->Gauge_p(), cpuULink->Gauge_p(), 4 * hostULink->Volume() * gaugeSiteSize,
+                           hosttol, cpu_prec);
+
+#ifdef MULTI_GPU
+  comm_allreduce_int(&res);
+  res /= comm_size();
+#endif
+
+  ASSERT_EQ(res,1) << "Host and CPU reference implementations do not agree";
+}
+
 static int unitarize_link_test(int &test_rc)
 {
   QudaGaugeParam qudaGaugeParam = newQudaGaugeParam();
@@ -150,6 +168,9 @@ static int unitarize_link_test(int &test_rc)
   gParam.create = QUDA_ZERO_FIELD_CREATE;
   cudaResult  = new cpuGaugeField(gParam);
 
+  gParam.create = QUDA_ZERO_FIELD_CREATE;
+  hostULink  = new cpuGaugeField(gParam);
+
   gParam.pad         = 0;
   gParam.create      = QUDA_NULL_FIELD_CREATE;
   gParam.reconstruct = QUDA_RECONSTRUCT_NO;
@@ -197,6 +218,7 @@ static int unitarize_link_test(int &test_rc)
   }
 
   delete cudaResult;
+  delete hostULink;
   delete cpuULink;
   delete cpuFatLink;
   delete cudaFatLink;
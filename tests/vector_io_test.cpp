@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <color_spinor_field.h>
+#include <vector_io.h>
+#include <util_quda.h>
+
+#include <test_util.h>
+#include <test_params.h>
+#include <misc.h>
+
+#include <gtest/gtest.h>
+
+/**
+   Round-trip test of the native vector checkpoint format.  Random
+   host vectors are saved and loaded back for each storage format and
+   for full and single-parity fields, and the loaded vectors are
+   compared with the originals to the accuracy of the storage format.
+   A chunk of the file is then corrupted, which must be detected by
+   the checksum.
+
+   Usage: vector_io_test --dim X Y Z T --gridsize X Y Z T
+*/
+
+using namespace quda;
+
+using ::testing::Combine;
+using ::testing::Range;
+using ::testing::Values;
+
+static constexpr int nvec_test = 3;
+static const std::string vector_file = "vector_io_test.dat";
+
+const char *storage_str[] = {"double", "single", "half", "fixed16"};
+
+/**
+   @brief The maximum error allowed when loading a vector, relative to
+   the largest element of each site
+ */
+static double storageTolerance(VectorFileStorage storage)
+{
+  switch (storage) {
+  case VECTOR_FILE_STORAGE_DOUBLE: return 0.0;
+  case VECTOR_FILE_STORAGE_SINGLE: return 1e-7;
+  case VECTOR_FILE_STORAGE_HALF: return 1e-3;
+  case VECTOR_FILE_STORAGE_FIXED16: return 2e-5;
+  default: errorQuda("Unknown vector file storage %d", storage);
+  }
+  return 0.0;
+}
+
+/**
+   @brief Return the largest error of the loaded vector relative to
+   the largest element of each site of the original vector
+ */
+static double siteRelativeError(const cpuColorSpinorField &ref, const cpuColorSpinorField &v)
+{
+  const double *a = static_cast<const double *>(ref.V());
+  const double *b = static_cast<const double *>(v.V());
+  const int site_reals = 2 * ref.Nspin() * ref.Ncolor();
+
+  double error = 0.0;
+  for (size_t s = 0; s < ref.Volume(); s++) {
+    double max = 0.0;
+    for (int j = 0; j < site_reals; j++) max = std::max(max, std::fabs(a[s * site_reals + j]));
+    for (int j = 0; j < site_reals; j++) {
+      double diff = std::fabs(a[s * site_reals + j] - b[s * site_reals + j]);
+      if (diff > 0.0) error = std::max(error, max > 0.0 ? diff / max : diff);
+    }
+  }
+  comm_allreduce_max(&error);
+  return error;
+}
+
+// flip one byte of the last chunk in the file, i.e., the last vector of the last rank
+static void corruptVectorFile(const std::string &filename)
+{
+  if (comm_rank() == 0) {
+    int fd = open(filename.c_str(), O_RDWR);
+    if (fd < 0) errorQuda("Failed to open %s", filename.c_str());
+    struct stat st;
+    if (fstat(fd, &st) != 0) errorQuda("Failed to stat %s", filename.c_str());
+    const off_t offset = st.st_size - 1;
+    char byte;
+    if (pread(fd, &byte, 1, offset) != 1) errorQuda("Failed to read %s", filename.c_str());
+    byte ^= 0x5a;
+    if (pwrite(fd, &byte, 1, offset) != 1) errorQuda("Failed to write %s", filename.c_str());
+    close(fd);
+  }
+  comm_barrier();
+}
+
+class VectorIOTest : public ::testing::TestWithParam<::testing::tuple<int, QudaSiteSubset>>
+{
+
+protected:
+  VectorFileStorage storage;
+  QudaSiteSubset subset;
+  ColorSpinorParam param;
+  std::vector<ColorSpinorField *> ref;
+  std::vector<ColorSpinorField *> vecs;
+
+public:
+  VectorIOTest() :
+    storage(static_cast<VectorFileStorage>(::testing::get<0>(GetParam()))),
+    subset(::testing::get<1>(GetParam()))
+  {
+  }
+
+  virtual void SetUp()
+  {
+    param.nColor = 3;
+    param.nSpin = 4;
+    param.nDim = 4;
+    for (int d = 0; d < 4; d++) param.x[d] = dim[d];
+    if (subset == QUDA_PARITY_SITE_SUBSET) param.x[0] /= 2;
+    param.pad = 0;
+    param.siteSubset = subset;
+    param.siteOrder = QUDA_EVEN_ODD_SITE_ORDER;
+    param.fieldOrder = QUDA_SPACE_SPIN_COLOR_FIELD_ORDER;
+    param.gammaBasis = QUDA_DEGRAND_ROSSI_GAMMA_BASIS;
+    param.location = QUDA_CPU_FIELD_LOCATION;
+    param.setPrecision(QUDA_DOUBLE_PRECISION);
+
+    for (int i = 0; i < nvec_test; i++) {
+      param.create = QUDA_ZERO_FIELD_CREATE;
+      ref.push_back(ColorSpinorField::Create(param));
+      ref.back()->Source(QUDA_RANDOM_SOURCE);
+      vecs.push_back(ColorSpinorField::Create(param));
+    }
+  }
+
+  virtual void TearDown()
+  {
+    for (auto v : ref) delete v;
+    for (auto v : vecs) delete v;
+    if (comm_rank() == 0) remove(vector_file.c_str());
+    comm_barrier();
+  }
+};
+
+TEST_P(VectorIOTest, roundtrip)
+{
+  saveVectorsNative(ref, vector_file, storage);
+  ASSERT_TRUE(isNativeVectorFile(vector_file));
+  ASSERT_EQ(verifyVectorsNative(vector_file), 0);
+
+  loadVectorsNative(vecs, vector_file);
+
+  const double tol = storageTolerance(storage);
+  for (int i = 0; i < nvec_test; i++) {
+    double error = siteRelativeError(static_cast<cpuColorSpinorField &>(*ref[i]),
+                                     static_cast<cpuColorSpinorField &>(*vecs[i]));
+    printfQuda("%s storage, vector %d: relative error = %e\n", storage_str[storage], i, error);
+    EXPECT_LE(error, tol) << "vector " << i;
+  }
+}
+
+TEST_P(VectorIOTest, checksum)
+{
+  saveVectorsNative(ref, vector_file, storage);
+  ASSERT_EQ(verifyVectorsNative(vector_file), 0);
+
+  corruptVectorFile(vector_file);
+  EXPECT_EQ(verifyVectorsNative(vector_file), 1);
+}
+
+std::string getVectorIOName(::testing::TestParamInfo<::testing::tuple<int, QudaSiteSubset>> param)
+{
+  std::string name = storage_str[::testing::get<0>(param.param)];
+  name += ::testing::get<1>(param.param) == QUDA_PARITY_SITE_SUBSET ? "_parity" : "_full";
+  return name;
+}
+
+INSTANTIATE_TEST_SUITE_P(QUDA, VectorIOTest,
+                         Combine(Range(0, static_cast<int>(VECTOR_FILE_STORAGE_INVALID)),
+                                 Values(QUDA_FULL_SITE_SUBSET, QUDA_PARITY_SITE_SUBSET)),
+                         getVectorIOName);
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+  setVerbosity(verbosity);
+
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+  int result = RUN_ALL_TESTS();
+
+  finalizeComms();
+  return result;
+}
@@ -14,6 +14,7 @@
 
 #include <dslash_util.h>
 #include <string.h>
+#include <vector>
 
 using namespace quda;
 
@@ -69,26 +70,181 @@ static const double projector[8][4][4][2] = {
 };
 
 
-// todo pass projector
-template <typename Float>
-void multiplySpinorByDiracProjector(Float *res, int projIdx, Float *spinorIn) {
-  for (int i=0; i<4*3*2; i++) res[i] = 0.0;
-
-  for (int s = 0; s < 4; s++) {
-    for (int t = 0; t < 4; t++) {
-      Float projRe = projector[projIdx][s][t][0];
-      Float projIm = projector[projIdx][s][t][1];
-      
-      for (int m = 0; m < 3; m++) {
-	Float spinorRe = spinorIn[t*(3*2) + m*(2) + 0];
-	Float spinorIm = spinorIn[t*(3*2) + m*(2) + 1];
-	res[s*(3*2) + m*(2) + 0] += projRe*spinorRe - projIm*spinorIm;
-	res[s*(3*2) + m*(2) + 1] += projRe*spinorIm + projIm*spinorRe;
+/**
+   The rank-2 projectors above have the form P = [1 A; B 1] in
+   2x2 spin blocks, with each row of A, and each row of B, having a
+   single non-zero entry.  The upper rows give the half spinor
+
+     h[s] = psi[s] + upper_coeff[s] * psi[upper_spin[s]],  s = 0,1
+
+   and the lower rows are a multiple of one of the upper rows
+
+     (P psi)[s+2] = lower_coeff[s] * h[lower_spin[s]],  s = 0,1
+
+   so only the half spinor needs to be multiplied by the link.
+ */
+struct HalfProjector {
+  int upper_spin[2];
+  double upper_coeff[2][2];
+  int lower_spin[2];
+  double lower_coeff[2][2];
+};
+
+static const HalfProjector *halfProjectors()
+{
+  static HalfProjector half[8];
+  static bool init = false;
+  if (!init) {
+    for (int p = 0; p < 8; p++) {
+      for (int s = 0; s < 2; s++) {
+        for (int t = 2; t < 4; t++) {
+          if (projector[p][s][t][0] != 0.0 || projector[p][s][t][1] != 0.0) {
+            half[p].upper_spin[s] = t;
+            half[p].upper_coeff[s][0] = projector[p][s][t][0];
+            half[p].upper_coeff[s][1] = projector[p][s][t][1];
+          }
+        }
+        for (int t = 0; t < 2; t++) {
+          if (projector[p][s + 2][t][0] != 0.0 || projector[p][s + 2][t][1] != 0.0) {
+            half[p].lower_spin[s] = t;
+            half[p].lower_coeff[s][0] = projector[p][s + 2][t][0];
+            half[p].lower_coeff[s][1] = projector[p][s + 2][t][1];
+          }
+        }
+      }
+    }
+    init = true;
+  }
+  return half;
+}
+
+/**
+   Precomputed neighbor table for one parity of the local lattice.
+   For each checkerboard site and each of the 8 directions we store
+   which buffer the neighboring spinor and link are read from and the
+   site offset into that buffer.  Spinor buffers are: 0 = the input
+   field, 1+d = the forward ghost in dimension d, 5+d = the backward
+   ghost in dimension d.  Gauge buffers are: 0 = this parity, 1 = the
+   other parity, 2+d = the ghost links in dimension d.
+ */
+struct WilsonNeighborTable {
+  int X[4];
+  bool partitioned[4];
+  int parity;
+  std::vector<int> spinor_idx;
+  std::vector<unsigned char> spinor_buf;
+  std::vector<int> gauge_idx;
+  std::vector<unsigned char> gauge_buf;
+};
+
+static bool partitionedDim(int d)
+{
+#ifdef MULTI_GPU
+  return comm_dim_partitioned(d);
+#else
+  return false;
+#endif
+}
+
+static void buildNeighborTable(WilsonNeighborTable &table, int parity)
+{
+  for (int d = 0; d < 4; d++) {
+    table.X[d] = Z[d];
+    table.partitioned[d] = partitionedDim(d);
+  }
+  table.parity = parity;
+  table.spinor_idx.resize(Vh * 8);
+  table.spinor_buf.resize(Vh * 8);
+  table.gauge_idx.resize(Vh * 8);
+  table.gauge_buf.resize(Vh * 8);
+
+  const int *X = table.X;
+
+#pragma omp parallel for
+  for (int i = 0; i < Vh; i++) {
+    int Y = fullLatticeIndex(i, parity);
+    int x[4] = {Y % X[0], (Y / X[0]) % X[1], (Y / (X[1] * X[0])) % X[2], Y / (X[2] * X[1] * X[0])};
+
+    for (int d = 0; d < 4; d++) {
+      // checkerboard index on the face orthogonal to dimension d
+      int face = 0;
+      for (int e = 3; e >= 0; e--)
+        if (e != d) face = face * X[e] + x[e];
+      face /= 2;
+
+      for (int dir = 0; dir < 2; dir++) { // forwards, backwards
+        int y[4] = {x[0], x[1], x[2], x[3]};
+        y[d] = dir == 0 ? x[d] + 1 : x[d] - 1;
+        const bool halo = (y[d] < 0 || y[d] >= X[d]) && table.partitioned[d];
+        y[d] = (y[d] + X[d]) % X[d];
+        const int nbr = (((y[3] * X[2] + y[2]) * X[1] + y[1]) * X[0] + y[0]) / 2;
+
+        const int k = i * 8 + 2 * d + dir;
+        table.spinor_buf[k] = halo ? (dir == 0 ? 1 + d : 5 + d) : 0;
+        table.spinor_idx[k] = halo ? face : nbr;
+
+        if (dir == 0) { // forwards link lives on this site
+          table.gauge_buf[k] = 0;
+          table.gauge_idx[k] = i;
+        } else { // backwards link lives on the neighbor
+          table.gauge_buf[k] = halo ? 2 + d : 1;
+          table.gauge_idx[k] = halo ? face : nbr;
+        }
       }
     }
   }
 }
 
+/**
+   @return The neighbor table for the current local lattice and
+   parity, rebuilding it only if the lattice or the partitioning has
+   changed since the last call
+ */
+static const WilsonNeighborTable &neighborTable(int parity)
+{
+  static WilsonNeighborTable table[2];
+  static bool init[2] = {false, false};
+
+  bool rebuild = !init[parity];
+  for (int d = 0; d < 4; d++)
+    if (table[parity].X[d] != Z[d] || table[parity].partitioned[d] != partitionedDim(d)) rebuild = true;
+
+  if (rebuild) {
+    buildNeighborTable(table[parity], parity);
+    init[parity] = true;
+  }
+  return table[parity];
+}
+
+// res = U * v for a single color vector
+template <typename sFloat, typename gFloat>
+static inline void linkMul(sFloat *__restrict__ res, const gFloat *__restrict__ U, const sFloat *__restrict__ v)
+{
+  for (int n = 0; n < 3; n++) {
+    sFloat re = 0.0, im = 0.0;
+    for (int m = 0; m < 3; m++) {
+      re += U[(n * 3 + m) * 2 + 0] * v[2 * m + 0] - U[(n * 3 + m) * 2 + 1] * v[2 * m + 1];
+      im += U[(n * 3 + m) * 2 + 0] * v[2 * m + 1] + U[(n * 3 + m) * 2 + 1] * v[2 * m + 0];
+    }
+    res[2 * n + 0] = re;
+    res[2 * n + 1] = im;
+  }
+}
+
+// res = U^\dagger * v for a single color vector
+template <typename sFloat, typename gFloat>
+static inline void linkDagMul(sFloat *__restrict__ res, const gFloat *__restrict__ U, const sFloat *__restrict__ v)
+{
+  for (int n = 0; n < 3; n++) {
+    sFloat re = 0.0, im = 0.0;
+    for (int m = 0; m < 3; m++) {
+      re += U[(m * 3 + n) * 2 + 0] * v[2 * m + 0] + U[(m * 3 + n) * 2 + 1] * v[2 * m + 1];
+      im += U[(m * 3 + n) * 2 + 0] * v[2 * m + 1] - U[(m * 3 + n) * 2 + 1] * v[2 * m + 0];
+    }
+    res[2 * n + 0] = re;
+    res[2 * n + 1] = im;
+  }
+}
 
 //
 // dslashReference()
@@ -99,87 +255,87 @@ void multiplySpinorByDiracProjector(Float *res, int projIdx, Float *spinorIn) {
 // if daggerBit is zero: perform ordinary dslash operator
 // if daggerBit is one:  perform hermitian conjugate of dslash
 //
-
-#ifndef MULTI_GPU
-
+// The ghost arguments are only read for partitioned dimensions, and
+// may be null in a single-process run.  Each direction is applied by
+// projecting to a half spinor, multiplying the two spin components by
+// the link and reconstructing the lower spin components, with the
+// neighbors read from the precomputed neighbor table.
+//
 template <typename sFloat, typename gFloat>
-void dslashReference(sFloat *res, gFloat **gaugeFull, sFloat *spinorField, int oddBit, int daggerBit) {
-  for (int i=0; i<Vh*mySpinorSiteSize; i++) res[i] = 0.0;
-  
-  gFloat *gaugeEven[4], *gaugeOdd[4];
-  for (int dir = 0; dir < 4; dir++) {  
-    gaugeEven[dir] = gaugeFull[dir];
-    gaugeOdd[dir]  = gaugeFull[dir]+Vh*gaugeSiteSize;
-  }
-  
-  for (int i = 0; i < Vh; i++) {
-    for (int dir = 0; dir < 8; dir++) {
-      gFloat *gauge = gaugeLink(i, dir, oddBit, gaugeEven, gaugeOdd, 1);
-      sFloat *spinor = spinorNeighbor(i, dir, oddBit, spinorField, 1);
-      
-      sFloat projectedSpinor[4*3*2], gaugedSpinor[4*3*2];
-      int projIdx = 2*(dir/2)+(dir+daggerBit)%2;
-      multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
-      
-      for (int s = 0; s < 4; s++) {
-	if (dir % 2 == 0) su3Mul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-	else su3Tmul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-      }
-      
-      sum(&res[i*(4*3*2)], &res[i*(4*3*2)], gaugedSpinor, 4*3*2);
+void dslashReference(sFloat *res, gFloat **gaugeFull, gFloat **ghostGauge, sFloat *spinorField, sFloat **fwdSpinor,
+                     sFloat **backSpinor, int oddBit, int daggerBit)
+{
+  const WilsonNeighborTable &table = neighborTable(oddBit);
+  const HalfProjector *half = halfProjectors();
+
+  const sFloat *spinor_buf[9] = {spinorField};
+  const gFloat *gauge_buf[6][4] = {};
+  for (int d = 0; d < 4; d++) {
+    if (table.partitioned[d]) {
+      spinor_buf[1 + d] = fwdSpinor[d];
+      spinor_buf[5 + d] = backSpinor[d];
     }
   }
-}
-
-#else
-
-template <typename sFloat, typename gFloat>
-void dslashReference(sFloat *res, gFloat **gaugeFull,  gFloat **ghostGauge, sFloat *spinorField, 
-		     sFloat **fwdSpinor, sFloat **backSpinor, int oddBit, int daggerBit) {
-  for (int i=0; i<Vh*mySpinorSiteSize; i++) res[i] = 0.0;
-  
-  gFloat *gaugeEven[4], *gaugeOdd[4];
-  gFloat *ghostGaugeEven[4], *ghostGaugeOdd[4];
-  for (int dir = 0; dir < 4; dir++) {  
-    gaugeEven[dir] = gaugeFull[dir];
-    gaugeOdd[dir]  = gaugeFull[dir]+Vh*gaugeSiteSize;
-
-    ghostGaugeEven[dir] = ghostGauge[dir];
-    ghostGaugeOdd[dir] = ghostGauge[dir] + (faceVolume[dir]/2)*gaugeSiteSize;
+  for (int dim = 0; dim < 4; dim++) {
+    gauge_buf[0][dim] = gaugeFull[dim] + oddBit * Vh * gaugeSiteSize;
+    gauge_buf[1][dim] = gaugeFull[dim] + (1 - oddBit) * Vh * gaugeSiteSize;
+    if (table.partitioned[dim])
+      gauge_buf[2 + dim][dim] = ghostGauge[dim] + (1 - oddBit) * (faceVolume[dim] / 2) * gaugeSiteSize;
   }
-  
+
+#pragma omp parallel for
   for (int i = 0; i < Vh; i++) {
+    sFloat out[4 * 3 * 2] = {};
 
     for (int dir = 0; dir < 8; dir++) {
-      gFloat *gauge = gaugeLink_mg4dir(i, dir, oddBit, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd, 1, 1);
-      sFloat *spinor = spinorNeighbor_mg4dir(i, dir, oddBit, spinorField, fwdSpinor, backSpinor, 1, 1);
-      
-      sFloat projectedSpinor[mySpinorSiteSize], gaugedSpinor[mySpinorSiteSize];
-      int projIdx = 2*(dir/2)+(dir+daggerBit)%2;
-      multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
-      
-      for (int s = 0; s < 4; s++) {
-	if (dir % 2 == 0) su3Mul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-	else su3Tmul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
+      const int k = i * 8 + dir;
+      const sFloat *spinor = spinor_buf[table.spinor_buf[k]] + table.spinor_idx[k] * mySpinorSiteSize;
+      const gFloat *gauge = gauge_buf[table.gauge_buf[k]][dir / 2] + table.gauge_idx[k] * gaugeSiteSize;
+      const HalfProjector &p = half[2 * (dir / 2) + (dir + daggerBit) % 2];
+
+      sFloat h[2][3 * 2], Uh[2][3 * 2];
+      for (int s = 0; s < 2; s++) {
+        const sFloat a_re = p.upper_coeff[s][0], a_im = p.upper_coeff[s][1];
+        const sFloat *psi_s = spinor + s * (3 * 2);
+        const sFloat *psi_t = spinor + p.upper_spin[s] * (3 * 2);
+        for (int c = 0; c < 3; c++) {
+          h[s][2 * c + 0] = psi_s[2 * c + 0] + a_re * psi_t[2 * c + 0] - a_im * psi_t[2 * c + 1];
+          h[s][2 * c + 1] = psi_s[2 * c + 1] + a_re * psi_t[2 * c + 1] + a_im * psi_t[2 * c + 0];
+        }
+      }
+
+      for (int s = 0; s < 2; s++) {
+        if (dir % 2 == 0) linkMul(Uh[s], gauge, h[s]);
+        else linkDagMul(Uh[s], gauge, h[s]);
+      }
+
+      for (int s = 0; s < 2; s++) {
+        const sFloat b_re = p.lower_coeff[s][0], b_im = p.lower_coeff[s][1];
+        const sFloat *v = Uh[p.lower_spin[s]];
+        for (int c = 0; c < 3; c++) {
+          out[s * (3 * 2) + 2 * c + 0] += Uh[s][2 * c + 0];
+          out[s * (3 * 2) + 2 * c + 1] += Uh[s][2 * c + 1];
+          out[(s + 2) * (3 * 2) + 2 * c + 0] += b_re * v[2 * c + 0] - b_im * v[2 * c + 1];
+          out[(s + 2) * (3 * 2) + 2 * c + 1] += b_re * v[2 * c + 1] + b_im * v[2 * c + 0];
+        }
       }
-      
-      sum(&res[i*(4*3*2)], &res[i*(4*3*2)], gaugedSpinor, 4*3*2);
     }
 
+    for (int j = 0; j < 4 * 3 * 2; j++) res[i * (4 * 3 * 2) + j] = out[j];
   }
 }
 
-#endif
-
 // this actually applies the preconditioned dslash, e.g., D_ee^{-1} D_eo or D_oo^{-1} D_oe
 void wil_dslash(void *out, void **gauge, void *in, int oddBit, int daggerBit,
 		QudaPrecision precision, QudaGaugeParam &gauge_param) {
   
 #ifndef MULTI_GPU  
   if (precision == QUDA_DOUBLE_PRECISION)
-    dslashReference((double*)out, (double**)gauge, (double*)in, oddBit, daggerBit);
+    dslashReference((double *)out, (double **)gauge, (double **)nullptr, (double *)in, (double **)nullptr,
+                    (double **)nullptr, oddBit, daggerBit);
   else
-    dslashReference((float*)out, (float**)gauge, (float*)in, oddBit, daggerBit);
+    dslashReference((float *)out, (float **)gauge, (float **)nullptr, (float *)in, (float **)nullptr,
+                    (float **)nullptr, oddBit, daggerBit);
 #else
 
   GaugeFieldParam gauge_field_param(gauge, gauge_param);
@@ -249,6 +405,7 @@ void twistGamma5(sFloat *out, sFloat *in, const int dagger, const sFloat kappa,
 
   if (dagger) a *= -1.0;
 
+#pragma omp parallel for
   for(int i = 0; i < V; i++) {
     sFloat tmp[24];
     for(int s = 0; s < 4; s++)
@@ -427,7 +584,8 @@ void ndegTwistGamma5(sFloat *out1, sFloat *out2, sFloat *in1, sFloat *in2, const
   }
 
   if (dagger) a *= -1.0;
-  
+
+#pragma omp parallel for
   for(int i = 0; i < V; i++) {
     sFloat tmp1[24];
     sFloat tmp2[24];    